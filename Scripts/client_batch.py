@@ -14,6 +14,8 @@
 #
 #  Revision History:
 #    Date      Version    Description
+#    10/2026   2026.10    Unix domain socket connection option, and
+#                         pipelined no-ack mode option
 #    11/2022   2023.01    Initial revision
 #
 #
@@ -43,6 +45,9 @@ import os
 
 class client_batch :
 
+  # Maximum number of packets sent in pipelined mode before collecting their responses
+  PIPELINE_WINDOW    = 256
+
   # -----------------------------------------------------------------
   # __init__
   #
@@ -53,6 +58,9 @@ class client_batch :
       # Define widget variables
     self.__hostName          = 'localhost'
     self.__portNumber        = '49152'
+    self.__unixPath          = None
+    self.__noAck             = False
+    self.__txPkts            = []
 
   # -----------------------------------------------------------------
   # __chksum()
@@ -119,11 +127,17 @@ class client_batch :
   def __connectSkt(self) :
 
     try :
-      # Open up a socket
-      self.__skt               = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+      # Open up a Unix domain socket connection, if a path is configured
+      if self.__unixPath :
+        self.__skt             = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self.__skt.connect(self.__unixPath)
+
+      else :
+        # Open up a socket
+        self.__skt             = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
 
-      # Open connection with configuired host TCP/IP address or name, and port number
-      self.__skt.connect((self.__hostName, int(self.__portNumber)))
+        # Open connection with configuired host TCP/IP address or name, and port number
+        self.__skt.connect((self.__hostName, int(self.__portNumber)))
 
     # Update widget states on unsuccessful connection
     except:
@@ -147,6 +161,24 @@ class client_batch :
     return response
 
 
+  # -----------------------------------------------------------------
+  # __flushPipeline()
+  #
+  # Method to send any pipelined packets in a single send, and then
+  # collect their responses
+  #
+  def __flushPipeline(self) :
+
+    if self.__txPkts :
+      self.__skt.sendall(b''.join(self.__txPkts))
+
+      # Kill commands have no response
+      for pkt in self.__txPkts :
+        if pkt[1:2] != b'k' :
+          self.__getmsg(self.__skt)
+
+    self.__txPkts = []
+
   # -----------------------------------------------------------------
   # __scriptExec()
   #
@@ -173,12 +205,22 @@ class client_batch :
           msg = line.rstrip()
           
           if msg[0] == 'D' :
+            self.__flushPipeline()
             self.__disconnectSkt()
+          elif self.__noAck :
+
+            # Queue the packet, sending once a window's worth are queued
+            self.__txPkts.append(('$' + msg + '#' + self.__chksum(msg)).encode())
+
+            if len(self.__txPkts) >= self.PIPELINE_WINDOW :
+              self.__flushPipeline()
           else :
 
             # Send and get response
             response     = self.__sendmsg(msg, self.__skt)
 
+    self.__flushPipeline()
+
     # Close the script file
     script.close()
 
@@ -187,13 +229,17 @@ class client_batch :
   #
   # Top level public calling method to activate a batch run
   #
-  def runBatch(self, portNum, script) :
+  def runBatch(self, portNum, script, unixPath=None, noAck=False) :
 
     self.__txt             = None
     self.__batchMode       = True
     self.__portNumber      = portNum
+    self.__unixPath        = unixPath
     self.__scriptFile      = script
     self.__connectSkt();
+
+    # Switch to no-ack mode, if selected, so that packets may be pipelined
+    self.__noAck           = noAck and self.__sendmsg('QStartNoAckMode', self.__skt).find('$OK#') >= 0
     self.__scriptExec()
     self.__disconnectSkt()
 
@@ -210,6 +256,10 @@ class client_batch :
       # Command line options added here
       parser.add_argument('-p', '--portnum', dest='portNum', default='49152', action='store',
                           help='Set a TCP/IP port number')
+      parser.add_argument('-u', '--unix', dest='unixPath', default=None, action='store',
+                          help='Connect to a Unix domain socket path instead of TCP/IP')
+      parser.add_argument('-N', '--noack', dest='noAck', default=False, action='store_true',
+                          help='Negotiate no-ack mode, and pipeline the script\'s packets')
       parser.add_argument('-s', '--script', dest='script', default='sktscript.txt', action='store',
                           help='Specify a script to run in batch mode')
       parser.add_argument('-w', '--wait', dest='wait', default='1', action='store',
@@ -228,4 +278,4 @@ if __name__ == '__main__' :
   cmdArgs = client.processCmdLine()
 
   time.sleep(int(cmdArgs.wait))
-  client.runBatch(cmdArgs.portNum, cmdArgs.script)
+  client.runBatch(cmdArgs.portNum, cmdArgs.script, cmdArgs.unixPath, cmdArgs.noAck)
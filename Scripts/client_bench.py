@@ -0,0 +1,269 @@
+# =========================================================================
+#
+#  File Name:         client_bench.py
+#  Design Unit Name:
+#  Revision:          OSVVM MODELS STANDARD VERSION
+#
+#  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+#  Contributor(s):
+#     Simon Southwell      simon.southwell@gmail.com
+#
+#
+#  Description:
+#      Client throughput benchmark for OSVVM TCP/IP socket features.
+#      Sends a number of memory write and/or read packets, optionally
+#      with several packets in flight, and reports the packet and byte
+#      rates achieved. The gdb remote serial format is used, unless
+#      the binary protocol is selected, which is negotiated on connection.
+#      No-ack mode (QStartNoAckMode) may also be negotiated, so that
+#      batched packets are pipelined with coalesced responses. A Unix
+#      domain socket may be used in place of TCP/IP.
+#
+#  Revision History:
+#    Date      Version    Description
+#    10/2026   2026.10    Initial revision
+#
+#
+#  This file is part of OSVVM.
+#
+#  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#      https://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+# =========================================================================
+
+import argparse
+import time
+import socket
+import struct
+
+class client_bench :
+
+  # Binary protocol header (magic, op, width, prot/status, tag, addr, length, param) and operations,
+  # hard-coded from BIN_MAGIC, BIN_HDR_SIZE and BinOpType in code/OsvvmCosimSktHdr.h, which must
+  # be kept in step
+  BIN_HDR            = struct.Struct('<BBBBIQII')
+  BIN_MAGIC          = 0xb5
+  BIN_OP_WRITE       = 1
+  BIN_OP_READ        = 2
+  BIN_OP_DETACH      = 15
+
+  # -----------------------------------------------------------------
+  # __init__
+  #
+  # Constructor for client_bench class
+  #
+  def __init__(self, hostName, portNum, binary=False, unixPath=None, noAck=False) :
+
+    self.__hostName          = hostName
+    self.__portNumber        = portNum
+    self.__binary            = binary
+    self.__noAck             = noAck
+    self.__unixPath          = unixPath
+    self.__rxbuf             = b''
+
+  # -----------------------------------------------------------------
+  # __chksum()
+  #
+  # Method to calculate a byte checksum over a string and return
+  # an ASCII HEX byte value string
+  #
+  @staticmethod
+  def __chksum(msg) :
+
+    return '%02x' % (sum(msg.encode()) % 256)
+
+  # -----------------------------------------------------------------
+  # __pkt()
+  #
+  # Method to wrap a command in a gdb remote protocol packet
+  #
+  def __pkt(self, cmd) :
+
+    return '$' + cmd + '#' + self.__chksum(cmd)
+
+  # -----------------------------------------------------------------
+  # __binpkt()
+  #
+  # Method to construct a binary protocol packet
+  #
+  def __binpkt(self, op, width=0, addr=0, payload=b'', tag=0) :
+
+    return self.BIN_HDR.pack(self.BIN_MAGIC, op, width, 0, tag, addr, len(payload), 0) + payload
+
+  # -----------------------------------------------------------------
+  # __getresponses()
+  #
+  # Method to retrieve a number of response packets from the socket,
+  # returning the number of bytes received
+  #
+  def __getresponses(self, count) :
+
+    rxbytes = 0
+
+    while count and self.__binary :
+      hdrlen = self.BIN_HDR.size
+
+      # Wait for more data if no complete header and payload buffered
+      if len(self.__rxbuf) < hdrlen or len(self.__rxbuf) < hdrlen + self.BIN_HDR.unpack_from(self.__rxbuf)[6] :
+        data = self.__skt.recv(65536)
+
+        if not data :
+          raise ConnectionError('connection closed by server')
+
+        self.__rxbuf += data
+        continue
+
+      pktlen        = hdrlen + self.BIN_HDR.unpack_from(self.__rxbuf)[6]
+      rxbytes      += pktlen
+      self.__rxbuf  = self.__rxbuf[pktlen:]
+      count        -= 1
+
+    while count :
+      eop = self.__rxbuf.find(b'#')
+
+      # Wait for more data if no complete packet (EOP and two checksum characters) buffered
+      if eop < 0 or len(self.__rxbuf) < eop + 3 :
+        data = self.__skt.recv(65536)
+
+        if not data :
+          raise ConnectionError('connection closed by server')
+
+        self.__rxbuf += data
+        continue
+
+      rxbytes      += eop + 3
+      self.__rxbuf  = self.__rxbuf[eop+3:]
+      count        -= 1
+
+    return rxbytes
+
+  # -----------------------------------------------------------------
+  # run()
+  #
+  # Send numPkts packets of the given type ('write', 'read' or 'mixed'),
+  # with up to batch packets sent before waiting for their responses,
+  # and return the elapsed time, and bytes sent and received
+  #
+  def run(self, numPkts, pktType, batch) :
+
+    if self.__unixPath :
+      self.__skt = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+      self.__skt.connect(self.__unixPath)
+    else :
+      self.__skt = socket.create_connection((self.__hostName, int(self.__portNumber)))
+      self.__skt.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+    # Switch to no-ack mode, and/or the binary protocol, if selected, before any timing
+    binary        = self.__binary
+    self.__binary = False
+
+    if self.__noAck :
+      self.__skt.sendall(self.__pkt('QStartNoAckMode').encode())
+      self.__getresponses(1)
+
+    if binary :
+      self.__skt.sendall(self.__pkt('QOsvvmBinary').encode())
+      self.__getresponses(1)
+
+    self.__binary = binary
+
+    txbytes = 0
+    rxbytes = 0
+    sent    = 0
+    start   = time.perf_counter()
+
+    while sent < numPkts :
+      pkts = []
+
+      for idx in range(sent, min(sent + batch, numPkts)) :
+        addr = (idx * 4) & 0xfffc
+
+        if self.__binary :
+          if pktType == 'read' or (pktType == 'mixed' and idx & 1) :
+            pkts.append(self.__binpkt(self.BIN_OP_READ, 4, addr, tag=idx))
+          else :
+            pkts.append(self.__binpkt(self.BIN_OP_WRITE, 4, addr, struct.pack('<I', idx & 0xffffffff), tag=idx))
+        elif pktType == 'read' or (pktType == 'mixed' and idx & 1) :
+          pkts.append(self.__pkt('m%08x,4' % addr).encode())
+        else :
+          pkts.append(self.__pkt('M%08x,4:%08x' % (addr, idx & 0xffffffff)).encode())
+
+      msg      = b''.join(pkts)
+      self.__skt.sendall(msg)
+
+      txbytes += len(msg)
+      rxbytes += self.__getresponses(len(pkts))
+      sent    += len(pkts)
+
+    elapsed = time.perf_counter() - start
+
+    # Detach from the server
+    if self.__binary :
+      self.__skt.sendall(self.__binpkt(self.BIN_OP_DETACH))
+    else :
+      self.__skt.sendall(self.__pkt('D').encode())
+    self.__getresponses(1)
+    self.__skt.close()
+
+    return elapsed, txbytes, rxbytes
+
+  # --------------------------------------------------------------
+  # Parse the command line arguments specific to the benchmark
+  #
+  @staticmethod
+  def processCmdLine() :
+
+      # Create a parser object
+      parser = argparse.ArgumentParser(description='Process command line options.')
+
+      # Command line options added here
+      parser.add_argument('-H', '--host', dest='host', default='localhost', action='store',
+                          help='Set the server host name or address')
+      parser.add_argument('-p', '--portnum', dest='portNum', default='49152', action='store',
+                          help='Set a TCP/IP port number')
+      parser.add_argument('-u', '--unix', dest='unixPath', default=None, action='store',
+                          help='Connect to a Unix domain socket path instead of TCP/IP')
+      parser.add_argument('-n', '--numpkts', dest='numPkts', default='10000', action='store',
+                          help='Number of packets to send')
+      parser.add_argument('-t', '--type', dest='pktType', default='mixed', choices=['write', 'read', 'mixed'],
+                          help='Type of packets to send')
+      parser.add_argument('-b', '--batch', dest='batch', default='1', action='store',
+                          help='Number of packets sent before waiting for responses')
+      parser.add_argument('-B', '--binary', dest='binary', default=False, action='store_true',
+                          help='Negotiate and use the binary protocol')
+      parser.add_argument('-N', '--noack', dest='noAck', default=False, action='store_true',
+                          help='Negotiate no-ack mode, for pipelined packets')
+      parser.add_argument('-w', '--wait', dest='wait', default='1', action='store',
+                          help='Specify wait period (secs) before running benchmark')
+
+      return parser.parse_args()
+
+# ###############################################################
+# Only run if not imported
+#
+if __name__ == '__main__' :
+
+  # Process the command line options
+  cmdArgs = client_bench.processCmdLine()
+
+  time.sleep(int(cmdArgs.wait))
+
+  client = client_bench(cmdArgs.host, cmdArgs.portNum, cmdArgs.binary, cmdArgs.unixPath, cmdArgs.noAck)
+
+  numPkts = int(cmdArgs.numPkts)
+  elapsed, txbytes, rxbytes = client.run(numPkts, cmdArgs.pktType, int(cmdArgs.batch))
+
+  print('%d %s%s%s packets (batch %s) in %.3f secs: %.0f packets/s, %.2f MB/s sent, %.2f MB/s received' %
+        (numPkts, 'no-ack ' if cmdArgs.noAck else '', 'binary ' if cmdArgs.binary else '', cmdArgs.pktType, cmdArgs.batch, elapsed, numPkts / elapsed,
+         txbytes / elapsed / 1e6, rxbytes / elapsed / 1e6))
@@ -0,0 +1,350 @@
+# =========================================================================
+#
+#  File Name:         osvvm_cosim_client.py
+#  Design Unit Name:
+#  Revision:          OSVVM MODELS STANDARD VERSION
+#
+#  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+#  Contributor(s):
+#     Simon Southwell      simon.southwell@gmail.com
+#
+#
+#  Description:
+#      Thin Python binding for the native C++ co-simulation client
+#      library (OsvvmCosimSktClient), built with 'make client', giving
+#      synchronous, asynchronous and batched reads, writes, bursts and
+#      read checks, over TCP/IP, a Unix domain socket or shared memory,
+#      using the binary protocol with pipelined requests, and interrupt
+#      notifications. When run, a short read back test and throughput
+#      measurement is made.
+#
+#  Revision History:
+#    Date      Version    Description
+#    10/2026   2026.10    Initial revision
+#
+#
+#  This file is part of OSVVM.
+#
+#  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#      https://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+# =========================================================================
+
+import argparse
+import ctypes
+import os
+import sys
+import time
+
+class osvvm_cosim_client :
+
+  # Transports, hard-coded from osvvm_cosim_transport_t in
+  # code/OsvvmCosimSktHdr.h, which must be kept in step
+  TCP                = 0
+  UNIX               = 1
+  SHM                = 2
+
+  OSVVM_COSIM_OK     = 0
+
+  # Interrupt callback type (vector, handle)
+  INT_CB_TYPE        = ctypes.CFUNCTYPE(None, ctypes.c_int, ctypes.c_void_p)
+
+  # -----------------------------------------------------------------
+  # __init__
+  #
+  # Constructor for osvvm_cosim_client class. The client library is
+  # loaded from libPath, else the OSVVM_COSIM_CLIENT_LIB environment
+  # variable, else the current directory, and a connection made. The
+  # name is the host for TCP/IP, or the socket path or shared memory
+  # name, derived from the port number if not given.
+  #
+  def __init__(self, portNum=49152, transport=TCP, name=None, libPath=None) :
+
+    if libPath is None :
+      libPath = os.environ.get('OSVVM_COSIM_CLIENT_LIB',
+                               os.path.join(os.getcwd(), 'libOsvvmCosimClient.' + ('dll' if sys.platform == 'win32' else 'so')))
+
+    self.__lib     = ctypes.CDLL(libPath)
+    self.__pending = {}
+    self.__int_cb  = None
+
+    hdl    = ctypes.c_void_p
+    u64    = ctypes.c_uint64
+    pu64   = ctypes.POINTER(ctypes.c_uint64)
+    buf    = ctypes.c_char_p
+    i      = ctypes.c_int
+
+    self.__lib.OsvvmCosimClientOpen.restype   = hdl
+    self.__lib.OsvvmCosimClientOpen.argtypes  = [i, i, buf]
+
+    for fn, args in (('Close',               [hdl]),
+                     ('Detach',              [hdl]),
+                     ('Write',               [hdl, u64, u64,  i, i]),
+                     ('Read',                [hdl, u64, pu64, i, i]),
+                     ('ReadCheck',           [hdl, u64, u64,  i, i]),
+                     ('BurstWrite',          [hdl, u64, buf,  i, i]),
+                     ('BurstRead',           [hdl, u64, buf,  i, i]),
+                     ('BurstReadCheck',      [hdl, u64, buf,  i, i]),
+                     ('WriteAsync',          [hdl, u64, u64,  i, i]),
+                     ('ReadAsync',           [hdl, u64, pu64, i, i]),
+                     ('ReadCheckAsync',      [hdl, u64, u64,  i, i]),
+                     ('BurstWriteAsync',     [hdl, u64, buf,  i, i]),
+                     ('BurstReadAsync',      [hdl, u64, buf,  i, i]),
+                     ('BurstReadCheckAsync', [hdl, u64, buf,  i, i]),
+                     ('Flush',               [hdl]),
+                     ('Wait',                [hdl, i]),
+                     ('WaitAll',             [hdl]),
+                     ('Transact',            [hdl, buf, buf, i]),
+                     ('SubscribeInterrupts', [hdl, i]),
+                     ('SetInterruptCB',      [hdl, self.INT_CB_TYPE, ctypes.c_void_p]),
+                     ('Interrupt',           [hdl]),
+                     ('Tick',                [hdl, ctypes.c_uint32])) :
+      func          = getattr(self.__lib, 'OsvvmCosimClient' + fn)
+      func.argtypes = args
+      func.restype  = None if fn in ('Close', 'SetInterruptCB') else i
+
+    self.__hdl = self.__lib.OsvvmCosimClientOpen(transport, portNum, name.encode() if name else None)
+
+    if not self.__hdl :
+      raise ConnectionError('failed to connect to simulation')
+
+  # -----------------------------------------------------------------
+  # __check()
+  #
+  # Raise an exception for a bad status or tag, else return it
+  #
+  @staticmethod
+  def __check(status, what) :
+
+    if status < 0 :
+      raise RuntimeError(what + ' failed')
+
+    return status
+
+  # -----------------------------------------------------------------
+  # Synchronous transaction methods
+  #
+  def write(self, addr, data, bytes=4, prot=0) :
+    self.__check(self.__lib.OsvvmCosimClientWrite(self.__hdl, addr, data, bytes, prot), 'write')
+
+  def read(self, addr, bytes=4, prot=0) :
+    data = ctypes.c_uint64(0)
+    self.__check(self.__lib.OsvvmCosimClientRead(self.__hdl, addr, ctypes.byref(data), bytes, prot), 'read')
+    return data.value
+
+  def read_check(self, addr, expected, bytes=4, prot=0) :
+    self.__check(self.__lib.OsvvmCosimClientReadCheck(self.__hdl, addr, expected, bytes, prot), 'read check')
+
+  def burst_write(self, addr, data, prot=0) :
+    self.__check(self.__lib.OsvvmCosimClientBurstWrite(self.__hdl, addr, bytes(data), len(data), prot), 'burst write')
+
+  def burst_read(self, addr, length, prot=0) :
+    data = ctypes.create_string_buffer(length)
+    self.__check(self.__lib.OsvvmCosimClientBurstRead(self.__hdl, addr, data, length, prot), 'burst read')
+    return data.raw
+
+  def burst_read_check(self, addr, expected, prot=0) :
+    self.__check(self.__lib.OsvvmCosimClientBurstReadCheck(self.__hdl, addr, bytes(expected), len(expected), prot), 'burst read check')
+
+  # -----------------------------------------------------------------
+  # Asynchronous transaction methods, returning a tag. Requests are
+  # pipelined, and read data is returned by wait() or wait_all(), with
+  # the read buffers kept until then.
+  #
+  def write_async(self, addr, data, bytes=4, prot=0) :
+    return self.__check(self.__lib.OsvvmCosimClientWriteAsync(self.__hdl, addr, data, bytes, prot), 'write')
+
+  def read_async(self, addr, bytes=4, prot=0) :
+    data = ctypes.c_uint64(0)
+    tag  = self.__check(self.__lib.OsvvmCosimClientReadAsync(self.__hdl, addr, ctypes.byref(data), bytes, prot), 'read')
+    self.__pending[tag] = data
+    return tag
+
+  def read_check_async(self, addr, expected, bytes=4, prot=0) :
+    return self.__check(self.__lib.OsvvmCosimClientReadCheckAsync(self.__hdl, addr, expected, bytes, prot), 'read check')
+
+  def burst_write_async(self, addr, data, prot=0) :
+    return self.__check(self.__lib.OsvvmCosimClientBurstWriteAsync(self.__hdl, addr, bytes(data), len(data), prot), 'burst write')
+
+  def burst_read_async(self, addr, length, prot=0) :
+    data = ctypes.create_string_buffer(length)
+    tag  = self.__check(self.__lib.OsvvmCosimClientBurstReadAsync(self.__hdl, addr, data, length, prot), 'burst read')
+    self.__pending[tag] = data
+    return tag
+
+  def burst_read_check_async(self, addr, expected, prot=0) :
+    return self.__check(self.__lib.OsvvmCosimClientBurstReadCheckAsync(self.__hdl, addr, bytes(expected), len(expected), prot), 'burst read check')
+
+  # -----------------------------------------------------------------
+  # __result()
+  #
+  # Return, and release, the read data for a completed request
+  #
+  def __result(self, tag) :
+
+    data = self.__pending.pop(tag, None)
+
+    if data is None :
+      return None
+
+    return data.value if isinstance(data, ctypes.c_uint64) else data.raw
+
+  # -----------------------------------------------------------------
+  # flush()
+  #
+  # Send all buffered requests
+  #
+  def flush(self) :
+    self.__check(self.__lib.OsvvmCosimClientFlush(self.__hdl), 'flush')
+
+  # -----------------------------------------------------------------
+  # wait()
+  #
+  # Wait for a request, and all those before it, to complete, returning
+  # its read data, if any
+  #
+  def wait(self, tag) :
+    self.__check(self.__lib.OsvvmCosimClientWait(self.__hdl, tag), 'wait')
+    return self.__result(tag)
+
+  # -----------------------------------------------------------------
+  # wait_all()
+  #
+  # Wait for all requests to complete, returning a dictionary of the
+  # read data, by tag, of those not already waited for
+  #
+  def wait_all(self) :
+    self.__check(self.__lib.OsvvmCosimClientWaitAll(self.__hdl), 'wait')
+    return {tag : self.__result(tag) for tag in list(self.__pending)}
+
+  # -----------------------------------------------------------------
+  # transact()
+  #
+  # Send a gdb remote serial protocol command (before any transaction
+  # methods are used), returning the response
+  #
+  def transact(self, cmd) :
+    resp = ctypes.create_string_buffer(4096)
+    self.__check(self.__lib.OsvvmCosimClientTransact(self.__hdl, cmd.encode(), resp, len(resp)), 'transact')
+    return resp.value.decode()
+
+  # -----------------------------------------------------------------
+  # subscribe_interrupts()
+  #
+  # Subscribe to (or unsubscribe from) the node's interrupt vector
+  # changes, calling func, if given, with each new vector, as they are
+  # received with responses
+  #
+  def subscribe_interrupts(self, func=None, enable=True) :
+
+    if func is not None :
+      # Keep a reference to the callback whilst registered
+      self.__int_cb = self.INT_CB_TYPE(lambda vec, hdl : func(vec))
+      self.__lib.OsvvmCosimClientSetInterruptCB(self.__hdl, self.__int_cb, None)
+
+    self.__check(self.__lib.OsvvmCosimClientSubscribeInterrupts(self.__hdl, 1 if enable else 0), 'subscribe')
+
+  # -----------------------------------------------------------------
+  # interrupt()
+  #
+  # Return the last notified interrupt vector
+  #
+  def interrupt(self) :
+    return self.__lib.OsvvmCosimClientInterrupt(self.__hdl)
+
+  # -----------------------------------------------------------------
+  # tick()
+  #
+  # Advance the simulation by a number of clock cycles, with no
+  # transaction, receiving any interrupt notifications in that time
+  #
+  def tick(self, ticks) :
+    self.__check(self.__lib.OsvvmCosimClientTick(self.__hdl, ticks), 'tick')
+
+  # -----------------------------------------------------------------
+  # close()
+  #
+  # Detach from the simulation and close the connection
+  #
+  def close(self) :
+
+    if self.__hdl :
+      self.__lib.OsvvmCosimClientDetach(self.__hdl)
+      self.__lib.OsvvmCosimClientClose(self.__hdl)
+      self.__hdl = None
+
+  def __enter__(self) :
+    return self
+
+  def __exit__(self, *args) :
+    self.close()
+
+  # --------------------------------------------------------------
+  # Parse the command line arguments
+  #
+  @staticmethod
+  def processCmdLine() :
+
+      # Create a parser object
+      parser = argparse.ArgumentParser(description='Process command line options.')
+
+      # Command line options added here
+      parser.add_argument('-p', '--portnum', dest='portNum', default='49152', action='store',
+                          help='Set a TCP/IP port number')
+      parser.add_argument('-t', '--transport', dest='transport', default='tcp', choices=['tcp', 'unix', 'shm'],
+                          help='Select the transport')
+      parser.add_argument('-H', '--host', dest='name', default=None, action='store',
+                          help='Set the host name, socket path or shared memory name')
+      parser.add_argument('-l', '--lib', dest='libPath', default=None, action='store',
+                          help='Set the path of the client library')
+      parser.add_argument('-n', '--numpkts', dest='numPkts', default='10000', action='store',
+                          help='Number of writes and reads for the throughput measurement')
+
+      return parser.parse_args()
+
+# ###############################################################
+# Only run if not imported
+#
+if __name__ == '__main__' :
+
+  # Process the command line options
+  cmdArgs   = osvvm_cosim_client.processCmdLine()
+  transport = {'tcp' : osvvm_cosim_client.TCP, 'unix' : osvvm_cosim_client.UNIX, 'shm' : osvvm_cosim_client.SHM}[cmdArgs.transport]
+  numPkts   = int(cmdArgs.numPkts)
+
+  with osvvm_cosim_client(int(cmdArgs.portNum), transport, cmdArgs.name, cmdArgs.libPath) as client :
+
+    # Synchronous word and burst read back
+    client.write(0x1000, 0x900df00d)
+    client.burst_write(0x2000, bytes(range(100)))
+
+    if client.read(0x1000) != 0x900df00d or client.burst_read(0x2000, 100) != bytes(range(100)) :
+      raise RuntimeError('read back mismatch')
+
+    # Batched asynchronous writes and reads
+    start = time.perf_counter()
+
+    for idx in range(numPkts) :
+      client.write_async((idx * 4) & 0xfffc, idx)
+
+    tags  = [client.read_async((idx * 4) & 0xfffc) for idx in range(numPkts)]
+    data  = client.wait_all()
+
+    elapsed = time.perf_counter() - start
+
+    # Only the last write to each (wrapping) address is read back
+    if any(data[tag] != idx for idx, tag in enumerate(tags) if idx >= numPkts - 0x4000) :
+      raise RuntimeError('batched read back mismatch')
+
+    print('%d batched writes and reads in %.3f secs: %.0f transactions/s' % (numPkts, elapsed, 2 * numPkts / elapsed))
@@ -15,6 +15,8 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Adding transaction hook and interrupt tap
+//                         registration, and local burst checking
 //    05/2023   2023.05    Adding asynchronous transaction support
 //    03/2023   2023.04    Adding basic stream support
 //    01/2023   2023.01    Initial revision
@@ -207,6 +209,10 @@ public:
       void     transBurstReadCheckData       (const uint32_t addr, uint8_t *expdata, const int bytesize, const int prot = 0) {VTransBurstCommon(READ_BURST, BURST_DATA_CHECK, addr, expdata, bytesize, prot, node);}
       void     transBurstReadCheckData       (const uint64_t addr, uint8_t *expdata, const int bytesize, const int prot = 0) {VTransBurstCommon(READ_BURST, BURST_DATA_CHECK, addr, expdata, bytesize, prot, node);}
 
+      void     transSetLocalBurstCheck       (const bool enable = true)                                                      {VTransSetLocalBurstCheck(enable, node);}
+      int      transGetBurstCheckResult      (int* first = NULL)                                                             {return VTransGetBurstCheckResult(first, node);}
+      void     affirm                        (const bool pass, const std::string msg)                                        {VAffirm(pass, msg.c_str(), node);}
+
       void     transWaitForTransaction       (void)                                                                          {VTransTransactionWait(WAIT_FOR_TRANSACTION, node);}
       void     transWaitForWriteTransaction  (void)                                                                          {VTransTransactionWait(WAIT_FOR_WRITE_TRANSACTION, node);}
       void     transWaitForReadTransaction   (void)                                                                          {VTransTransactionWait(WAIT_FOR_READ_TRANSACTION, node);}
@@ -215,6 +221,8 @@ public:
       int      transGetReadTransactionCount  (void)                                                                          {return VTransGetCount(GET_READ_TRANSACTION_COUNT, node);}
 
       void     regInterruptCB                (pVUserInt_t func)                                                              {VRegInterrupt(func, node);}
+      void     regInterruptTap               (pVUserIntTap_t func, void* hdl = NULL)                                         {VRegInterruptTap(func, hdl, node);}
+      void     regTransHook                  (pVUserTransHook_t func, void* hdl = NULL)                                      {VRegTransHook(func, hdl, node);}
 
       void     waitForSim                    (void)                                                                          {VWaitForSim(node);}
 
@@ -0,0 +1,242 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimBurstCheck.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Simulator co-simulation C++ class of bulk burst data checking
+//      functions, comparing received bursts against expected data or
+//      an incrementing pattern, sixteen bytes at a time with SSE2 where
+//      available (else eight at a time), returning the number of
+//      mismatched bytes and the index of the first.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined (__SSE2__)
+# include <emmintrin.h>
+#endif
+
+#ifndef __OSVVM_COSIM_BURST_CHECK_H_
+#define __OSVVM_COSIM_BURST_CHECK_H_
+
+class OsvvmCosimBurstCheck
+{
+public:
+
+      // -------------------------------------------------------------------------
+      // checkData()
+      //
+      // Compare len bytes of actual data against expected data, returning
+      // the number of mismatched bytes, with the index of the first in
+      // first (if not NULL), or -1 if none.
+      //
+      // -------------------------------------------------------------------------
+
+      static int checkData (const uint8_t* act, const uint8_t* exp, const int len, int* first = NULL)
+      {
+          int count = 0;
+          int firstidx = -1;
+          int idx   = 0;
+
+          // Nothing to find when the whole burst matches
+          if (len <= 0 || memcmp(act, exp, len) == 0)
+          {
+              if (first != NULL)
+              {
+                  *first = -1;
+              }
+              return 0;
+          }
+
+#if defined (__SSE2__)
+          for (; idx + 16 <= len; idx += 16)
+          {
+              __m128i  a   = _mm_loadu_si128((const __m128i*)&act[idx]);
+              __m128i  e   = _mm_loadu_si128((const __m128i*)&exp[idx]);
+              uint32_t neq = ~_mm_movemask_epi8(_mm_cmpeq_epi8(a, e)) & 0xffff;
+
+              accumulate(neq, idx, count, firstidx);
+          }
+#else
+          for (; idx + 8 <= len; idx += 8)
+          {
+              uint64_t a, e;
+
+              memcpy(&a, &act[idx], 8);
+              memcpy(&e, &exp[idx], 8);
+
+              accumulate(nonZeroBytes(a ^ e), idx, count, firstidx);
+          }
+#endif
+
+          for (; idx < len; idx++)
+          {
+              if (act[idx] != exp[idx])
+              {
+                  firstidx = (firstidx < 0) ? idx : firstidx;
+                  count++;
+              }
+          }
+
+          if (first != NULL)
+          {
+              *first = firstidx;
+          }
+
+          return count;
+      }
+
+      // -------------------------------------------------------------------------
+      // checkIncrement()
+      //
+      // Compare len bytes of actual data against an incrementing byte
+      // pattern, starting at start (as generated for OSVVM's increment
+      // bursts), returning the number of mismatched bytes, with the index
+      // of the first in first (if not NULL), or -1 if none.
+      //
+      // -------------------------------------------------------------------------
+
+      static int checkIncrement (const uint8_t* act, const uint8_t start, const int len, int* first = NULL)
+      {
+          int count = 0;
+          int firstidx = -1;
+          int idx   = 0;
+
+#if defined (__SSE2__)
+          __m128i expv = _mm_add_epi8(_mm_set1_epi8((char)start),
+                                      _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+          __m128i step = _mm_set1_epi8(16);
+
+          for (; idx + 16 <= len; idx += 16)
+          {
+              __m128i  a   = _mm_loadu_si128((const __m128i*)&act[idx]);
+              uint32_t neq = ~_mm_movemask_epi8(_mm_cmpeq_epi8(a, expv)) & 0xffff;
+
+              accumulate(neq, idx, count, firstidx);
+
+              expv = _mm_add_epi8(expv, step);
+          }
+#else
+          // Expected bytes as a word, incremented by 8 in each byte lane without carries between lanes
+          uint64_t expw = 0;
+
+          for (int byte = 0; byte < 8; byte++)
+          {
+              expw |= (uint64_t)(uint8_t)(start + byte) << (8 * byte);
+          }
+
+          for (; idx + 8 <= len; idx += 8)
+          {
+              uint64_t a;
+
+              memcpy(&a, &act[idx], 8);
+
+              accumulate(nonZeroBytes(littleEndian(a) ^ expw), idx, count, firstidx);
+
+              expw = (((expw & 0x7f7f7f7f7f7f7f7fULL) + 0x0808080808080808ULL) ^ (expw & 0x8080808080808080ULL));
+          }
+#endif
+
+          for (; idx < len; idx++)
+          {
+              if (act[idx] != (uint8_t)(start + idx))
+              {
+                  firstidx = (firstidx < 0) ? idx : firstidx;
+                  count++;
+              }
+          }
+
+          if (first != NULL)
+          {
+              *first = firstidx;
+          }
+
+          return count;
+      }
+
+private:
+
+      // Add a mask of mismatched byte lanes, for the bytes starting at idx, to the count and first index
+      static void accumulate (const uint32_t mask, const int idx, int& count, int& firstidx)
+      {
+          if (mask)
+          {
+              if (firstidx < 0)
+              {
+                  firstidx = idx + lowestBit(mask);
+              }
+              count += popCount(mask);
+          }
+      }
+
+#if !defined (__SSE2__)
+      // Mask of the non-zero bytes of a word, with byte lane n at bit n
+      static uint32_t nonZeroBytes (const uint64_t val)
+      {
+          uint64_t hibits = (((val & 0x7f7f7f7f7f7f7f7fULL) + 0x7f7f7f7f7f7f7f7fULL) | val) & 0x8080808080808080ULL;
+
+          // Gather the top bit of each byte into the bottom eight bits
+          return (uint32_t)(((hibits >> 7) * 0x0102040810204080ULL) >> 56);
+      }
+
+      // Word loaded from memory as if on a little endian host
+      static uint64_t littleEndian (const uint64_t val)
+      {
+          const uint16_t one = 1;
+
+          if (*(const uint8_t*)&one)
+          {
+              return val;
+          }
+
+          uint64_t swapped = 0;
+
+          for (int byte = 0; byte < 8; byte++)
+          {
+              swapped |= ((val >> (8 * byte)) & 0xff) << (8 * (7 - byte));
+          }
+
+          return swapped;
+      }
+#endif
+
+#if defined (__GNUC__)
+      static int lowestBit (const uint32_t val)            {return __builtin_ctz(val);}
+      static int popCount  (const uint32_t val)            {return __builtin_popcount(val);}
+#else
+      static int lowestBit (const uint32_t val)            {int bit = 0; while (!((val >> bit) & 1)) bit++; return bit;}
+      static int popCount  (uint32_t val)                  {int cnt = 0; for (; val; val &= val - 1) cnt++; return cnt;}
+#endif
+};
+
+#endif
@@ -0,0 +1,301 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimBurstGen.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Simulator co-simulation C++ class of burst data pattern generators,
+//      producing the same byte sequences as the simulation's increment
+//      and random burst fills (OSVVM PushBurstIncrement/PushBurstRandom)
+//      for a given first byte, so that user code can predict burst data
+//      without reading it back.
+//
+//      The random sequence is OSVVM's RandomPType seeded from the first
+//      byte, with one value discarded, and the remaining bytes scaled from
+//      successive values of the IEEE math_real UNIFORM combined generator.
+//      The generator's two multiplicative congruential components are
+//      advanced in eight interleaved lanes using jump ahead multipliers,
+//      so that bytes are independent within each step, and the start of
+//      each of the 256 possible sequences is cached.
+//
+//      Only the patterns of the co-simulation's byte wide burst FIFOs are
+//      supported: increment, and random with the default RandomPType
+//      settings (uniform distribution, seeded only from the first byte).
+//      Wider FIFO words, other randomisation distributions, and
+//      coverage driven (CoveragePkg) burst data are not reproduced. The
+//      async_trans test checks both patterns against the simulation's fills.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdint.h>
+#include <string.h>
+#include <mutex>
+
+#if defined (__SSE2__)
+# include <emmintrin.h>
+#endif
+
+#include "OsvvmVProc.h"
+
+#ifndef __OSVVM_COSIM_BURST_GEN_H_
+#define __OSVVM_COSIM_BURST_GEN_H_
+
+class OsvvmCosimBurstGen
+{
+public:
+
+      // -------------------------------------------------------------------------
+      // fillIncrement()
+      //
+      // Fill len bytes of buf with an incrementing byte pattern, starting
+      // at start and wrapping at 256.
+      //
+      // -------------------------------------------------------------------------
+
+      static void fillIncrement (uint8_t* buf, const uint8_t start, const int len)
+      {
+          int idx = 0;
+
+#if defined (__SSE2__)
+          __m128i val  = _mm_add_epi8(_mm_set1_epi8((char)start),
+                                      _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+          __m128i step = _mm_set1_epi8(16);
+
+          for (; idx + 16 <= len; idx += 16)
+          {
+              _mm_storeu_si128((__m128i*)&buf[idx], val);
+              val = _mm_add_epi8(val, step);
+          }
+#endif
+
+          for (; idx < len; idx++)
+          {
+              buf[idx] = (uint8_t)(start + idx);
+          }
+      }
+
+      // -------------------------------------------------------------------------
+      // fillRandom()
+      //
+      // Fill len bytes of buf with the simulation's random burst pattern for
+      // first byte start. The first byte is start itself. As there are only
+      // 256 sequences, the first DATABUF_SIZE bytes of each (the largest
+      // burst) are generated once, on first use, and copied thereafter.
+      //
+      // -------------------------------------------------------------------------
+
+      static void fillRandom (uint8_t* buf, const uint8_t start, const int len)
+      {
+          rand_cache_t& cache = randCache();
+
+          if (len <= 0)
+          {
+              return;
+          }
+
+          std::call_once(cache.once[start], cacheSequence, start);
+
+          int cached = (len < DATABUF_SIZE) ? len : DATABUF_SIZE;
+
+          memcpy(buf, cache.data[start], cached);
+
+          // Generate any bytes beyond the cached length from the cached end state
+          if (len > cached)
+          {
+              generate(&buf[cached], cache.seed1[start], cache.seed2[start], len - cached);
+          }
+      }
+
+      // -------------------------------------------------------------------------
+      // fill()
+      //
+      // Fill len bytes of buf with the pattern for the burst type (as
+      // passed in VPParam), returning false if not an increment or random
+      // type.
+      //
+      // -------------------------------------------------------------------------
+
+      static bool fill (const int bursttype, uint8_t* buf, const uint8_t start, const int len)
+      {
+          switch (bursttype)
+          {
+          case BURST_INCR:
+          case BURST_INCR_PUSH:
+          case BURST_INCR_CHECK:
+              fillIncrement(buf, start, len);
+              return true;
+
+          case BURST_RAND:
+          case BURST_RAND_PUSH:
+          case BURST_RAND_CHECK:
+              fillRandom(buf, start, len);
+              return true;
+
+          default:
+              return false;
+          }
+      }
+
+private:
+
+      // math_real UNIFORM component generator moduli and multipliers
+      static const uint32_t MOD1             = 2147483563U;
+      static const uint32_t MOD2             = 2147483399U;
+      static const uint32_t MULT1            = 40014U;
+      static const uint32_t MULT2            = 40692U;
+
+      // Number of interleaved generator lanes
+      static const int      LANES            = 8;
+
+      // Cached start of each random sequence, with the generator state for its
+      // last byte
+      typedef struct
+      {
+          std::once_flag    once[256];
+          uint8_t           data[256][DATABUF_SIZE];
+          uint32_t          seed1[256];
+          uint32_t          seed2[256];
+      } rand_cache_t;
+
+      static rand_cache_t& randCache (void)
+      {
+          static rand_cache_t cache;
+
+          return cache;
+      }
+
+      // Generate the cached bytes of the sequence for start
+      static void cacheSequence (const uint8_t start)
+      {
+          rand_cache_t& cache = randCache();
+          uint32_t      seed1, seed2;
+
+          initSeed(start, seed1, seed2);
+
+          // The first value after seeding is discarded, and the first byte is start itself
+          seed1 = mulMod(seed1, MULT1, MOD1);
+          seed2 = mulMod(seed2, MULT2, MOD2);
+
+          cache.data[start][0] = start;
+
+          generate(&cache.data[start][1], seed1, seed2, DATABUF_SIZE - 1);
+
+          cache.seed1[start] = mulMod(seed1, powMod(MULT1, DATABUF_SIZE - 1, MOD1), MOD1);
+          cache.seed2[start] = mulMod(seed2, powMod(MULT2, DATABUF_SIZE - 1, MOD2), MOD2);
+      }
+
+      // Generate len bytes from the successive values following the generator
+      // state seed1/seed2, in LANES interleaved lanes, where lane n produces
+      // every LANESth byte from byte n, stepping on by MULTx^LANES
+      static void generate (uint8_t* buf, const uint32_t seed1, const uint32_t seed2, const int len)
+      {
+          uint32_t s1[LANES], s2[LANES];
+          uint32_t jump1 = powMod(MULT1, LANES, MOD1);
+          uint32_t jump2 = powMod(MULT2, LANES, MOD2);
+          int      idx;
+
+          s1[0] = mulMod(seed1, MULT1, MOD1);
+          s2[0] = mulMod(seed2, MULT2, MOD2);
+
+          for (int lane = 1; lane < LANES; lane++)
+          {
+              s1[lane] = mulMod(s1[lane-1], MULT1, MOD1);
+              s2[lane] = mulMod(s2[lane-1], MULT2, MOD2);
+          }
+
+          for (idx = 0; idx + LANES <= len; idx += LANES)
+          {
+              for (int lane = 0; lane < LANES; lane++)
+              {
+                  buf[idx + lane] = toByte(s1[lane], s2[lane]);
+
+                  s1[lane] = mulMod(s1[lane], jump1, MOD1);
+                  s2[lane] = mulMod(s2[lane], jump2, MOD2);
+              }
+          }
+
+          for (int lane = 0; idx < len; idx++, lane++)
+          {
+              buf[idx] = toByte(s1[lane], s2[lane]);
+          }
+      }
+
+      // Multiplier to the power exp, modulo mod
+      static uint32_t powMod (uint32_t mult, int exp, const uint32_t mod)
+      {
+          uint32_t result = 1;
+
+          for (; exp; exp >>= 1)
+          {
+              if (exp & 1)
+              {
+                  result = mulMod(result, mult, mod);
+              }
+              mult = mulMod(mult, mult, mod);
+          }
+
+          return result;
+      }
+
+      // Product of a state and multiplier modulo a modulus of 2^31 - c (c small),
+      // folding the bits above 31 back in as multiples of c
+      static uint32_t mulMod (const uint32_t val, const uint32_t mult, const uint32_t mod)
+      {
+          uint64_t c    = (1ULL << 31) - mod;
+          uint64_t prod = (uint64_t)val * mult;
+
+          prod = (prod & 0x7fffffffULL) + (prod >> 31) * c;
+          prod = (prod & 0x7fffffffULL) + (prod >> 31) * c;
+
+          return (uint32_t)(prod >= mod ? prod - mod : prod);
+      }
+
+      // OSVVM GenRandSeed of an integer, giving the two component seeds
+      static void initSeed (const int ival, uint32_t& seed1, uint32_t& seed2)
+      {
+          seed1 = (uint32_t)(ival % (int)(MOD1 - 1)) + 1;
+          seed2 = (uint32_t)((ival / (int)(MOD1 - 1)) % (int)(MOD2 - 1)) + 1;
+      }
+
+      // math_real UNIFORM value of the component states, scaled to a byte as OSVVM RandInt(0, 255)
+      static uint8_t toByte (const uint32_t seed1, const uint32_t seed2)
+      {
+          int64_t z = (int64_t)seed1 - (int64_t)seed2;
+
+          if (z < 1)
+          {
+              z += (int64_t)(MOD1 - 1);
+          }
+
+          return (uint8_t)(int)((double)z * 4.656613E-10 * 256.0);
+      }
+};
+
+#endif
@@ -0,0 +1,402 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimCoverage.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Simulator co-simulation C++ class for functional coverage of
+//      address bus transactions, as cross bins of address range,
+//      operation and access width. Bins are a flat table of counters,
+//      with a bitmap of those that have reached their goal, updated
+//      from a registered transaction hook.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+#include "OsvvmVUser.h"
+
+#ifndef __OSVVM_COSIM_COVERAGE_H_
+#define __OSVVM_COSIM_COVERAGE_H_
+
+class OsvvmCosimCoverage
+{
+public:
+
+      // Operation bins, and their mask bits for selecting those modelled
+      typedef enum cov_op_e
+      {
+          COV_OP_READ,
+          COV_OP_WRITE,
+          COV_OP_WRITE_AND_READ,
+          COV_OP_READ_BURST,
+          COV_OP_WRITE_BURST,
+          COV_NUM_OPS
+      } cov_op_t;
+
+      static const uint32_t COV_READ            = 1 << COV_OP_READ;
+      static const uint32_t COV_WRITE           = 1 << COV_OP_WRITE;
+      static const uint32_t COV_WRITE_AND_READ  = 1 << COV_OP_WRITE_AND_READ;
+      static const uint32_t COV_READ_BURST      = 1 << COV_OP_READ_BURST;
+      static const uint32_t COV_WRITE_BURST     = 1 << COV_OP_WRITE_BURST;
+      static const uint32_t COV_ALL_OPS         = (1 << COV_NUM_OPS) - 1;
+
+      // Width bins are powers of 2 bytes, from 1 up to the maximum width,
+      // with any size in between counted in the next bin up
+      static const int      default_max_width   = 8;
+
+      // -------------------------------------------------------------------------
+      // Constructor
+      //
+      // Model the selected operations, for access widths of up to maxwidth
+      // bytes, with each cross bin covered once hit goal times. Address bins
+      // must be added before any transactions are sampled.
+      //
+      // -------------------------------------------------------------------------
+
+                OsvvmCosimCoverage (const uint32_t opmask   = COV_ALL_OPS,
+                                    const int      maxwidth = default_max_width,
+                                    const uint32_t goal     = 1) :
+                    ops(opmask & COV_ALL_OPS), num_widths(widthBin(maxwidth) + 1), cov_goal(goal ? goal : 1),
+                    uniform(false), outside(0), ignored(0) {};
+
+      // -------------------------------------------------------------------------
+      // addAddrBins()
+      //
+      // Add num address bins, each of binsize bytes (a power of 2), starting
+      // at base. Replaces any existing address bins and clears all counts.
+      //
+      // -------------------------------------------------------------------------
+
+      bool addAddrBins (const uint64_t base, const uint64_t binsize, const uint32_t num)
+      {
+          if (binsize == 0 || (binsize & (binsize - 1)) || num == 0)
+          {
+              VPrint("***ERROR: OsvvmCosimCoverage::addAddrBins() bin size 0x%llx not a power of 2, or no bins\n", (unsigned long long)binsize);
+              return false;
+          }
+
+          ranges.clear();
+
+          uniform   = true;
+          base_addr = base;
+          bin_shift = 0;
+
+          while ((1ULL << bin_shift) < binsize)
+          {
+              bin_shift++;
+          }
+
+          for (uint32_t idx = 0; idx < num; idx++)
+          {
+              range_t range = {base + idx * binsize, base + idx * binsize + binsize - 1};
+              ranges.push_back(range);
+          }
+
+          resize();
+
+          return true;
+      }
+
+      // -------------------------------------------------------------------------
+      // addAddrRange()
+      //
+      // Add an address bin for the range start to end, inclusive. Ranges
+      // may be of any size, but must not overlap. Clears all counts.
+      //
+      // -------------------------------------------------------------------------
+
+      bool addAddrRange (const uint64_t start, const uint64_t end)
+      {
+          range_t range = {start, end};
+
+          std::vector<range_t>::iterator it = std::upper_bound(ranges.begin(), ranges.end(), start, startCmp);
+
+          if (start > end || (it != ranges.end() && it->start <= end) || (it != ranges.begin() && (it-1)->end >= start))
+          {
+              VPrint("***ERROR: OsvvmCosimCoverage::addAddrRange() bad or overlapping range 0x%llx to 0x%llx\n",
+                     (unsigned long long)start, (unsigned long long)end);
+              return false;
+          }
+
+          uniform = false;
+          ranges.insert(it, range);
+
+          resize();
+
+          return true;
+      }
+
+      // -------------------------------------------------------------------------
+      // sample()
+      //
+      // Count a transaction, given its VProc operation, address and size in
+      // bytes. Operations not modelled, and addresses outside all the bins,
+      // are only counted as ignored or outside.
+      //
+      // -------------------------------------------------------------------------
+
+      void sample (const int op, const uint64_t addr, const int bytes)
+      {
+          int opbin = opBin(op);
+
+          if (opbin < 0 || !((ops >> opbin) & 1))
+          {
+              ignored++;
+              return;
+          }
+
+          int addrbin = addrBin(addr);
+
+          if (addrbin < 0)
+          {
+              outside++;
+              return;
+          }
+
+          int width = widthBin(bytes);
+
+          if (width >= num_widths)
+          {
+              width = num_widths - 1;
+          }
+
+          uint32_t bin = (addrbin * COV_NUM_OPS + opbin) * num_widths + width;
+
+          if (++counts[bin] == cov_goal)
+          {
+              hitmap[bin >> 6] |= 1ULL << (bin & 63);
+              covered++;
+          }
+      }
+
+      // Transaction hook callback, registered with VRegTransHook (or OsvvmCosim::regTransHook)
+      // with the object as the handle
+      static void hookCB (const int op, const uint64_t addr, const int bytes, void* hdl)
+                                                           {((OsvvmCosimCoverage*)hdl)->sample(op, addr, bytes);}
+
+      void     attachNode    (const int node)              {VRegTransHook(hookCB, this, node);}
+      void     detachNode    (const int node)              {VRegTransHook(NULL, NULL, node);}
+
+      // -------------------------------------------------------------------------
+      // Runtime queries
+      // -------------------------------------------------------------------------
+
+      // Number of modelled cross bins, and the number covered
+      uint32_t numBins       (void)                        {return ranges.size() * popCount(ops) * num_widths;}
+      uint32_t numCovered    (void)                        {return covered;}
+      double   coverage      (void)                        {return numBins() ? (100.0 * covered) / numBins() : 0.0;}
+      bool     isCovered     (void)                        {return covered == numBins();}
+
+      uint32_t count         (const int addrbin, const int opbin, const int width)
+                                                           {return counts[(addrbin * COV_NUM_OPS + opbin) * num_widths + width];}
+
+      uint64_t numOutside    (void)                        {return outside;}
+      uint64_t numIgnored    (void)                        {return ignored;}
+
+      // Address range of an address bin, for generating stimulus within it
+      uint64_t addrBinStart  (const int addrbin)           {return ranges[addrbin].start;}
+      uint64_t addrBinEnd    (const int addrbin)           {return ranges[addrbin].end;}
+
+      // Access width, in bytes, of a width bin
+      int      widthBytes    (const int width)             {return 1 << width;}
+
+      // -------------------------------------------------------------------------
+      // nextUncovered()
+      //
+      // Find the first modelled cross bin, at or after the given flat bin
+      // index, not yet covered, returning its address, operation and width
+      // bins, and its flat index, or -1 if none. Pass the returned index
+      // plus 1 to continue the search.
+      //
+      // -------------------------------------------------------------------------
+
+      int nextUncovered (int& addrbin, int& opbin, int& width, const uint32_t from = 0)
+      {
+          uint32_t total = counts.size();
+
+          for (uint32_t bin = from; bin < total; bin++)
+          {
+              // Skip over whole covered bitmap words
+              if ((bin & 63) == 0 && hitmap[bin >> 6] == ~0ULL && bin + 64 <= total)
+              {
+                  bin += 63;
+                  continue;
+              }
+
+              if (!((hitmap[bin >> 6] >> (bin & 63)) & 1))
+              {
+                  width   = bin % num_widths;
+                  opbin   = (bin / num_widths) % COV_NUM_OPS;
+                  addrbin = bin / (num_widths * COV_NUM_OPS);
+
+                  if ((ops >> opbin) & 1)
+                  {
+                      return bin;
+                  }
+              }
+          }
+
+          return -1;
+      }
+
+      // -------------------------------------------------------------------------
+      // dump()
+      //
+      // Write a table of all the modelled cross bins, and their counts, to
+      // the given file (or stdout if NULL), followed by a summary
+      //
+      // -------------------------------------------------------------------------
+
+      void dump (const char* filename = NULL)
+      {
+          static const char* opnames[COV_NUM_OPS] = {"READ", "WRITE", "WRITE_AND_READ", "READ_BURST", "WRITE_BURST"};
+
+          FILE* fp = filename ? fopen(filename, "w") : stdout;
+
+          if (fp == NULL)
+          {
+              VPrint("***ERROR: OsvvmCosimCoverage::dump() failed to open %s\n", filename);
+              return;
+          }
+
+          fprintf(fp, "%-41s %-14s %6s %10s\n", "Address range", "Operation", "Width", "Count");
+
+          for (uint32_t addrbin = 0; addrbin < ranges.size(); addrbin++)
+          {
+              for (int opbin = 0; opbin < COV_NUM_OPS; opbin++)
+              {
+                  if ((ops >> opbin) & 1)
+                  {
+                      for (int width = 0; width < num_widths; width++)
+                      {
+                          uint32_t cnt = count(addrbin, opbin, width);
+
+                          fprintf(fp, "0x%016llx-0x%016llx %-14s %6d %10u%s\n",
+                                  (unsigned long long)ranges[addrbin].start, (unsigned long long)ranges[addrbin].end,
+                                  opnames[opbin], widthBytes(width), cnt, cnt >= cov_goal ? "" : "  <-- not covered");
+                      }
+                  }
+              }
+          }
+
+          fprintf(fp, "\nCoverage %.2f%% (%u of %u bins, goal %u), %llu outside address bins, %llu not modelled\n",
+                  coverage(), numCovered(), numBins(), cov_goal, (unsigned long long)outside, (unsigned long long)ignored);
+
+          if (filename)
+          {
+              fclose(fp);
+          }
+      }
+
+      // Clear all counts, keeping the address bins
+      void clear (void)                                    {resize();}
+
+private:
+
+      typedef struct
+      {
+          uint64_t start;
+          uint64_t end;
+      } range_t;
+
+      static bool startCmp (const uint64_t addr, const range_t& range) {return addr < range.start;}
+
+      static int popCount (uint32_t val)                   {int cnt = 0; for (; val; val &= val - 1) cnt++; return cnt;}
+
+      // Width bin of an access size: 1 byte is bin 0, 2 bytes bin 1, 3 to 4 bytes bin 2, and so on
+      static int widthBin (const int bytes)                {int bin = 0; while ((1 << bin) < bytes && bin < 30) bin++; return bin;}
+
+      // Map a VProc address bus operation to its bin, or -1 if not modelled
+      static int opBin (const int op)
+      {
+          switch (op)
+          {
+          case WRITE_OP:
+          case ASYNC_WRITE:            return COV_OP_WRITE;
+          case READ_OP:
+          case ASYNC_READ:
+          case READ_CHECK:             return COV_OP_READ;
+          case WRITE_AND_READ:
+          case ASYNC_WRITE_AND_READ:   return COV_OP_WRITE_AND_READ;
+          case WRITE_BURST:
+          case ASYNC_WRITE_BURST:      return COV_OP_WRITE_BURST;
+          case READ_BURST:             return COV_OP_READ_BURST;
+          default:                     return -1;
+          }
+      }
+
+      // Address bin of an address, by shifting for uniform bins, else by search
+      int addrBin (const uint64_t addr)
+      {
+          if (uniform)
+          {
+              uint64_t bin = (addr - base_addr) >> bin_shift;
+
+              return (addr >= base_addr && bin < ranges.size()) ? (int)bin : -1;
+          }
+
+          std::vector<range_t>::iterator it = std::upper_bound(ranges.begin(), ranges.end(), addr, startCmp);
+
+          return (it == ranges.begin() || addr > (it-1)->end) ? -1 : (int)(it - ranges.begin()) - 1;
+      }
+
+      void resize (void)
+      {
+          uint32_t total = ranges.size() * COV_NUM_OPS * num_widths;
+
+          counts.assign(total, 0);
+          hitmap.assign((total + 63) / 64, 0);
+
+          covered = 0;
+          outside = 0;
+          ignored = 0;
+      }
+
+      const uint32_t        ops;
+      const int             num_widths;
+      const uint32_t        cov_goal;
+
+      std::vector<range_t>  ranges;
+      bool                  uniform;
+      uint64_t              base_addr;
+      int                   bin_shift;
+
+      std::vector<uint32_t> counts;
+      std::vector<uint64_t> hitmap;
+      uint32_t              covered;
+      uint64_t              outside;
+      uint64_t              ignored;
+};
+
+#endif
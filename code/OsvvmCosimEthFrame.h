@@ -0,0 +1,476 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimEthFrame.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Simulator co-simulation C++ class for constructing and checking
+//      Ethernet frames (MAC, optional VLAN tag and IPv4 headers, padding
+//      and FCS), and sending and receiving them over an OsvvmCosimStream.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdint.h>
+#include <string.h>
+
+#include "OsvvmCosimStream.h"
+
+#ifndef __OSVVM_COSIM_ETH_FRAME_H_
+#define __OSVVM_COSIM_ETH_FRAME_H_
+
+class OsvvmCosimEthFrame
+{
+public:
+
+      // Frame size definitions (without preamble and SFD)
+      static const int ETH_MAC_ADDR_SIZE      = 6;
+      static const int ETH_HDR_SIZE           = 14;
+      static const int ETH_VLAN_TAG_SIZE      = 4;
+      static const int ETH_IPV4_HDR_SIZE      = 20;
+      static const int ETH_FCS_SIZE           = 4;
+      static const int ETH_MIN_FRAME_SIZE     = 64;
+      static const int ETH_MAX_FRAME_SIZE     = 1522;
+
+      static const uint16_t ETH_TYPE_IPV4     = 0x0800;
+      static const uint16_t ETH_TYPE_VLAN     = 0x8100;
+
+      // Frame check status bits returned from checkFrame()
+      static const int ETH_FRAME_OK           = 0x00;
+      static const int ETH_FRAME_BAD_LENGTH   = 0x01;
+      static const int ETH_FRAME_BAD_FCS      = 0x02;
+      static const int ETH_FRAME_BAD_HEADER   = 0x04;
+      static const int ETH_FRAME_BAD_IP_CSUM  = 0x08;
+      static const int ETH_FRAME_BAD_PAYLOAD  = 0x10;
+
+      // Frame header configuration
+      typedef struct
+      {
+          uint8_t  dst_mac[ETH_MAC_ADDR_SIZE];
+          uint8_t  src_mac[ETH_MAC_ADDR_SIZE];
+          bool     vlan;             // Insert an 802.1Q tag when true
+          uint16_t vlan_tci;         // PCP, DEI and VID of the tag
+          bool     ipv4;             // Insert an IPv4 header when true (ethertype then ignored)
+          uint16_t ethertype;        // Ethertype (or length) when not IPv4
+          uint32_t src_ip;
+          uint32_t dst_ip;
+          uint8_t  ip_protocol;
+          uint8_t  ip_ttl;
+          uint16_t ip_id;
+      } eth_frame_cfg_t;
+
+                OsvvmCosimEthFrame (OsvvmCosimStream* strmIn) : strm(strmIn), mismatchIdx(-1), mismatchCount(0) {};
+
+      // -------------------------------------------------------------------------
+      // sendFrame()
+      //
+      // Build a frame from the configuration and payload, and send it as a
+      // single burst, returning the frame length
+      //
+      // -------------------------------------------------------------------------
+
+      int sendFrame (const eth_frame_cfg_t& cfg, const uint8_t* payload, const int len, const int param = 1)
+      {
+          int framelen = buildFrame(framebuf, cfg, payload, len);
+
+          if (framelen > 0)
+          {
+              strm->streamBurstSend(framebuf, framelen, param);
+          }
+
+          return framelen;
+      }
+
+      // -------------------------------------------------------------------------
+      // recvCheckFrame()
+      //
+      // Receive the next frame and check it against the configuration and
+      // expected payload, returning the check status bits. Details of any
+      // payload mismatch are available from getMismatchIndex() and
+      // getMismatchCount().
+      //
+      // -------------------------------------------------------------------------
+
+      int recvCheckFrame (const eth_frame_cfg_t& cfg, const uint8_t* payload, const int len)
+      {
+          int framelen = strm->recvPacket(framebuf, sizeof(framebuf));
+
+          return checkFrame(framebuf, framelen, cfg, payload, len);
+      }
+
+      int      getMismatchIndex (void)                {return mismatchIdx;}
+      int      getMismatchCount (void)                {return mismatchCount;}
+      uint8_t* getFrameBuffer   (void)                {return framebuf;}
+
+      // -------------------------------------------------------------------------
+      // buildFrame()
+      //
+      // Construct a frame in frame (which must hold ETH_MAX_FRAME_SIZE bytes),
+      // padded to the minimum frame size and with FCS appended. Returns the
+      // frame length, or -1 if the payload does not fit.
+      //
+      // -------------------------------------------------------------------------
+
+      static int buildFrame (uint8_t* frame, const eth_frame_cfg_t& cfg, const uint8_t* payload, const int len)
+      {
+          int hdrlen = headerLength(cfg);
+          int idx    = 0;
+
+          if (len < 0 || hdrlen + len + ETH_FCS_SIZE > ETH_MAX_FRAME_SIZE)
+          {
+              VPrint("***ERROR: OsvvmCosimEthFrame::buildFrame() payload of %d bytes does not fit in a frame\n", len);
+              return -1;
+          }
+
+          memcpy(&frame[idx], cfg.dst_mac, ETH_MAC_ADDR_SIZE); idx += ETH_MAC_ADDR_SIZE;
+          memcpy(&frame[idx], cfg.src_mac, ETH_MAC_ADDR_SIZE); idx += ETH_MAC_ADDR_SIZE;
+
+          if (cfg.vlan)
+          {
+              idx = put16(frame, idx, ETH_TYPE_VLAN);
+              idx = put16(frame, idx, cfg.vlan_tci);
+          }
+
+          idx = put16(frame, idx, cfg.ipv4 ? ETH_TYPE_IPV4 : cfg.ethertype);
+
+          if (cfg.ipv4)
+          {
+              int iphdr = idx;
+
+              frame[idx++] = 0x45;                                   // Version 4, 5 word header
+              frame[idx++] = 0x00;                                   // DSCP/ECN
+              idx = put16(frame, idx, ETH_IPV4_HDR_SIZE + len);      // Total length
+              idx = put16(frame, idx, cfg.ip_id);
+              idx = put16(frame, idx, 0x4000);                       // Don't fragment
+              frame[idx++] = cfg.ip_ttl;
+              frame[idx++] = cfg.ip_protocol;
+              idx = put16(frame, idx, 0);                            // Checksum placeholder
+              idx = put32(frame, idx, cfg.src_ip);
+              idx = put32(frame, idx, cfg.dst_ip);
+
+              put16(frame, iphdr + 10, ipChecksum(&frame[iphdr], ETH_IPV4_HDR_SIZE));
+          }
+
+          memcpy(&frame[idx], payload, len); idx += len;
+
+          // Pad to the minimum frame size (less FCS)
+          if (idx < ETH_MIN_FRAME_SIZE - ETH_FCS_SIZE)
+          {
+              memset(&frame[idx], 0, ETH_MIN_FRAME_SIZE - ETH_FCS_SIZE - idx);
+              idx = ETH_MIN_FRAME_SIZE - ETH_FCS_SIZE;
+          }
+
+          // FCS is transmitted least significant byte first
+          uint32_t fcs = crc32(frame, idx);
+
+          for (int bidx = 0; bidx < ETH_FCS_SIZE; bidx++)
+          {
+              frame[idx++] = (fcs >> (8 * bidx)) & 0xff;
+          }
+
+          return idx;
+      }
+
+      // -------------------------------------------------------------------------
+      // checkFrame()
+      //
+      // Check a frame's length, FCS, headers and payload against those
+      // expected, returning ETH_FRAME_OK or a set of status bits
+      //
+      // -------------------------------------------------------------------------
+
+      int checkFrame (const uint8_t* frame, const int framelen, const eth_frame_cfg_t& cfg, const uint8_t* payload, const int len)
+      {
+          uint8_t expframe[ETH_MAX_FRAME_SIZE];
+          int     status = ETH_FRAME_OK;
+          int     hdrlen = headerLength(cfg);
+
+          mismatchIdx   = -1;
+          mismatchCount = 0;
+
+          int explen = buildFrame(expframe, cfg, payload, len);
+
+          if (explen < 0 || framelen != explen)
+          {
+              return ETH_FRAME_BAD_LENGTH;
+          }
+
+          if (!checkFcs(frame, framelen))
+          {
+              status |= ETH_FRAME_BAD_FCS;
+          }
+
+          if (compareBytes(frame, expframe, hdrlen) >= 0)
+          {
+              status |= ETH_FRAME_BAD_HEADER;
+          }
+
+          if (cfg.ipv4 && ipChecksum(&frame[hdrlen - ETH_IPV4_HDR_SIZE], ETH_IPV4_HDR_SIZE) != 0)
+          {
+              status |= ETH_FRAME_BAD_IP_CSUM;
+          }
+
+          mismatchIdx = compareBytes(&frame[hdrlen], payload, len, &mismatchCount);
+
+          if (mismatchIdx >= 0)
+          {
+              status |= ETH_FRAME_BAD_PAYLOAD;
+          }
+
+          return status;
+      }
+
+      // -------------------------------------------------------------------------
+      // checkFcs()
+      //
+      // Return true if the last four bytes of the frame are a valid FCS
+      //
+      // -------------------------------------------------------------------------
+
+      static bool checkFcs (const uint8_t* frame, const int framelen)
+      {
+          if (framelen < ETH_FCS_SIZE)
+          {
+              return false;
+          }
+
+          uint32_t fcs = crc32(frame, framelen - ETH_FCS_SIZE);
+          const uint8_t* p = &frame[framelen - ETH_FCS_SIZE];
+
+          return fcs == ((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+      }
+
+      // -------------------------------------------------------------------------
+      // crc32()
+      //
+      // IEEE 802.3 CRC32 over len bytes, using slice-by-8 tables to process
+      // eight bytes per step (little endian hosts)
+      //
+      // -------------------------------------------------------------------------
+
+      static uint32_t crc32 (const uint8_t* data, int len, uint32_t crc = 0)
+      {
+          const uint32_t (*tbl)[256] = crcTables();
+
+          crc = ~crc;
+
+          while (len >= 8)
+          {
+              uint32_t lo, hi;
+
+              memcpy(&lo, data,     4);
+              memcpy(&hi, data + 4, 4);
+
+              lo ^= crc;
+
+              crc = tbl[7][ lo        & 0xff] ^ tbl[6][(lo >>  8) & 0xff] ^
+                    tbl[5][(lo >> 16) & 0xff] ^ tbl[4][ lo >> 24        ] ^
+                    tbl[3][ hi        & 0xff] ^ tbl[2][(hi >>  8) & 0xff] ^
+                    tbl[1][(hi >> 16) & 0xff] ^ tbl[0][ hi >> 24        ];
+
+              data += 8;
+              len  -= 8;
+          }
+
+          while (len--)
+          {
+              crc = (crc >> 8) ^ tbl[0][(crc ^ *data++) & 0xff];
+          }
+
+          return ~crc;
+      }
+
+      // -------------------------------------------------------------------------
+      // compareBytes()
+      //
+      // Compare len bytes, returning the index of the first mismatch, or -1
+      // if equal. When mismatches is not NULL, the total number of
+      // mismatching bytes is returned in it. Matching data is compared with
+      // memcmp, with a mismatch located eight bytes at a time.
+      //
+      // -------------------------------------------------------------------------
+
+      static int compareBytes (const uint8_t* got, const uint8_t* exp, const int len, int* mismatches = NULL)
+      {
+          int first = -1;
+          int count = 0;
+          int idx   = 0;
+
+          if (mismatches != NULL)
+          {
+              *mismatches = 0;
+          }
+
+          if (len <= 0 || memcmp(got, exp, len) == 0)
+          {
+              return -1;
+          }
+
+          for (; idx + 8 <= len; idx += 8)
+          {
+              uint64_t g, e;
+
+              memcpy(&g, &got[idx], 8);
+              memcpy(&e, &exp[idx], 8);
+
+              uint64_t diff = g ^ e;
+
+              if (diff)
+              {
+                  if (first < 0)
+                  {
+                      first = idx + (__builtin_ctzll(diff) >> 3);
+
+                      if (mismatches == NULL)
+                      {
+                          return first;
+                      }
+                  }
+
+                  for (int bidx = 0; bidx < 8; bidx++)
+                  {
+                      count += ((diff >> (8 * bidx)) & 0xff) ? 1 : 0;
+                  }
+              }
+          }
+
+          for (; idx < len; idx++)
+          {
+              if (got[idx] != exp[idx])
+              {
+                  first = (first < 0) ? idx : first;
+                  count++;
+              }
+          }
+
+          if (mismatches != NULL)
+          {
+              *mismatches = count;
+          }
+
+          return first;
+      }
+
+      // -------------------------------------------------------------------------
+      // ipChecksum()
+      //
+      // Internet ones' complement checksum over len bytes. Returns 0 when
+      // run over a header containing a valid checksum.
+      //
+      // -------------------------------------------------------------------------
+
+      static uint16_t ipChecksum (const uint8_t* data, const int len)
+      {
+          uint32_t sum = 0;
+
+          for (int idx = 0; idx + 1 < len; idx += 2)
+          {
+              sum += ((uint32_t)data[idx] << 8) | data[idx+1];
+          }
+
+          if (len & 1)
+          {
+              sum += (uint32_t)data[len-1] << 8;
+          }
+
+          while (sum >> 16)
+          {
+              sum = (sum & 0xffff) + (sum >> 16);
+          }
+
+          return ~sum & 0xffff;
+      }
+
+      static int headerLength (const eth_frame_cfg_t& cfg)
+      {
+          return ETH_HDR_SIZE + (cfg.vlan ? ETH_VLAN_TAG_SIZE : 0) + (cfg.ipv4 ? ETH_IPV4_HDR_SIZE : 0);
+      }
+
+private:
+
+      static int put16 (uint8_t* buf, const int idx, const uint16_t val)
+      {
+          buf[idx]   = val >> 8;
+          buf[idx+1] = val & 0xff;
+          return idx + 2;
+      }
+
+      static int put32 (uint8_t* buf, const int idx, const uint32_t val)
+      {
+          put16(buf, idx, val >> 16);
+          return put16(buf, idx + 2, val & 0xffff);
+      }
+
+      // -------------------------------------------------------------------------
+      // crcTables()
+      //
+      // Return the slice-by-8 CRC tables, generated on first use
+      //
+      // -------------------------------------------------------------------------
+
+      static const uint32_t (*crcTables(void))[256]
+      {
+          static struct crc_tables_s
+          {
+              uint32_t tbl[8][256];
+
+              crc_tables_s()
+              {
+                  for (uint32_t idx = 0; idx < 256; idx++)
+                  {
+                      uint32_t crc = idx;
+
+                      for (int bit = 0; bit < 8; bit++)
+                      {
+                          crc = (crc >> 1) ^ ((crc & 1) ? 0xedb88320 : 0);
+                      }
+
+                      tbl[0][idx] = crc;
+                  }
+
+                  for (uint32_t idx = 0; idx < 256; idx++)
+                  {
+                      for (int slice = 1; slice < 8; slice++)
+                      {
+                          tbl[slice][idx] = (tbl[slice-1][idx] >> 8) ^ tbl[0][tbl[slice-1][idx] & 0xff];
+                      }
+                  }
+              }
+          } tables;
+
+          return tables.tbl;
+      }
+
+      OsvvmCosimStream* strm;
+      uint8_t           framebuf[DATABUF_SIZE];
+      int               mismatchIdx;
+      int               mismatchCount;
+};
+
+#endif
@@ -0,0 +1,769 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimIssBridge.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Methods for bridging an instruction set simulator's memory access
+//      callback to co-simulation via an address map of host RAM, bus and
+//      MMIO callback regions, with optional caching of bus regions.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <string.h>
+#include <algorithm>
+
+#include "OsvvmCosimIssBridge.h"
+
+// -------------------------------------------------------------------------
+// Constructor
+//
+// Accesses outside of all added regions go to DefaultRoute, either the
+// bus (with default attributes) or, for ISS_ROUTE_NONE, are left to the
+// ISS's own memory.
+//
+// -------------------------------------------------------------------------
+
+OsvvmCosimIssBridge::OsvvmCosimIssBridge (const int NodeNum, const iss_route_t DefaultRoute) :
+    cosim(NodeNum), node(NodeNum), last_region(-1), sktfp(NULL),
+    sync_quantum(0), local_cycles(0), cache_en(false), line_bytes(0), num_lines(0),
+    wc_active(false), wc_addr(0), wc_prot(0), wc_stores(0), wc_flushes(0),
+    num_bus_trans(0), num_syncs(0), num_errors(0)
+{
+    if (DefaultRoute != ISS_ROUTE_NONE && DefaultRoute != ISS_ROUTE_BUS)
+    {
+        VPrint("***ERROR: OsvvmCosimIssBridge: default route must be ISS_ROUTE_NONE or ISS_ROUTE_BUS\n");
+    }
+
+    default_region.start  = 0;
+    default_region.end    = 0xffffffff;
+    default_region.route  = (DefaultRoute == ISS_ROUTE_BUS) ? ISS_ROUTE_BUS : ISS_ROUTE_NONE;
+    default_region.perm   = ISS_PERM_RWX;
+    default_region.cycles = DEFAULT_BUS_CYCLES;
+    default_region.width  = 4;
+    default_region.prot   = 0;
+    default_region.cache  = ISS_CACHE_NONE;
+    default_region.func   = NULL;
+    default_region.hdl    = NULL;
+
+    for (int idx = 0; idx <= ISS_ROUTE_MMIO; idx++)
+    {
+        num_acc[idx] = 0;
+    }
+
+    icache.hits   = icache.misses = 0;
+    dcache.hits   = dcache.misses = 0;
+}
+
+// -------------------------------------------------------------------------
+// AddRamRegion()
+//
+// Map an address range (Start to End, inclusive) to local host RAM,
+// initialised to zero. Accesses in the range never reach the simulation.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimIssBridge::AddRamRegion (const uint32_t Start, const uint32_t End, const int Perm, const int Cycles)
+{
+    region_t region;
+
+    region.start  = Start;
+    region.end    = End;
+    region.route  = ISS_ROUTE_RAM;
+    region.perm   = Perm;
+    region.cycles = Cycles;
+    region.width  = 4;
+    region.prot   = 0;
+    region.cache  = ISS_CACHE_NONE;
+    region.func   = NULL;
+    region.hdl    = NULL;
+
+    return add_region(region);
+}
+
+// -------------------------------------------------------------------------
+// AddBusRegion()
+//
+// Map an address range (Start to End, inclusive) to transactions on the
+// co-simulation bus. Accesses wider than Width bytes (1, 2 or 4) are
+// split into Width sized transactions, and each transaction is issued
+// with the Prot protection attributes, with ISS_PROT_INSTR added for
+// instruction fetches. Once caching is enabled (EnableCache()), the
+// region's accesses are cached as selected by Cache (ISS_CACHE_xxx).
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimIssBridge::AddBusRegion (const uint32_t Start, const uint32_t End, const int Width, const int Prot,
+                                       const int Cache, const int Perm, const int Cycles)
+{
+    region_t region;
+
+    if (Width != 1 && Width != 2 && Width != 4)
+    {
+        VPrint("***ERROR: OsvvmCosimIssBridge::AddBusRegion() bad bus width %d\n", Width);
+        return OSVVM_COSIM_ERR;
+    }
+
+    region.start  = Start;
+    region.end    = End;
+    region.route  = ISS_ROUTE_BUS;
+    region.perm   = Perm;
+    region.cycles = Cycles;
+    region.width  = Width;
+    region.prot   = Prot;
+    region.cache  = Cache;
+    region.func   = NULL;
+    region.hdl    = NULL;
+
+    return add_region(region);
+}
+
+// -------------------------------------------------------------------------
+// AddMmioRegion()
+//
+// Map an address range (Start to End, inclusive) to a user callback,
+// called with the user's handle for each access in the range, and
+// returning the access's cycle count (or a negative value for Cycles).
+// As MMIO accesses are not bus transactions, they are not written to the
+// socket script (SetScriptFile()), and a callback must do its own logging
+// if a record of them is wanted.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimIssBridge::AddMmioRegion (const uint32_t Start, const uint32_t End, pIssMmioCB_t Func, void* Hdl,
+                                        const int Perm, const int Cycles)
+{
+    region_t region;
+
+    if (Func == NULL)
+    {
+        VPrint("***ERROR: OsvvmCosimIssBridge::AddMmioRegion() no callback function\n");
+        return OSVVM_COSIM_ERR;
+    }
+
+    region.start  = Start;
+    region.end    = End;
+    region.route  = ISS_ROUTE_MMIO;
+    region.perm   = Perm;
+    region.cycles = Cycles;
+    region.width  = 4;
+    region.prot   = 0;
+    region.cache  = ISS_CACHE_NONE;
+    region.func   = Func;
+    region.hdl    = Hdl;
+
+    return add_region(region);
+}
+
+// -------------------------------------------------------------------------
+// Access()
+//
+// Route an ISS memory access to the region mapped at its address, with
+// Type an ISS access type (iss_access_t, optionally with
+// ISS_ACCESS_DBG_MASK set). Returns the cycle count for the access, or
+// ISS_MEM_NOT_PROCESSED for accesses left to the ISS. Debug accesses
+// are not subject to the region's permissions. Cache hits and
+// write-combined stores take DEFAULT_CACHE_CYCLES, as local accesses.
+// The ISS's Time is not used.
+//
+// As local RAM accesses and cache hits do not advance the simulation, if
+// a sync quantum is set (SetSyncQuantum()), once the cycles of local
+// accesses since the last bus transaction or MMIO access reach the
+// quantum, the simulation is ticked by that many cycles. This lets the
+// simulation progress (e.g. to raise an interrupt) whilst the ISS runs
+// locally. MMIO accesses, as bus accesses, restart the count.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimIssBridge::Access (const uint32_t Addr, uint32_t &Data, const int Type, const int64_t /*Time*/)
+{
+    int       acc    = Type & ISS_ACCESS_MASK;
+    region_t* region;
+
+    if (acc > ISS_RD_INSTR || (region = find_region(Addr)) == NULL)
+    {
+        num_acc[ISS_ROUTE_NONE]++;
+        return ISS_MEM_NOT_PROCESSED;
+    }
+
+    bool rnw   = acc >= ISS_RD_BYTE;
+    bool instr = acc == ISS_WR_INSTR || acc == ISS_RD_INSTR;
+    int  size  = instr ? 4 : (1 << (acc & 0x3));
+    int  perm  = !rnw ? ISS_PERM_W : instr ? ISS_PERM_X : ISS_PERM_R;
+
+    num_acc[region->route]++;
+
+    if (((uint64_t)Addr + size - 1) > region->end || (!(Type & ISS_ACCESS_DBG_MASK) && !(region->perm & perm)))
+    {
+        VPrint("***ERROR: OsvvmCosimIssBridge::Access() %s of %d bytes at 0x%08x not permitted in region 0x%08x to 0x%08x\n",
+               instr && rnw ? "fetch" : rnw ? "read" : "write", size, Addr, region->start, region->end);
+
+        num_errors++;
+
+        if (rnw)
+        {
+            Data = 0;
+        }
+
+        return region->cycles;
+    }
+
+    switch (region->route)
+    {
+    case ISS_ROUTE_RAM:
+    {
+        uint8_t* mem = &region->mem[Addr - region->start];
+
+        if (rnw)
+        {
+            Data = 0;
+            for (int idx = 0; idx < size; idx++)
+            {
+                Data |= (uint32_t)mem[idx] << (8*idx);
+            }
+        }
+        else
+        {
+            for (int idx = 0; idx < size; idx++)
+            {
+                mem[idx] = (Data >> (8*idx)) & 0xff;
+            }
+        }
+
+        return local_done(region->cycles);
+    }
+
+    case ISS_ROUTE_MMIO:
+    {
+        // Stores ahead of an MMIO access must have reached the bus
+        wc_flush();
+
+        int cycles = region->func(Addr, Data, Type, region->hdl);
+
+        // The callback services the access, as for the bus, so local accesses are counted afresh
+        local_cycles = 0;
+
+        return (cycles < 0) ? region->cycles : cycles;
+    }
+
+    default:
+        switch (cache_access(region, Addr, Data, size, rnw, instr))
+        {
+        case CACHE_LOCAL:
+            return local_done(DEFAULT_CACHE_CYCLES);
+
+        case CACHE_UNCACHED:
+            wc_flush();
+            bus_access(region, Addr, Data, size, rnw, instr);
+            break;
+
+        default:
+            break;
+        }
+
+        local_cycles = 0;
+        break;
+    }
+
+    return region->cycles;
+}
+
+// -------------------------------------------------------------------------
+// EnableCache()
+//
+// Enable caching of bus regions with cache attributes, with direct
+// mapped instruction and data caches of NumLines lines of LineBytes
+// bytes (both powers of 2), and a one line write-combining buffer
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimIssBridge::EnableCache (const int LineBytes, const int NumLines)
+{
+    if (LineBytes < 4 || LineBytes > DATABUF_SIZE || (LineBytes & (LineBytes-1)) || NumLines < 1 || (NumLines & (NumLines-1)))
+    {
+        VPrint("***ERROR: OsvvmCosimIssBridge::EnableCache() bad cache geometry (%d lines of %d bytes)\n", NumLines, LineBytes);
+        return OSVVM_COSIM_ERR;
+    }
+
+    Flush();
+
+    line_bytes = LineBytes;
+    num_lines  = NumLines;
+
+    for (int idx = 0; idx < 2; idx++)
+    {
+        cache_t& cache = idx ? dcache : icache;
+
+        cache.tag.assign(num_lines, 0);
+        cache.valid.assign(num_lines, 0);
+        cache.data.assign(num_lines * line_bytes, 0);
+    }
+
+    wc_data.assign(line_bytes, 0);
+    wc_valid.assign(line_bytes, 0);
+
+    cache_en = true;
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// Flush()
+//
+// Write any stores held in the write-combining buffer to the bus. Called
+// before the simulation is expected to see all the ISS's stores (e.g.
+// at the end of a program).
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimIssBridge::Flush (void)
+{
+    wc_flush();
+}
+
+// -------------------------------------------------------------------------
+// Invalidate()
+//
+// Flush the write-combining buffer and invalidate the caches, for when
+// cached memory has been changed from the simulation side
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimIssBridge::Invalidate (void)
+{
+    wc_flush();
+
+    icache.valid.assign(icache.valid.size(), 0);
+    dcache.valid.assign(dcache.valid.size(), 0);
+}
+
+// -------------------------------------------------------------------------
+// PrintStats()
+//
+// Print the number of accesses to each type of region and, if caching
+// is enabled, the cache hits and misses and write-combining counts
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimIssBridge::PrintStats (void)
+{
+    VPrint("OsvvmCosimIssBridge (node %d): %llu RAM, %llu bus (%llu transactions), %llu MMIO, %llu unmapped accesses, %llu syncs, %u errors\n",
+           node,
+           (unsigned long long)num_acc[ISS_ROUTE_RAM],
+           (unsigned long long)num_acc[ISS_ROUTE_BUS],
+           (unsigned long long)num_bus_trans,
+           (unsigned long long)num_acc[ISS_ROUTE_MMIO],
+           (unsigned long long)num_acc[ISS_ROUTE_NONE],
+           (unsigned long long)num_syncs,
+           num_errors);
+
+    if (cache_en)
+    {
+        VPrint("OsvvmCosimIssBridge (node %d): I-cache %llu hits, %llu misses, D-cache %llu hits, %llu misses, %llu stores combined in %llu flushes\n",
+               node,
+               (unsigned long long)icache.hits,
+               (unsigned long long)icache.misses,
+               (unsigned long long)dcache.hits,
+               (unsigned long long)dcache.misses,
+               (unsigned long long)wc_stores,
+               (unsigned long long)wc_flushes);
+    }
+}
+
+// -------------------------------------------------------------------------
+// add_region()
+//
+// Insert a region into the address map, kept sorted on start address.
+// Overlapping regions are rejected.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimIssBridge::add_region (region_t &region)
+{
+    if (region.start > region.end)
+    {
+        VPrint("***ERROR: OsvvmCosimIssBridge: bad region 0x%08x to 0x%08x\n", region.start, region.end);
+        return OSVVM_COSIM_ERR;
+    }
+
+    std::vector<region_t>::iterator it = std::upper_bound(regions.begin(), regions.end(), region.start, startCmp);
+
+    if ((it != regions.end() && it->start <= region.end) || (it != regions.begin() && (it-1)->end >= region.start))
+    {
+        VPrint("***ERROR: OsvvmCosimIssBridge: region 0x%08x to 0x%08x overlaps an existing region\n",
+               region.start, region.end);
+        return OSVVM_COSIM_ERR;
+    }
+
+    it = regions.insert(it, region);
+
+    if (it->route == ISS_ROUTE_RAM)
+    {
+        it->mem.resize((uint64_t)it->end - it->start + 1, 0);
+    }
+
+    // Region indexes may have moved
+    last_region = -1;
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// find_region()
+//
+// Return the region mapped at an address, checking the last region
+// accessed before searching the map, or the default region (NULL if
+// accesses are left to the ISS)
+//
+// -------------------------------------------------------------------------
+
+OsvvmCosimIssBridge::region_t* OsvvmCosimIssBridge::find_region (const uint32_t addr)
+{
+    if (last_region >= 0 && addr >= regions[last_region].start && addr <= regions[last_region].end)
+    {
+        return &regions[last_region];
+    }
+
+    std::vector<region_t>::iterator it = std::upper_bound(regions.begin(), regions.end(), addr, startCmp);
+
+    if (it == regions.begin() || addr > (--it)->end)
+    {
+        return (default_region.route == ISS_ROUTE_BUS) ? &default_region : NULL;
+    }
+
+    last_region = it - regions.begin();
+
+    return &*it;
+}
+
+// -------------------------------------------------------------------------
+// bus_access()
+//
+// Issue an access as one or more bus transactions of the region's width
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimIssBridge::bus_access (const region_t* region, const uint32_t addr, uint32_t &data,
+                                      const int size, const bool rnw, const bool instr)
+{
+    int      width = (size < region->width) ? size : region->width;
+    int      prot  = region->prot | ((instr && rnw) ? ISS_PROT_INSTR : 0);
+    uint32_t rdata = 0;
+
+    for (int offset = 0; offset < size; offset += width)
+    {
+        uint32_t wdata = data >> (8*offset);
+        uint8_t  rdata8;
+        uint16_t rdata16;
+        uint32_t rdata32 = 0;
+
+        switch (width)
+        {
+        case 1:
+            if (rnw) { cosim.transRead(addr + offset, &rdata8, prot);  rdata32 = rdata8; }
+            else       cosim.transWrite(addr + offset, (uint8_t)wdata, prot);
+            break;
+        case 2:
+            if (rnw) { cosim.transRead(addr + offset, &rdata16, prot); rdata32 = rdata16; }
+            else       cosim.transWrite(addr + offset, (uint16_t)wdata, prot);
+            break;
+        default:
+            if (rnw)   cosim.transRead(addr + offset, &rdata32, prot);
+            else       cosim.transWrite(addr + offset, (uint32_t)wdata, prot);
+            break;
+        }
+
+        if (rnw)
+        {
+            rdata |= rdata32 << (8*offset);
+        }
+
+        uint32_t logdata = rnw ? rdata32 : wdata;
+        uint8_t  logbytes[4] = {(uint8_t)logdata, (uint8_t)(logdata >> 8), (uint8_t)(logdata >> 16), (uint8_t)(logdata >> 24)};
+
+        num_bus_trans++;
+
+        log_bus_trans(addr + offset, logbytes, width, rnw);
+    }
+
+    if (rnw)
+    {
+        data = rdata;
+    }
+}
+
+// -------------------------------------------------------------------------
+// cache_access()
+//
+// Access a bus region via the caches, if enabled for the region and
+// access type and the access is within a line in the region. Fetch and
+// load misses fill the line with a burst read, flushing the
+// write-combining buffer first if it holds stores to the line. Stores
+// keep any cached copies of the line coherent and, when write-combined,
+// are merged into the write-combining buffer, which is flushed first if
+// holding another line.
+//
+// -------------------------------------------------------------------------
+
+OsvvmCosimIssBridge::cache_result_t OsvvmCosimIssBridge::cache_access (const region_t* region, const uint32_t addr, uint32_t &data,
+                                                                       const int size, const bool rnw, const bool instr)
+{
+    if (!cache_en || !(region->cache & ISS_CACHE_ALL))
+    {
+        return CACHE_UNCACHED;
+    }
+
+    uint32_t line   = addr & ~(uint32_t)(line_bytes-1);
+    int      offset = addr - line;
+
+    if (offset + size > line_bytes || line < region->start || ((uint64_t)line + line_bytes - 1) > region->end)
+    {
+        return CACHE_UNCACHED;
+    }
+
+    if (rnw)
+    {
+        if (!(region->cache & (instr ? ISS_CACHE_INSTR : ISS_CACHE_DATA)))
+        {
+            return CACHE_UNCACHED;
+        }
+
+        cache_t& cache = instr ? icache : dcache;
+        uint32_t idx   = (line / line_bytes) & (num_lines-1);
+        uint8_t* ldata = &cache.data[idx * line_bytes];
+        bool     hit   = cache.valid[idx] && cache.tag[idx] == line;
+
+        if (hit)
+        {
+            cache.hits++;
+        }
+        else
+        {
+            if (wc_active && wc_addr == line)
+            {
+                wc_flush();
+            }
+
+            cosim.transBurstRead(line, ldata, line_bytes, region->prot | (instr ? ISS_PROT_INSTR : 0));
+
+            cache.tag[idx]   = line;
+            cache.valid[idx] = 1;
+            cache.misses++;
+            num_bus_trans++;
+
+            log_bus_trans(line, ldata, line_bytes, true);
+        }
+
+        data = 0;
+        for (int bdx = 0; bdx < size; bdx++)
+        {
+            data |= (uint32_t)ldata[offset + bdx] << (8*bdx);
+        }
+
+        return hit ? CACHE_LOCAL : CACHE_BUS;
+    }
+
+    if (region->cache & (ISS_CACHE_INSTR | ISS_CACHE_DATA))
+    {
+        cache_store(icache, line, offset, data, size, region->cache & ISS_CACHE_WR_INV);
+        cache_store(dcache, line, offset, data, size, region->cache & ISS_CACHE_WR_INV);
+    }
+
+    if (!(region->cache & ISS_CACHE_WC))
+    {
+        return CACHE_UNCACHED;
+    }
+
+    if (wc_active && wc_addr != line)
+    {
+        wc_flush();
+    }
+
+    if (!wc_active)
+    {
+        wc_active = true;
+        wc_addr   = line;
+        wc_prot   = region->prot;
+        memset(&wc_valid[0], 0, line_bytes);
+    }
+
+    for (int bdx = 0; bdx < size; bdx++)
+    {
+        wc_data[offset + bdx]  = (data >> (8*bdx)) & 0xff;
+        wc_valid[offset + bdx] = 1;
+    }
+
+    wc_stores++;
+
+    return CACHE_LOCAL;
+}
+
+// -------------------------------------------------------------------------
+// cache_store()
+//
+// Update, or invalidate (inv true), a cache's copy of a stored line
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimIssBridge::cache_store (cache_t &cache, const uint32_t line, const int offset,
+                                       const uint32_t data, const int size, const bool inv)
+{
+    uint32_t idx = (line / line_bytes) & (num_lines-1);
+
+    if (cache.valid[idx] && cache.tag[idx] == line)
+    {
+        if (inv)
+        {
+            cache.valid[idx] = 0;
+        }
+        else
+        {
+            for (int bdx = 0; bdx < size; bdx++)
+            {
+                cache.data[idx * line_bytes + offset + bdx] = (data >> (8*bdx)) & 0xff;
+            }
+        }
+    }
+}
+
+// -------------------------------------------------------------------------
+// wc_flush()
+//
+// Write each contiguous run of stored bytes in the write-combining buffer
+// to the bus as a burst, and empty the buffer
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimIssBridge::wc_flush (void)
+{
+    if (!wc_active)
+    {
+        return;
+    }
+
+    int start = 0;
+
+    while (start < line_bytes)
+    {
+        if (!wc_valid[start])
+        {
+            start++;
+            continue;
+        }
+
+        int end = start;
+
+        while (end < line_bytes && wc_valid[end])
+        {
+            end++;
+        }
+
+        cosim.transBurstWrite(wc_addr + start, &wc_data[start], end - start, wc_prot);
+
+        num_bus_trans++;
+
+        log_bus_trans(wc_addr + start, &wc_data[start], end - start, false);
+
+        start = end;
+    }
+
+    wc_active = false;
+    wc_flushes++;
+}
+
+// -------------------------------------------------------------------------
+// local_done()
+//
+// Account for a completed local access, ticking the simulation if the
+// sync quantum has been reached, and returning the access's cycles
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimIssBridge::local_done (const int cycles)
+{
+    local_cycles += cycles;
+
+    if (sync_quantum > 0 && local_cycles >= sync_quantum)
+    {
+        wc_flush();
+        cosim.tick(local_cycles);
+        local_cycles = 0;
+        num_syncs++;
+    }
+
+    return cycles;
+}
+
+// -------------------------------------------------------------------------
+// log_bus_trans()
+//
+// If a socket script file is set, save off a TCP/IP transaction packet
+// command for a bus transaction. Word sized writes are logged as a value,
+// and other lengths as burst data, in memory order. Lengths are in hex,
+// as for the socket script format.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimIssBridge::log_bus_trans (const uint32_t addr, const uint8_t* data, const int len, const bool rnw)
+{
+    if (sktfp != NULL)
+    {
+        if (rnw)
+        {
+            fprintf(sktfp, "m%08x,%x\n", addr, len);
+        }
+        else if (len == 1 || len == 2 || len == 4 || len == 8)
+        {
+            uint64_t value = 0;
+
+            for (int idx = len-1; idx >= 0; idx--)
+            {
+                value = (value << 8) | data[idx];
+            }
+
+            fprintf(sktfp, "M%08x,%x:%0*llx\n", addr, len, len*2, (unsigned long long)value);
+        }
+        else
+        {
+            fprintf(sktfp, "M%08x,%x:", addr, len);
+
+            for (int idx = 0; idx < len; idx++)
+            {
+                fprintf(sktfp, "%02x", data[idx]);
+            }
+
+            fprintf(sktfp, "\n");
+        }
+    }
+}
@@ -0,0 +1,282 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimIssBridge.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Class definition for bridging an instruction set simulator's (ISS)
+//      memory access callback to co-simulation, via an address map. Each
+//      mapped region is routed to local host RAM, to transactions on the
+//      co-simulation bus (with a bus width and protection attributes), or
+//      to a user MMIO callback, so that only accesses to simulated
+//      peripherals need cross into the simulation. Bus regions may be
+//      cached, with instruction fetches and loads filling whole lines
+//      with burst reads, and stores merged in a write-combining buffer
+//      flushed with burst writes.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_COSIM_ISS_BRIDGE_H_
+#define _OSVVM_COSIM_ISS_BRIDGE_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+#include "OsvvmCosim.h"
+
+// -------------------------------------------------------------------------
+// CLASS DEFINITION
+// -------------------------------------------------------------------------
+
+class OsvvmCosimIssBridge
+{
+    ////////////////////////////////
+    // PUBLIC
+    ////////////////////////////////
+
+public:
+           static const int  OSVVM_COSIM_OK         = 0;
+           static const int  OSVVM_COSIM_ERR        = -1;
+
+           // Access types, matching the rv32 ISS MEM_WR_ACCESS_xxx and
+           // MEM_RD_ACCESS_xxx values, with debug accesses flagged by
+           // ISS_ACCESS_DBG_MASK
+           typedef enum iss_access_e
+           {
+               ISS_WR_BYTE,
+               ISS_WR_HWORD,
+               ISS_WR_WORD,
+               ISS_WR_INSTR,
+               ISS_RD_BYTE,
+               ISS_RD_HWORD,
+               ISS_RD_WORD,
+               ISS_RD_INSTR
+           } iss_access_t;
+
+           static const int  ISS_ACCESS_MASK        = 0x0f;
+           static const int  ISS_ACCESS_DBG_MASK    = 0x10;
+
+           // Returned by Access() when an access is left to the ISS's
+           // own memory (as RV32I_EXT_MEM_NOT_PROCESSED)
+           static const int  ISS_MEM_NOT_PROCESSED  = -1;
+
+           // Region access permissions
+           static const int  ISS_PERM_R             = 1;
+           static const int  ISS_PERM_W             = 2;
+           static const int  ISS_PERM_X             = 4;
+           static const int  ISS_PERM_RW            = ISS_PERM_R | ISS_PERM_W;
+           static const int  ISS_PERM_RWX           = ISS_PERM_R | ISS_PERM_W | ISS_PERM_X;
+
+           // Bus protection attribute bit added for instruction fetches
+           // (as AXI AxPROT[2])
+           static const int  ISS_PROT_INSTR         = 4;
+
+           // Default cycle counts returned for each access
+           static const int  DEFAULT_RAM_CYCLES     = 1;
+           static const int  DEFAULT_BUS_CYCLES     = 5;
+           static const int  DEFAULT_CACHE_CYCLES   = 1;
+
+           // Bus region cache attributes. Fetches (ISS_CACHE_INSTR) and
+           // loads (ISS_CACHE_DATA) are line filled and cached, and stores
+           // write-combined (ISS_CACHE_WC). Stores update any cached copy
+           // of their line, or invalidate it with ISS_CACHE_WR_INV.
+           static const int  ISS_CACHE_NONE         = 0;
+           static const int  ISS_CACHE_INSTR        = 1;
+           static const int  ISS_CACHE_DATA         = 2;
+           static const int  ISS_CACHE_WC           = 4;
+           static const int  ISS_CACHE_WR_INV       = 8;
+           static const int  ISS_CACHE_ALL          = ISS_CACHE_INSTR | ISS_CACHE_DATA | ISS_CACHE_WC;
+
+           // Default cache geometry
+           static const int  DEFAULT_CACHE_LINE     = 32;
+           static const int  DEFAULT_CACHE_LINES    = 256;
+
+           // Destination of accesses in a region
+           typedef enum iss_route_e
+           {
+               ISS_ROUTE_NONE,
+               ISS_ROUTE_RAM,
+               ISS_ROUTE_BUS,
+               ISS_ROUTE_MMIO
+           } iss_route_t;
+
+           // MMIO callback, with the access type as passed to Access(),
+           // returning a cycle count. MMIO accesses are not logged to the
+           // socket script, so callbacks do any logging of their own.
+           typedef int (*pIssMmioCB_t)(const uint32_t Addr, uint32_t &Data, const int Type, void* Hdl);
+
+    // Constructor
+                             OsvvmCosimIssBridge (const int         NodeNum      = 0,
+                                                  const iss_route_t DefaultRoute = ISS_ROUTE_BUS);
+
+    // Address map configuration
+           int               AddRamRegion    (const uint32_t   Start,
+                                              const uint32_t   End,
+                                              const int        Perm   = ISS_PERM_RWX,
+                                              const int        Cycles = DEFAULT_RAM_CYCLES);
+
+           int               AddBusRegion    (const uint32_t   Start,
+                                              const uint32_t   End,
+                                              const int        Width  = 4,
+                                              const int        Prot   = 0,
+                                              const int        Cache  = ISS_CACHE_NONE,
+                                              const int        Perm   = ISS_PERM_RWX,
+                                              const int        Cycles = DEFAULT_BUS_CYCLES);
+
+           int               AddMmioRegion   (const uint32_t   Start,
+                                              const uint32_t   End,
+                                              pIssMmioCB_t     Func,
+                                              void*            Hdl    = NULL,
+                                              const int        Perm   = ISS_PERM_RW,
+                                              const int        Cycles = DEFAULT_BUS_CYCLES);
+
+           void              SetScriptFile   (FILE* fp)  {sktfp = fp;}
+           void              SetSyncQuantum  (const int Cycles) {sync_quantum = Cycles;}
+
+    // Bus region caching
+           int               EnableCache     (const int        LineBytes = DEFAULT_CACHE_LINE,
+                                              const int        NumLines  = DEFAULT_CACHE_LINES);
+           void              Flush           (void);
+           void              Invalidate      (void);
+
+    // ISS memory callback entry point
+           int               Access          (const uint32_t   Addr,
+                                              uint32_t         &Data,
+                                              const int        Type,
+                                              const int64_t    Time = 0);
+
+           void              PrintStats      (void);
+
+           uint64_t          RamAccesses     (void)  {return num_acc[ISS_ROUTE_RAM];}
+           uint64_t          BusAccesses     (void)  {return num_acc[ISS_ROUTE_BUS];}
+           uint64_t          MmioAccesses    (void)  {return num_acc[ISS_ROUTE_MMIO];}
+           uint64_t          BusTransactions (void)  {return num_bus_trans;}
+           uint64_t          Syncs           (void)  {return num_syncs;}
+           uint64_t          ICacheHits      (void)  {return icache.hits;}
+           uint64_t          ICacheMisses    (void)  {return icache.misses;}
+           uint64_t          DCacheHits      (void)  {return dcache.hits;}
+           uint64_t          DCacheMisses    (void)  {return dcache.misses;}
+           uint64_t          WcStores        (void)  {return wc_stores;}
+           uint64_t          WcFlushes       (void)  {return wc_flushes;}
+           uint32_t          Errors          (void)  {return num_errors;}
+
+    ////////////////////////////////
+    // PRIVATE
+    ////////////////////////////////
+
+private:
+
+           typedef struct
+           {
+               uint32_t             start;
+               uint32_t             end;
+               iss_route_t          route;
+               int                  perm;
+               int                  cycles;
+               int                  width;
+               int                  prot;
+               int                  cache;
+               pIssMmioCB_t         func;
+               void*                hdl;
+               std::vector<uint8_t> mem;
+           } region_t;
+
+           // Direct mapped cache, with line data held contiguously
+           typedef struct
+           {
+               std::vector<uint32_t> tag;
+               std::vector<uint8_t>  valid;
+               std::vector<uint8_t>  data;
+               uint64_t              hits;
+               uint64_t              misses;
+           } cache_t;
+
+           // Outcome of a cache access
+           typedef enum cache_result_e
+           {
+               CACHE_UNCACHED,
+               CACHE_LOCAL,
+               CACHE_BUS
+           } cache_result_t;
+
+           static bool       startCmp        (const uint32_t addr, const region_t& region) {return addr < region.start;}
+
+           int               add_region      (region_t &region);
+           region_t*         find_region     (const uint32_t addr);
+           void              bus_access      (const region_t* region, const uint32_t addr, uint32_t &data,
+                                              const int size, const bool rnw, const bool instr);
+           cache_result_t    cache_access    (const region_t* region, const uint32_t addr, uint32_t &data,
+                                              const int size, const bool rnw, const bool instr);
+           void              cache_store     (cache_t &cache, const uint32_t line, const int offset,
+                                              const uint32_t data, const int size, const bool inv);
+           void              wc_flush        (void);
+           void              log_bus_trans   (const uint32_t addr, const uint8_t* data, const int len, const bool rnw);
+           int               local_done      (const int cycles);
+
+    // Private member variables
+           OsvvmCosim        cosim;
+           int               node;
+
+           std::vector<region_t> regions;
+           int               last_region;
+           region_t          default_region;
+
+           FILE*             sktfp;
+
+           int               sync_quantum;
+           int               local_cycles;
+
+           bool              cache_en;
+           int               line_bytes;
+           int               num_lines;
+           cache_t           icache;
+           cache_t           dcache;
+
+           // Write-combining buffer, of one line
+           bool              wc_active;
+           uint32_t          wc_addr;
+           int               wc_prot;
+           std::vector<uint8_t> wc_data;
+           std::vector<uint8_t> wc_valid;
+           uint64_t          wc_stores;
+           uint64_t          wc_flushes;
+
+           uint64_t          num_acc[ISS_ROUTE_MMIO+1];
+           uint64_t          num_bus_trans;
+           uint64_t          num_syncs;
+           uint32_t          num_errors;
+};
+
+#endif
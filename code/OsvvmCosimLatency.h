@@ -0,0 +1,262 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimLatency.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Simulator co-simulation C++ class for a table of responder
+//      latencies, indexed by address range. Each range has a fixed,
+//      uniform random or histogram distributed latency, in cycles,
+//      for reads, writes or both.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdint.h>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "OsvvmVUser.h"
+
+#ifndef __OSVVM_COSIM_LATENCY_H_
+#define __OSVVM_COSIM_LATENCY_H_
+
+class OsvvmCosimLatency
+{
+public:
+
+      // Selection of the transaction direction(s) a latency range applies to
+      typedef enum latency_dir_e
+      {
+          LATENCY_READ  = 1,
+          LATENCY_WRITE = 2,
+          LATENCY_RW    = 3
+      } latency_dir_t;
+
+                OsvvmCosimLatency (const uint32_t seed = 1) : rng(seed) {};
+
+      // -------------------------------------------------------------------------
+      // addFixed()
+      //
+      // Add an address range (start to end, inclusive) with a fixed latency
+      //
+      // -------------------------------------------------------------------------
+
+      bool addFixed (const uint64_t start, const uint64_t end, const int cycles, const int dir = LATENCY_RW)
+      {
+          range_t range;
+
+          range.start = start;
+          range.end   = end;
+          range.dist  = DIST_FIXED;
+          range.min   = cycles;
+          range.max   = cycles;
+
+          return addRange(range, dir);
+      }
+
+      // -------------------------------------------------------------------------
+      // addUniform()
+      //
+      // Add an address range (start to end, inclusive) with a latency
+      // uniformly distributed between min and max cycles, inclusive
+      //
+      // -------------------------------------------------------------------------
+
+      bool addUniform (const uint64_t start, const uint64_t end, const int min, const int max, const int dir = LATENCY_RW)
+      {
+          range_t range;
+
+          if (min > max)
+          {
+              VPrint("***ERROR: OsvvmCosimLatency::addUniform() minimum %d greater than maximum %d\n", min, max);
+              return false;
+          }
+
+          range.start = start;
+          range.end   = end;
+          range.dist  = DIST_UNIFORM;
+          range.min   = min;
+          range.max   = max;
+
+          return addRange(range, dir);
+      }
+
+      // -------------------------------------------------------------------------
+      // addHistogram()
+      //
+      // Add an address range (start to end, inclusive) with a latency
+      // selected from num_bins cycle values, with the relative weights given
+      //
+      // -------------------------------------------------------------------------
+
+      bool addHistogram (const uint64_t start, const uint64_t end, const int* cycles, const uint32_t* weights, const int num_bins, const int dir = LATENCY_RW)
+      {
+          range_t  range;
+          uint32_t total = 0;
+
+          range.start = start;
+          range.end   = end;
+          range.dist  = DIST_HISTOGRAM;
+
+          for (int idx = 0; idx < num_bins; idx++)
+          {
+              if (weights[idx])
+              {
+                  total += weights[idx];
+                  range.cycles.push_back(cycles[idx]);
+                  range.cumweight.push_back(total);
+              }
+          }
+
+          if (total == 0)
+          {
+              VPrint("***ERROR: OsvvmCosimLatency::addHistogram() no bins with a non-zero weight\n");
+              return false;
+          }
+
+          range.min   = 0;
+          range.max   = total - 1;
+
+          return addRange(range, dir);
+      }
+
+      // -------------------------------------------------------------------------
+      // getLatency()
+      //
+      // Return a latency, in cycles, for a read (rnw true) or write at the
+      // given address. Addresses not in a range have no latency.
+      //
+      // -------------------------------------------------------------------------
+
+      int getLatency (const uint64_t addr, const bool rnw)
+      {
+          std::vector<range_t>& tbl = rnw ? rdtbl : wrtbl;
+
+          // Find the last range starting at or below the address
+          std::vector<range_t>::iterator it = std::upper_bound(tbl.begin(), tbl.end(), addr, startCmp);
+
+          if (it == tbl.begin() || addr > (--it)->end)
+          {
+              return 0;
+          }
+
+          switch (it->dist)
+          {
+          case DIST_UNIFORM:
+              return std::uniform_int_distribution<int>(it->min, it->max)(rng);
+
+          case DIST_HISTOGRAM:
+          {
+              uint32_t sel = std::uniform_int_distribution<uint32_t>(it->min, it->max)(rng);
+              return it->cycles[std::upper_bound(it->cumweight.begin(), it->cumweight.end(), sel) - it->cumweight.begin()];
+          }
+
+          default:
+              return it->min;
+          }
+      }
+
+      void clear (void)                   {rdtbl.clear(); wrtbl.clear();}
+
+private:
+
+      typedef enum dist_e
+      {
+          DIST_FIXED,
+          DIST_UNIFORM,
+          DIST_HISTOGRAM
+      } dist_t;
+
+      typedef struct
+      {
+          uint64_t              start;
+          uint64_t              end;
+          dist_t                dist;
+          int                   min;
+          int                   max;
+          std::vector<int>      cycles;
+          std::vector<uint32_t> cumweight;
+      } range_t;
+
+      static bool startCmp (const uint64_t addr, const range_t& range) {return addr < range.start;}
+
+      // -------------------------------------------------------------------------
+      // addRange()
+      //
+      // Insert a range into the read and/or write tables, kept sorted on start
+      // address. Overlapping ranges within a table are rejected.
+      //
+      // -------------------------------------------------------------------------
+
+      bool addRange (const range_t& range, const int dir)
+      {
+          if (range.start > range.end || !(dir & LATENCY_RW))
+          {
+              VPrint("***ERROR: OsvvmCosimLatency: bad range 0x%llx to 0x%llx (dir %d)\n",
+                     (unsigned long long)range.start, (unsigned long long)range.end, dir);
+              return false;
+          }
+
+          // Check for overlaps in all selected tables before inserting in any
+          for (int rnw = 0; rnw < 2; rnw++)
+          {
+              if (dir & (rnw ? LATENCY_READ : LATENCY_WRITE))
+              {
+                  std::vector<range_t>& tbl = rnw ? rdtbl : wrtbl;
+                  std::vector<range_t>::iterator it = std::upper_bound(tbl.begin(), tbl.end(), range.start, startCmp);
+
+                  if ((it != tbl.end() && it->start <= range.end) || (it != tbl.begin() && (it-1)->end >= range.start))
+                  {
+                      VPrint("***ERROR: OsvvmCosimLatency: range 0x%llx to 0x%llx overlaps an existing range\n",
+                             (unsigned long long)range.start, (unsigned long long)range.end);
+                      return false;
+                  }
+              }
+          }
+
+          for (int rnw = 0; rnw < 2; rnw++)
+          {
+              if (dir & (rnw ? LATENCY_READ : LATENCY_WRITE))
+              {
+                  std::vector<range_t>& tbl = rnw ? rdtbl : wrtbl;
+                  tbl.insert(std::upper_bound(tbl.begin(), tbl.end(), range.start, startCmp), range);
+              }
+          }
+
+          return true;
+      }
+
+      std::vector<range_t> rdtbl;
+      std::vector<range_t> wrtbl;
+      std::mt19937         rng;
+};
+
+#endif
@@ -0,0 +1,635 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimPcap.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Defines methods for the OsvvmCosimPcap class, capturing stream
+//      bursts to a pcap or pcapng file via a buffered writer thread, and
+//      for the OsvvmCosimPcapReplay class, sending the frames of a
+//      memory mapped pcap or pcapng file over a stream node.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <string.h>
+#include <chrono>
+
+#if !(defined (_WIN32) || defined (_WIN64))
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+#endif
+
+#include "OsvvmCosimPcap.h"
+
+// -------------------------------------------------------------------------
+// DEFINES
+// -------------------------------------------------------------------------
+
+#define PCAP_MAGIC_US          0xa1b2c3d4U
+#define PCAP_MAGIC_NS          0xa1b23c4dU
+#define PCAP_SNAPLEN           65535
+
+#define PCAPNG_SHB_TYPE        0x0a0d0d0aU
+#define PCAPNG_IDB_TYPE        0x00000001U
+#define PCAPNG_SPB_TYPE        0x00000003U
+#define PCAPNG_EPB_TYPE        0x00000006U
+#define PCAPNG_BOM             0x1a2b3c4dU
+
+#define PCAPNG_OPT_ENDOFOPT    0
+#define PCAPNG_OPT_EPB_FLAGS   2
+#define PCAPNG_EPB_INBOUND     0x1
+#define PCAPNG_EPB_OUTBOUND    0x2
+
+#define BYTESWAP32(_x) ((((_x) & 0xffU) << 24) | (((_x) & 0xff00U) << 8) | (((_x) >> 8) & 0xff00U) | (((_x) >> 24) & 0xffU))
+
+// =========================================================================
+// OsvvmCosimPcap
+// =========================================================================
+
+OsvvmCosimPcap::OsvvmCosimPcap (void) :
+    fp(NULL),
+    format(PCAP_FORMAT_PCAPNG),
+    closing(false)
+{
+}
+
+OsvvmCosimPcap::~OsvvmCosimPcap (void)
+{
+    Close();
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimPcap::Open()
+//
+// Opens a capture file, writes the file headers and starts the writer
+// thread. Returns OSVVM_COSIM_OK on success, else OSVVM_COSIM_ERR.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimPcap::Open (const char* Filename, const pcap_format_t Format, const uint32_t LinkType)
+{
+    if (fp != NULL)
+    {
+        VPrint("***ERROR: OsvvmCosimPcap::Open() capture file already open\n");
+        return OSVVM_COSIM_ERR;
+    }
+
+    if ((fp = fopen(Filename, "wb")) == NULL)
+    {
+        VPrint("***ERROR: OsvvmCosimPcap::Open() unable to open %s for writing\n", Filename);
+        return OSVVM_COSIM_ERR;
+    }
+
+    format  = Format;
+    closing = false;
+    fill_buf.clear();
+    fill_buf.reserve(2 * FLUSH_THRESHOLD);
+
+    if (format == PCAP_FORMAT_PCAP)
+    {
+        // Global header
+        put_u32(fill_buf, PCAP_MAGIC_US);
+        put_u16(fill_buf, 2);
+        put_u16(fill_buf, 4);
+        put_u32(fill_buf, 0);
+        put_u32(fill_buf, 0);
+        put_u32(fill_buf, PCAP_SNAPLEN);
+        put_u32(fill_buf, LinkType);
+    }
+    else
+    {
+        // Section header block, with unspecified section length
+        put_u32(fill_buf, PCAPNG_SHB_TYPE);
+        put_u32(fill_buf, 28);
+        put_u32(fill_buf, PCAPNG_BOM);
+        put_u16(fill_buf, 1);
+        put_u16(fill_buf, 0);
+        put_u32(fill_buf, 0xffffffffU);
+        put_u32(fill_buf, 0xffffffffU);
+        put_u32(fill_buf, 28);
+
+        // Interface description block, with default microsecond resolution
+        put_u32(fill_buf, PCAPNG_IDB_TYPE);
+        put_u32(fill_buf, 20);
+        put_u16(fill_buf, LinkType);
+        put_u16(fill_buf, 0);
+        put_u32(fill_buf, PCAP_SNAPLEN);
+        put_u32(fill_buf, 20);
+    }
+
+    writer = std::thread(&OsvvmCosimPcap::writer_thread, this);
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimPcap::TapNode()
+//
+// Register the capture with a node, so every stream burst sent and
+// received on the node is written to the file
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimPcap::TapNode (const int NodeNum)
+{
+    VRegStreamTap(TapCB, (void*)this, NodeNum);
+}
+
+void OsvvmCosimPcap::UntapNode (const int NodeNum)
+{
+    VRegStreamTap(NULL, NULL, NodeNum);
+}
+
+void OsvvmCosimPcap::TapCB (const int txnrx, const uint8_t* data, const int len, void* hdl)
+{
+    ((OsvvmCosimPcap*)hdl)->Write(txnrx, data, len);
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimPcap::Write()
+//
+// Add a record for a burst to the fill buffer, with a host time stamp,
+// waking the writer thread when the buffer reaches its threshold. The
+// caller never waits on file I/O.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimPcap::Write (const bool TxNotRx, const uint8_t* Data, const int Len)
+{
+    static const uint8_t zeros[4] = {0, 0, 0, 0};
+
+    if (fp == NULL || Len < 0)
+    {
+        return;
+    }
+
+    uint64_t usecs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+    std::unique_lock<std::mutex> lck(buf_mx);
+
+    if (format == PCAP_FORMAT_PCAP)
+    {
+        put_u32(fill_buf, usecs / 1000000);
+        put_u32(fill_buf, usecs % 1000000);
+        put_u32(fill_buf, Len);
+        put_u32(fill_buf, Len);
+        put_rec(fill_buf, Data, Len);
+    }
+    else
+    {
+        uint32_t padlen   = (4 - (Len & 3)) & 3;
+        uint32_t blocklen = 32 + Len + padlen + 12;
+
+        // Enhanced packet block, with direction in the flags option
+        put_u32(fill_buf, PCAPNG_EPB_TYPE);
+        put_u32(fill_buf, blocklen);
+        put_u32(fill_buf, 0);
+        put_u32(fill_buf, usecs >> 32);
+        put_u32(fill_buf, usecs & 0xffffffffU);
+        put_u32(fill_buf, Len);
+        put_u32(fill_buf, Len);
+        put_rec(fill_buf, Data, Len);
+        put_rec(fill_buf, zeros, padlen);
+        put_u16(fill_buf, PCAPNG_OPT_EPB_FLAGS);
+        put_u16(fill_buf, 4);
+        put_u32(fill_buf, TxNotRx ? PCAPNG_EPB_OUTBOUND : PCAPNG_EPB_INBOUND);
+        put_u16(fill_buf, PCAPNG_OPT_ENDOFOPT);
+        put_u16(fill_buf, 0);
+        put_u32(fill_buf, blocklen);
+    }
+
+    if (fill_buf.size() >= FLUSH_THRESHOLD)
+    {
+        buf_cv.notify_one();
+    }
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimPcap::Close()
+//
+// Flush all buffered records, stop the writer thread and close the file
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimPcap::Close (void)
+{
+    if (fp == NULL)
+    {
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lck(buf_mx);
+        closing = true;
+        buf_cv.notify_one();
+    }
+
+    writer.join();
+
+    fclose(fp);
+    fp = NULL;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimPcap::writer_thread()
+//
+// Swap out the fill buffer whenever it reaches its threshold (or on
+// closing) and write it to the file outside of the lock
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimPcap::writer_thread (void)
+{
+    std::vector<uint8_t> wr_buf;
+    bool                 done = false;
+
+    wr_buf.reserve(2 * FLUSH_THRESHOLD);
+
+    while (!done)
+    {
+        {
+            std::unique_lock<std::mutex> lck(buf_mx);
+
+            buf_cv.wait(lck, [this]{return closing || fill_buf.size() >= FLUSH_THRESHOLD;});
+
+            wr_buf.swap(fill_buf);
+            done = closing;
+        }
+
+        if (!wr_buf.empty() && fwrite(wr_buf.data(), 1, wr_buf.size(), fp) != wr_buf.size())
+        {
+            VPrint("***ERROR: OsvvmCosimPcap: writing to capture file\n");
+        }
+
+        wr_buf.clear();
+    }
+}
+
+void OsvvmCosimPcap::put_rec (std::vector<uint8_t> &buf, const void* data, const size_t len)
+{
+    buf.insert(buf.end(), (const uint8_t*)data, (const uint8_t*)data + len);
+}
+
+void OsvvmCosimPcap::put_u16 (std::vector<uint8_t> &buf, const uint16_t val)
+{
+    put_rec(buf, &val, sizeof(val));
+}
+
+void OsvvmCosimPcap::put_u32 (std::vector<uint8_t> &buf, const uint32_t val)
+{
+    put_rec(buf, &val, sizeof(val));
+}
+
+// =========================================================================
+// OsvvmCosimPcapReplay
+// =========================================================================
+
+OsvvmCosimPcapReplay::OsvvmCosimPcapReplay (void) :
+    map(NULL),
+    map_size(0),
+    offset(0),
+    start_offset(0),
+    swapped(false),
+    is_pcapng(false),
+    is_nsecs(false)
+{
+}
+
+OsvvmCosimPcapReplay::~OsvvmCosimPcapReplay (void)
+{
+    Close();
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimPcapReplay::Open()
+//
+// Memory map a pcap or pcapng file (read into memory on Windows) and
+// check its header. Returns OSVVM_COSIM_OK on success, else
+// OSVVM_COSIM_ERR.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimPcapReplay::Open (const char* Filename)
+{
+    Close();
+
+#if defined (_WIN32) || defined (_WIN64)
+    FILE* fp;
+
+    if ((fp = fopen(Filename, "rb")) == NULL)
+    {
+        VPrint("***ERROR: OsvvmCosimPcapReplay::Open() unable to open %s\n", Filename);
+        return OSVVM_COSIM_ERR;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    file_buf.resize(ftell(fp));
+    fseek(fp, 0, SEEK_SET);
+    map_size = fread(file_buf.data(), 1, file_buf.size(), fp);
+    fclose(fp);
+
+    map = file_buf.data();
+#else
+    struct stat sb;
+    int         fd;
+
+    if ((fd = open(Filename, O_RDONLY)) < 0 || fstat(fd, &sb) < 0)
+    {
+        VPrint("***ERROR: OsvvmCosimPcapReplay::Open() unable to open %s\n", Filename);
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return OSVVM_COSIM_ERR;
+    }
+
+    map_size = sb.st_size;
+
+    void* addr = (map_size > 0) ? mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+
+    close(fd);
+
+    if (addr == MAP_FAILED)
+    {
+        VPrint("***ERROR: OsvvmCosimPcapReplay::Open() unable to map %s\n", Filename);
+        map_size = 0;
+        return OSVVM_COSIM_ERR;
+    }
+
+    map = (const uint8_t*)addr;
+
+    // Frames are read sequentially
+    madvise(addr, map_size, MADV_SEQUENTIAL);
+#endif
+
+    if (map_size < 24)
+    {
+        VPrint("***ERROR: OsvvmCosimPcapReplay::Open() %s too short for a capture file\n", Filename);
+        Close();
+        return OSVVM_COSIM_ERR;
+    }
+
+    uint32_t magic;
+    memcpy(&magic, map, sizeof(magic));
+
+    if (magic == PCAPNG_SHB_TYPE)
+    {
+        uint32_t bom;
+        memcpy(&bom, map + 8, sizeof(bom));
+
+        is_pcapng = true;
+        is_nsecs  = false;
+        swapped   = (bom != PCAPNG_BOM);
+        offset    = 0;
+    }
+    else if (magic == PCAP_MAGIC_US || magic == PCAP_MAGIC_NS || BYTESWAP32(magic) == PCAP_MAGIC_US || BYTESWAP32(magic) == PCAP_MAGIC_NS)
+    {
+        is_pcapng = false;
+        swapped   = (magic != PCAP_MAGIC_US && magic != PCAP_MAGIC_NS);
+        is_nsecs  = (magic == PCAP_MAGIC_NS || BYTESWAP32(magic) == PCAP_MAGIC_NS);
+        offset    = 24;
+    }
+    else
+    {
+        VPrint("***ERROR: OsvvmCosimPcapReplay::Open() %s is not a pcap or pcapng file\n", Filename);
+        Close();
+        return OSVVM_COSIM_ERR;
+    }
+
+    start_offset = offset;
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimPcapReplay::Replay()
+//
+// Send up to MaxFrames frames (all if negative) from the file over the
+// stream's TX path, directly from the mapped file. Each frame is sent as
+// one burst, with frames longer than a maximum size burst split into
+// maximum size bursts. Returns the number of frames sent.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimPcapReplay::Replay (OsvvmCosimStream* Strm, const int MaxFrames, const int Param)
+{
+    const int      max_burst = DATABUF_SIZE - 1;
+    const uint8_t* frame;
+    uint32_t       len;
+    int            frames    = 0;
+
+    while ((MaxFrames < 0 || frames < MaxFrames) && NextFrame(frame, len) == OSVVM_COSIM_OK)
+    {
+        for (uint32_t idx = 0; idx < len; idx += max_burst)
+        {
+            int burstlen = ((len - idx) < (uint32_t)max_burst) ? (len - idx) : max_burst;
+
+            Strm->streamBurstSend((uint8_t*)&frame[idx], burstlen, Param);
+        }
+
+        frames++;
+    }
+
+    return frames;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimPcapReplay::Close()
+// -------------------------------------------------------------------------
+
+void OsvvmCosimPcapReplay::Close (void)
+{
+#if defined (_WIN32) || defined (_WIN64)
+    file_buf.clear();
+#else
+    if (map != NULL)
+    {
+        munmap((void*)map, map_size);
+    }
+#endif
+
+    map          = NULL;
+    map_size     = 0;
+    offset       = 0;
+    start_offset = 0;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimPcapReplay::NextFrame()
+//
+// Return a pointer to, and the length of, the next frame in the file,
+// skipping any pcapng blocks that don't contain packet data. If not NULL,
+// Usecs is set to the frame's time stamp, in microseconds, and Dir to its
+// direction (PCAP_DIR_xxx). Rewind() restarts from the first frame.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimPcapReplay::NextFrame (const uint8_t* &frame, uint32_t &len, uint64_t* Usecs, int* Dir)
+{
+    uint64_t usecs = 0;
+    int      dir   = PCAP_DIR_UNKNOWN;
+    int      result;
+
+    // Scan for the next frame, with result set when found (or bad)
+    result = OSVVM_COSIM_ERR;
+
+    while (map != NULL)
+    {
+        if (!is_pcapng)
+        {
+            if (offset + 16 > map_size)
+            {
+                break;
+            }
+
+            usecs  = (uint64_t)get_u32(map + offset) * 1000000 + get_u32(map + offset + 4) / (is_nsecs ? 1000 : 1);
+            len    = get_u32(map + offset + 8);
+            frame  = map + offset + 16;
+            offset = offset + 16 + len;
+
+            result = (offset <= map_size) ? OSVVM_COSIM_OK : OSVVM_COSIM_ERR;
+            break;
+        }
+        else
+        {
+            if (offset + 12 > map_size)
+            {
+                break;
+            }
+
+            uint32_t type     = get_u32(map + offset);
+            uint32_t blocklen = get_u32(map + offset + 4);
+            size_t   block    = offset;
+
+            if (blocklen < 12 || block + blocklen > map_size)
+            {
+                break;
+            }
+
+            offset += blocklen;
+
+            // A section header may change the byte order
+            if (type == PCAPNG_SHB_TYPE)
+            {
+                uint32_t bom;
+                memcpy(&bom, map + block + 8, sizeof(bom));
+                swapped = (bom != PCAPNG_BOM);
+            }
+            else if (type == PCAPNG_EPB_TYPE && blocklen >= 32)
+            {
+                usecs  = ((uint64_t)get_u32(map + block + 12) << 32) | get_u32(map + block + 16);
+                len    = get_u32(map + block + 20);
+                frame  = map + block + 28;
+                result = (28 + len <= blocklen) ? OSVVM_COSIM_OK : OSVVM_COSIM_ERR;
+
+                // Options follow the padded frame data, up to the trailing block length
+                if (result == OSVVM_COSIM_OK)
+                {
+                    dir = get_dir(frame + ((len + 3) & ~3U), map + block + blocklen - 4);
+                }
+                break;
+            }
+            else if (type == PCAPNG_SPB_TYPE && blocklen >= 16)
+            {
+                len    = get_u32(map + block + 8);
+                len    = (len < blocklen - 16) ? len : blocklen - 16;
+                frame  = map + block + 12;
+                result = OSVVM_COSIM_OK;
+                break;
+            }
+        }
+    }
+
+    if (Usecs != NULL)
+    {
+        *Usecs = usecs;
+    }
+
+    if (Dir != NULL)
+    {
+        *Dir = dir;
+    }
+
+    return result;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimPcapReplay::get_dir()
+//
+// Return the direction from an enhanced packet block's flags option, if
+// present in the options from opts to end
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimPcapReplay::get_dir (const uint8_t* opts, const uint8_t* end)
+{
+    while (opts + 4 <= end)
+    {
+        uint16_t code, optlen;
+
+        memcpy(&code,   opts,     sizeof(code));
+        memcpy(&optlen, opts + 2, sizeof(optlen));
+
+        if (swapped)
+        {
+            code   = (code   >> 8) | (code   << 8);
+            optlen = (optlen >> 8) | (optlen << 8);
+        }
+
+        if (code == PCAPNG_OPT_ENDOFOPT)
+        {
+            break;
+        }
+
+        if (code == PCAPNG_OPT_EPB_FLAGS && optlen == 4 && opts + 8 <= end)
+        {
+            return get_u32(opts + 4) & (PCAPNG_EPB_INBOUND | PCAPNG_EPB_OUTBOUND);
+        }
+
+        opts += 4 + ((optlen + 3) & ~3U);
+    }
+
+    return PCAP_DIR_UNKNOWN;
+}
+
+uint32_t OsvvmCosimPcapReplay::get_u32 (const uint8_t* p)
+{
+    uint32_t val;
+
+    memcpy(&val, p, sizeof(val));
+
+    return swapped ? BYTESWAP32(val) : val;
+}
@@ -0,0 +1,182 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimPcap.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Class definitions for capturing co-simulation stream bursts to a
+//      pcap or pcapng file, via a buffered writer thread, and for
+//      replaying a pcap or pcapng file's frames over a stream node.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_COSIM_PCAP_H_
+#define _OSVVM_COSIM_PCAP_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "OsvvmCosimStream.h"
+
+// -------------------------------------------------------------------------
+// CLASS DEFINITION (capture)
+// -------------------------------------------------------------------------
+
+class OsvvmCosimPcap
+{
+    ////////////////////////////////
+    // PUBLIC
+    ////////////////////////////////
+
+public:
+           static const int  OSVVM_COSIM_OK      = 0;
+           static const int  OSVVM_COSIM_ERR     = -1;
+
+           // Capture file formats. Only pcapng records the burst direction.
+           typedef enum pcap_format_e
+           {
+               PCAP_FORMAT_PCAP,
+               PCAP_FORMAT_PCAPNG
+           } pcap_format_t;
+
+           static const uint32_t LINKTYPE_ETHERNET   = 1;
+           static const uint32_t LINKTYPE_USER0      = 147;
+
+    // Constructor/destructor
+                             OsvvmCosimPcap  (void);
+                            ~OsvvmCosimPcap  (void);
+
+    // User entry point methods
+           int               Open            (const char*         Filename,
+                                              const pcap_format_t Format   = PCAP_FORMAT_PCAPNG,
+                                              const uint32_t      LinkType = LINKTYPE_ETHERNET);
+           void              TapNode         (const int           NodeNum);
+           void              UntapNode       (const int           NodeNum);
+           void              Write           (const bool          TxNotRx,
+                                              const uint8_t*      Data,
+                                              const int           Len);
+           void              Close           (void);
+
+           // Stream tap callback, registered with VRegStreamTap, with the object as the handle
+    static void              TapCB           (const int txnrx, const uint8_t* data, const int len, void* hdl);
+
+    ////////////////////////////////
+    // PRIVATE
+    ////////////////////////////////
+
+private:
+           // Amount of buffered data at which the writer thread is woken
+           static const size_t FLUSH_THRESHOLD   = 64 * 1024;
+
+    // Private methods
+           void              writer_thread   (void);
+           void              put_rec         (std::vector<uint8_t> &buf, const void* data, const size_t len);
+           void              put_u16         (std::vector<uint8_t> &buf, const uint16_t val);
+           void              put_u32         (std::vector<uint8_t> &buf, const uint32_t val);
+
+    // Private member variables
+           FILE*                   fp;
+           pcap_format_t           format;
+
+           std::vector<uint8_t>    fill_buf;
+           std::thread             writer;
+           std::mutex              buf_mx;
+           std::condition_variable buf_cv;
+           bool                    closing;
+};
+
+// -------------------------------------------------------------------------
+// CLASS DEFINITION (replay)
+// -------------------------------------------------------------------------
+
+class OsvvmCosimPcapReplay
+{
+    ////////////////////////////////
+    // PUBLIC
+    ////////////////////////////////
+
+public:
+           static const int  OSVVM_COSIM_OK      = 0;
+           static const int  OSVVM_COSIM_ERR     = -1;
+
+           // Frame directions returned by NextFrame(), as the pcapng
+           // enhanced packet block flags (unknown for pcap files)
+           static const int  PCAP_DIR_UNKNOWN    = 0;
+           static const int  PCAP_DIR_RX         = 1;
+           static const int  PCAP_DIR_TX         = 2;
+
+    // Constructor/destructor
+                             OsvvmCosimPcapReplay  (void);
+                            ~OsvvmCosimPcapReplay  (void);
+
+    // User entry point methods
+           int               Open            (const char*       Filename);
+           int               Replay          (OsvvmCosimStream* Strm,
+                                              const int         MaxFrames = -1,
+                                              const int         Param     = 1);
+           int               NextFrame       (const uint8_t*    &Frame,
+                                              uint32_t          &Len,
+                                              uint64_t*         Usecs     = NULL,
+                                              int*              Dir       = NULL);
+           void              Rewind          (void)  {offset = start_offset;}
+           void              Close           (void);
+
+    ////////////////////////////////
+    // PRIVATE
+    ////////////////////////////////
+
+private:
+    // Private methods
+           int               get_dir         (const uint8_t* opts, const uint8_t* end);
+           uint32_t          get_u32         (const uint8_t* p);
+
+    // Private member variables
+           const uint8_t*    map;
+           size_t            map_size;
+           size_t            offset;
+           size_t            start_offset;
+           bool              swapped;
+           bool              is_pcapng;
+           bool              is_nsecs;
+
+#if defined (_WIN32) || defined (_WIN64)
+           std::vector<uint8_t> file_buf;
+#endif
+};
+
+#endif
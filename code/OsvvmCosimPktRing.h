@@ -0,0 +1,175 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimPktRing.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Simulator co-simulation C++ class for a ring buffer of variable
+//      length packets. Each packet is stored as a small header, with
+//      its length and status, followed by its bytes.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdint.h>
+#include <vector>
+
+#ifndef __OSVVM_COSIM_PKT_RING_H_
+#define __OSVVM_COSIM_PKT_RING_H_
+
+class OsvvmCosimPktRing
+{
+public:
+      // Default ring size, enough for sixteen maximum sized bursts
+      static const uint32_t default_ring_size = 16 * 4096;
+
+      // Size of the length and status header for each packet
+      static const uint32_t hdr_size          = 2 * sizeof(uint32_t);
+
+                OsvvmCosimPktRing (const uint32_t size = default_ring_size) : ring(size), head(0), used(0), pkts(0) {};
+
+      // -------------------------------------------------------------------------
+      // push()
+      //
+      // Add a packet to the ring, returning false if there is not enough
+      // space
+      //
+      // -------------------------------------------------------------------------
+
+      bool push (const uint8_t* data, const uint32_t len, const int status)
+      {
+          if (len + hdr_size > space())
+          {
+              return false;
+          }
+
+          uint32_t hdr[2] = {len, (uint32_t)status};
+
+          copyIn((const uint8_t*)hdr, hdr_size);
+          copyIn(data, len);
+
+          pkts++;
+
+          return true;
+      }
+
+      // -------------------------------------------------------------------------
+      // peek()
+      //
+      // Return the length of the packet at the front of the ring, or -1 if
+      // empty, copying up to maxlen of its bytes to data (if not NULL) and
+      // its status to status (if not NULL). The packet is not removed.
+      //
+      // -------------------------------------------------------------------------
+
+      int peek (uint8_t* data, const uint32_t maxlen, int* status = NULL)
+      {
+          uint32_t hdr[2];
+
+          if (pkts == 0)
+          {
+              return -1;
+          }
+
+          copyOut((uint8_t*)hdr, head, hdr_size);
+
+          if (data != NULL)
+          {
+              copyOut(data, head + hdr_size, (hdr[0] < maxlen) ? hdr[0] : maxlen);
+          }
+
+          if (status != NULL)
+          {
+              *status = (int)hdr[1];
+          }
+
+          return hdr[0];
+      }
+
+      // -------------------------------------------------------------------------
+      // pop()
+      //
+      // Remove the packet at the front of the ring, copying up to maxlen
+      // of its bytes to data, discarding the rest. Returns the number of
+      // bytes copied, or -1 if empty.
+      //
+      // -------------------------------------------------------------------------
+
+      int pop (uint8_t* data, const uint32_t maxlen, int* status = NULL)
+      {
+          int len = peek(data, maxlen, status);
+
+          if (len >= 0)
+          {
+              head  = (head + hdr_size + len) % ring.size();
+              used -= hdr_size + len;
+              pkts--;
+
+              if ((uint32_t)len > maxlen)
+              {
+                  len = maxlen;
+              }
+          }
+
+          return len;
+      }
+
+      uint32_t space       (void)         {return ring.size() - used;}
+      uint32_t numPackets  (void)         {return pkts;}
+      bool     empty       (void)         {return pkts == 0;}
+      void     clear       (void)         {head = used = pkts = 0;}
+
+private:
+
+      // Copy bytes into the ring after the last stored byte, wrapping as necessary
+      void copyIn (const uint8_t* data, const uint32_t len)
+      {
+          for (uint32_t idx = 0; idx < len; idx++)
+          {
+              ring[(head + used + idx) % ring.size()] = data[idx];
+          }
+          used += len;
+      }
+
+      // Copy bytes out of the ring, from the given position, wrapping as necessary
+      void copyOut (uint8_t* data, const uint32_t pos, const uint32_t len)
+      {
+          for (uint32_t idx = 0; idx < len; idx++)
+          {
+              data[idx] = ring[(pos + idx) % ring.size()];
+          }
+      }
+
+      std::vector<uint8_t> ring;
+      uint32_t             head;
+      uint32_t             used;
+      uint32_t             pkts;
+};
+
+#endif
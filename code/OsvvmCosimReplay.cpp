@@ -0,0 +1,528 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimReplay.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Defines methods for the OsvvmCosimReplay class, an in-process
+//      compiled replay engine for socket scripts
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+
+#if !(defined (_WIN32) || defined (_WIN64))
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+#endif
+
+#include "OsvvmCosimReplay.h"
+
+// -------------------------------------------------------------------------
+// Get a hex number from the characters at buf (before end) into val,
+// advancing buf past them. Returns the number of digits.
+// -------------------------------------------------------------------------
+
+static int get_hex (const char* &buf, const char* end, uint64_t &val)
+{
+    int digits = 0;
+
+    for (val = 0; buf < end; buf++, digits++)
+    {
+        char c = *buf;
+
+        if      (c >= '0' && c <= '9') val = (val << 4) | (c - '0');
+        else if (c >= 'a' && c <= 'f') val = (val << 4) | (c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') val = (val << 4) | (c - 'A' + 10);
+        else break;
+    }
+
+    return digits;
+}
+
+// -------------------------------------------------------------------------
+// Word write or read of the given data and address types
+// -------------------------------------------------------------------------
+
+template<typename T, typename A> static uint64_t cosim_word_op (OsvvmCosim &cosim, const bool rnw, const A addr, const uint64_t data)
+{
+    T rdata = 0;
+
+    if (rnw)
+    {
+        cosim.transRead(addr, &rdata);
+    }
+    else
+    {
+        cosim.transWrite(addr, (T)data);
+    }
+
+    return rdata;
+}
+
+// -------------------------------------------------------------------------
+// Constructor
+// -------------------------------------------------------------------------
+
+OsvvmCosimReplay::OsvvmCosimReplay (const int NodeNum, const int Options) :
+    node(NodeNum), options(Options), last_page_num(0), last_page(NULL), line_num(0), checks(0), errors(0)
+{
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimReplay::Load()
+//
+// Memory maps the named script file and compiles it. Where memory mapping
+// isn't available, the file is read into a buffer instead. Returns
+// OSVVM_COSIM_ERR if the file can't be opened or fails to compile.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimReplay::Load (const std::string FileName)
+{
+    int status = OSVVM_COSIM_ERR;
+
+#if defined (_WIN32) || defined (_WIN64)
+
+    FILE* fp = fopen(FileName.c_str(), "rb");
+
+    if (fp != NULL)
+    {
+        std::vector<char> buf;
+        char              blk[4096];
+        size_t            len;
+
+        while ((len = fread(blk, 1, sizeof(blk), fp)) > 0)
+        {
+            buf.insert(buf.end(), blk, blk + len);
+        }
+
+        fclose(fp);
+
+        status = Compile(buf.data(), buf.size());
+    }
+
+#else
+
+    int         fd = open(FileName.c_str(), O_RDONLY);
+    struct stat sb;
+
+    if (fd >= 0 && fstat(fd, &sb) == 0)
+    {
+        if (sb.st_size == 0)
+        {
+            status = OSVVM_COSIM_OK;
+        }
+        else
+        {
+            void* map = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (map != MAP_FAILED)
+            {
+                madvise(map, sb.st_size, MADV_SEQUENTIAL);
+
+                status = Compile((const char*)map, sb.st_size);
+
+                munmap(map, sb.st_size);
+            }
+        }
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+#endif
+
+    if (status != OSVVM_COSIM_OK)
+    {
+        VPrint("OsvvmCosimReplay: ***ERROR failed to load script %s\n", FileName.c_str());
+    }
+
+    return status;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimReplay::Compile()
+//
+// Compiles the script in the Len characters at Script, a line at a time,
+// up to the end of the script or a detach (D) or kill (k) command.
+// Returns OSVVM_COSIM_ERR at the first line that fails to compile.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimReplay::Compile (const char* Script, const size_t Len)
+{
+    const char* end = Script + Len;
+    int         status;
+
+    line_num = 0;
+
+    for (const char* buf = Script; buf < end; buf++)
+    {
+        const char* eol = (const char*)memchr(buf, '\n', end - buf);
+
+        eol = eol ? eol : end;
+
+        line_num++;
+
+        if ((status = compile_line(buf, eol)) != OSVVM_COSIM_OK)
+        {
+            // Detach or kill ends the script
+            return (status > 0) ? OSVVM_COSIM_OK : status;
+        }
+
+        buf = eol;
+    }
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimReplay::compile_line()
+//
+// Compiles a single script line into an operation. Lines are as for
+// client_batch.py, without packet framing, with blank lines and lines
+// starting with # ignored:
+//
+//   M<addr>,<len>:<data>    Memory write
+//   m<addr>,<len>[:<data>]  Memory read, checked against data, if given
+//   D or k                  Detach or kill, ending the script
+//
+// Lengths of 1, 2, 4 and 8 bytes are word transfers, with the data as a
+// hex number. Other lengths are bursts, with the data as hex bytes in
+// memory order. Returns 1 at the end of the script, else OSVVM_COSIM_OK
+// or OSVVM_COSIM_ERR.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimReplay::compile_line (const char* buf, const char* end)
+{
+    op_t     op;
+    uint64_t len;
+    uint64_t byte;
+
+    // Strip any trailing carriage return
+    if (end > buf && end[-1] == '\r')
+    {
+        end--;
+    }
+
+    if (buf == end || *buf == '#')
+    {
+        return OSVVM_COSIM_OK;
+    }
+
+    if (*buf == 'D' || *buf == 'k')
+    {
+        return 1;
+    }
+
+    const char cmd = *buf++;
+
+    if ((cmd != 'M' && cmd != 'm') || get_hex(buf, end, op.addr) == 0 || buf == end || *buf++ != ',' ||
+        get_hex(buf, end, len) == 0 || len == 0 || len > 0xffffffffULL)
+    {
+        VPrint("OsvvmCosimReplay: ***ERROR bad command at line %d\n", line_num);
+        return OSVVM_COSIM_ERR;
+    }
+
+    bool word     = (len == 1 || len == 2 || len == 4 || len == 8);
+    bool has_data = (buf < end && *buf == ':');
+
+    // Data must be exactly the length given, and is required for writes
+    if ((cmd == 'M' && !has_data) || (has_data && (end - buf - 1) != (int64_t)(2*len)) || (!has_data && buf != end))
+    {
+        VPrint("OsvvmCosimReplay: ***ERROR bad data at line %d\n", line_num);
+        return OSVVM_COSIM_ERR;
+    }
+
+    op.len  = (uint32_t)len;
+    op.line = line_num;
+    op.data = word ? 0 : pool.size();
+
+    if (has_data)
+    {
+        buf++;
+
+        for (uint64_t idx = 0; idx < len; idx++)
+        {
+            const char* nib = buf;
+
+            if (get_hex(buf, nib + 2, byte) != 2)
+            {
+                VPrint("OsvvmCosimReplay: ***ERROR bad data at line %d\n", line_num);
+                pool.resize(word ? pool.size() : op.data);
+                return OSVVM_COSIM_ERR;
+            }
+
+            if (word)
+            {
+                op.data = (op.data << 8) | byte;
+            }
+            else
+            {
+                pool.push_back((uint8_t)byte);
+            }
+        }
+    }
+
+    if (cmd == 'M')
+    {
+        op.op = word ? OP_WRITE : OP_BURST_WRITE;
+
+        // Keep a shadow of the written bytes, as they would be in (little endian) memory
+        if (options & REPLAY_CHECK_WRITTEN)
+        {
+            for (uint64_t idx = 0; idx < len; idx++)
+            {
+                uint64_t       addr   = op.addr + idx;
+                uint32_t       offset = (uint32_t)addr & (SHADOW_PAGE_SIZE-1);
+                shadow_page_t* page   = shadow_page(addr, true);
+
+                page->data[offset]  = word ? (uint8_t)(op.data >> (8*idx)) : pool[op.data + idx];
+                page->valid[offset] = 1;
+            }
+        }
+    }
+    else if (has_data)
+    {
+        op.op = word ? OP_READ_CHECK : OP_BURST_READ_CHECK;
+    }
+    else
+    {
+        op.op = word ? OP_READ : OP_BURST_READ;
+
+        // Check the read against the script's earlier writes if every byte was written
+        if ((options & REPLAY_CHECK_WRITTEN) && !shadow.empty())
+        {
+            uint64_t exp  = 0;
+            size_t   base = pool.size();
+            uint64_t idx;
+
+            for (idx = 0; idx < len; idx++)
+            {
+                uint64_t       addr   = op.addr + idx;
+                uint32_t       offset = (uint32_t)addr & (SHADOW_PAGE_SIZE-1);
+                shadow_page_t* page   = shadow_page(addr, false);
+
+                if (page == NULL || !page->valid[offset])
+                {
+                    break;
+                }
+
+                if (word)
+                {
+                    exp |= (uint64_t)page->data[offset] << (8*idx);
+                }
+                else
+                {
+                    pool.push_back(page->data[offset]);
+                }
+            }
+
+            if (idx == len)
+            {
+                op.op   = word ? OP_READ_CHECK : OP_BURST_READ_CHECK;
+                op.data = word ? exp : op.data;
+            }
+            else
+            {
+                pool.resize(base);
+            }
+        }
+    }
+
+    ops.push_back(op);
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimReplay::shadow_page()
+//
+// Returns the shadow page holding the byte at addr, allocating a cleared
+// page if alloc is set and there is none yet, else returning NULL. The
+// last page returned is cached, as script accesses are mostly local.
+//
+// -------------------------------------------------------------------------
+
+OsvvmCosimReplay::shadow_page_t* OsvvmCosimReplay::shadow_page (const uint64_t addr, const bool alloc)
+{
+    uint64_t page_num = addr >> SHADOW_PAGE_BITS;
+
+    if (last_page == NULL || page_num != last_page_num)
+    {
+        std::unordered_map<uint64_t, shadow_page_t>::iterator it = shadow.find(page_num);
+
+        if (it == shadow.end())
+        {
+            if (!alloc)
+            {
+                return NULL;
+            }
+
+            // Value initialised, so no bytes are valid
+            it = shadow.emplace(page_num, shadow_page_t()).first;
+        }
+
+        // Map nodes are stable, so the page stays put as others are added
+        last_page_num = page_num;
+        last_page     = &it->second;
+    }
+
+    return last_page;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimReplay::Run()
+//
+// Runs all the compiled operations as transactions on the node, checking
+// read data where expected data was compiled. Returns the number of read
+// check failures.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimReplay::Run (void)
+{
+    OsvvmCosim cosim(node);
+
+    checks = 0;
+    errors = 0;
+
+    for (std::vector<op_t>::const_iterator op = ops.begin(); op != ops.end(); op++)
+    {
+        if (!run_op(cosim, *op))
+        {
+            errors++;
+
+            if (options & REPLAY_STOP_ON_ERROR)
+            {
+                break;
+            }
+        }
+    }
+
+    return errors;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimReplay::run_op()
+//
+// Runs a single operation, splitting bursts into chunks that fit the
+// transfer buffer. Returns false if read data didn't match that expected.
+//
+// -------------------------------------------------------------------------
+
+bool OsvvmCosimReplay::run_op (OsvvmCosim &cosim, const op_t &op)
+{
+    bool     addr64 = (op.addr + op.len) > 0x100000000ULL;
+    bool     rnw    = (op.op != OP_WRITE && op.op != OP_BURST_WRITE);
+    uint64_t rdata  = 0;
+
+    switch (op.op)
+    {
+    case OP_WRITE:
+    case OP_READ:
+    case OP_READ_CHECK:
+        switch (op.len)
+        {
+        case 1: rdata = addr64 ? cosim_word_op<uint8_t,  uint64_t>(cosim, rnw, op.addr, op.data) : cosim_word_op<uint8_t,  uint32_t>(cosim, rnw, (uint32_t)op.addr, op.data); break;
+        case 2: rdata = addr64 ? cosim_word_op<uint16_t, uint64_t>(cosim, rnw, op.addr, op.data) : cosim_word_op<uint16_t, uint32_t>(cosim, rnw, (uint32_t)op.addr, op.data); break;
+        case 4: rdata = addr64 ? cosim_word_op<uint32_t, uint64_t>(cosim, rnw, op.addr, op.data) : cosim_word_op<uint32_t, uint32_t>(cosim, rnw, (uint32_t)op.addr, op.data); break;
+        case 8: rdata =          cosim_word_op<uint64_t, uint64_t>(cosim, rnw, op.addr, op.data);                                                                           break;
+        }
+
+        if (op.op == OP_READ_CHECK)
+        {
+            checks++;
+
+            if (rdata != op.data)
+            {
+                VPrint("OsvvmCosimReplay: ***ERROR line %d read %0*llx from address %08llx, expected %0*llx\n",
+                       op.line, 2*op.len, (unsigned long long)rdata, (unsigned long long)op.addr, 2*op.len, (unsigned long long)op.data);
+                return false;
+            }
+        }
+        break;
+
+    default:
+        if (rd_buf.size() < op.len)
+        {
+            rd_buf.resize(op.len);
+        }
+
+        uint8_t* data = (op.op == OP_BURST_WRITE) ? &pool[op.data] : rd_buf.data();
+        int      chunk;
+
+        for (uint32_t idx = 0; idx < op.len; idx += chunk)
+        {
+            uint64_t addr = op.addr + idx;
+
+            chunk = BURST_CHUNK_SIZE - (int)(addr & (BURST_CHUNK_SIZE - 1));
+            chunk = ((uint32_t)chunk < op.len - idx) ? chunk : (int)(op.len - idx);
+
+            if (rnw)
+            {
+                addr64 ? cosim.transBurstRead(addr, &data[idx], chunk) : cosim.transBurstRead((uint32_t)addr, &data[idx], chunk);
+            }
+            else
+            {
+                addr64 ? cosim.transBurstWrite(addr, &data[idx], chunk) : cosim.transBurstWrite((uint32_t)addr, &data[idx], chunk);
+            }
+        }
+
+        if (op.op == OP_BURST_READ_CHECK)
+        {
+            checks++;
+
+            for (uint32_t idx = 0; idx < op.len; idx++)
+            {
+                if (data[idx] != pool[op.data + idx])
+                {
+                    VPrint("OsvvmCosimReplay: ***ERROR line %d burst read %02x from address %08llx, expected %02x\n",
+                           op.line, data[idx], (unsigned long long)(op.addr + idx), pool[op.data + idx]);
+                    return false;
+                }
+            }
+        }
+        break;
+    }
+
+    return true;
+}
@@ -0,0 +1,161 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimReplay.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Class definition for an in-process replay engine for socket
+//      scripts (as sent by client_batch.py), called directly from
+//      VUserMain code with no socket or client in the loop. A script
+//      is memory mapped and pre-compiled into a compact list of
+//      operations, which are then run as bus transactions on a node,
+//      with any read data checked against expected values.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_COSIM_REPLAY_H_
+#define _OSVVM_COSIM_REPLAY_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "OsvvmCosim.h"
+
+// -------------------------------------------------------------------------
+// CLASS DEFINITION
+// -------------------------------------------------------------------------
+
+class OsvvmCosimReplay
+{
+    ////////////////////////////////
+    // PUBLIC
+    ////////////////////////////////
+
+public:
+           static const int  OSVVM_COSIM_OK        = 0;
+           static const int  OSVVM_COSIM_ERR       = -1;
+
+           // Options, all off by default. Reads with no expected data
+           // given are checked against the bytes written earlier in the
+           // script if REPLAY_CHECK_WRITTEN, and a run stops at the first
+           // read check failure if REPLAY_STOP_ON_ERROR.
+           static const int  REPLAY_CHECK_WRITTEN  = 0x1;
+           static const int  REPLAY_STOP_ON_ERROR  = 0x2;
+
+    // Constructor/destructor
+                             OsvvmCosimReplay (const int NodeNum = 0, const int Options = 0);
+                            ~OsvvmCosimReplay (void) {};
+
+    // Map and compile a script file, or compile a script already in
+    // memory, appending to any operations already compiled
+           int               Load             (const std::string FileName);
+           int               Compile          (const char* Script, const size_t Len);
+
+    // Run the compiled operations, returning the number of read check
+    // failures
+           int               Run              (void);
+
+           void              Clear            (void) {ops.clear(); pool.clear(); shadow.clear(); last_page = NULL;}
+
+    // Statistics
+           int               NumOps           (void) {return (int)ops.size();}
+           int               NumChecks        (void) {return checks;}
+           int               NumErrors        (void) {return errors;}
+
+    ////////////////////////////////
+    // PRIVATE
+    ////////////////////////////////
+
+private:
+
+           static const int  BURST_CHUNK_SIZE      = DATABUF_SIZE/2; // Must be a power of 2
+
+           static const int  SHADOW_PAGE_BITS      = 12;
+           static const int  SHADOW_PAGE_SIZE      = 1 << SHADOW_PAGE_BITS;
+
+           // Compiled operation types
+           enum {
+               OP_WRITE,
+               OP_READ,
+               OP_READ_CHECK,
+               OP_BURST_WRITE,
+               OP_BURST_READ,
+               OP_BURST_READ_CHECK
+           };
+
+           // A compiled operation. Data is the word write data or
+           // expected read data, or an offset into the data pool
+           // for burst write data or expected read data.
+           typedef struct {
+               uint64_t      addr;
+               uint64_t      data;
+               uint32_t      len;
+               uint32_t      line;
+               uint8_t       op;
+           } op_t;
+
+           // A page of written bytes, with a flag for each byte written
+           typedef struct {
+               uint8_t       data[SHADOW_PAGE_SIZE];
+               uint8_t       valid[SHADOW_PAGE_SIZE];
+           } shadow_page_t;
+
+    // Private methods
+           int               compile_line     (const char* buf, const char* end);
+           bool              run_op           (OsvvmCosim &cosim, const op_t &op);
+           shadow_page_t*    shadow_page      (const uint64_t addr, const bool alloc);
+
+    // Private member variables
+           int               node;
+           int               options;
+
+           std::vector<op_t>    ops;
+           std::vector<uint8_t> pool;
+           std::vector<uint8_t> rd_buf;
+
+           // Bytes written by the script so far, when compiling, for
+           // checking reads if REPLAY_CHECK_WRITTEN, in sparse pages
+           // indexed by page number, with the last page used cached
+           std::unordered_map<uint64_t, shadow_page_t> shadow;
+           uint64_t          last_page_num;
+           shadow_page_t*    last_page;
+
+           uint32_t          line_num;
+           int               checks;
+           int               errors;
+};
+
+#endif
@@ -16,6 +16,7 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Added respWaitAny and response latency table
 //    05/2023   2023.05    Initial revision
 //
 //
@@ -40,6 +41,7 @@
 #include <stdint.h>
 #include <string>
 #include "OsvvmVUser.h"
+#include "OsvvmCosimLatency.h"
 
 #ifndef __OSVVM_COSIM_RESP_H_
 #define __OSVVM_COSIM_RESP_H_
@@ -49,7 +51,7 @@ class OsvvmCosimResp
 public:
                 const int max_data_buf_size = DATABUF_SIZE;
 
-                OsvvmCosimResp (int nodeIn = 1, std::string test_name = "") : node(nodeIn) {
+                OsvvmCosimResp (int nodeIn = 1, std::string test_name = "") : latency(NULL), pendingRead(0), pendingWrite(0), node(nodeIn) {
                    if (test_name.compare(""))
                    {
                        VSetTestName(test_name.c_str(), test_name.length(), node);
@@ -64,70 +66,80 @@ public:
           VTick(ticks, false, error, node);
 #endif
       }
-      void      respGetWrite                 (uint32_t *addr, uint8_t*  data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint8_t) 0, &dummyStatus, 0, node);}
-      void      respGetWrite                 (uint32_t *addr, uint16_t* data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint16_t)0, &dummyStatus, 0, node);}
-      void      respGetWrite                 (uint32_t *addr, uint32_t* data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint32_t)0, &dummyStatus, 0, node);}
-      void      respGetWrite                 (uint64_t *addr, uint8_t*  data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint8_t)0,  &dummyStatus, 0, node);}
-      void      respGetWrite                 (uint64_t *addr, uint16_t* data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint16_t)0, &dummyStatus, 0, node);}
-      void      respGetWrite                 (uint64_t *addr, uint32_t* data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint32_t)0, &dummyStatus, 0, node);}
-      void      respGetWrite                 (uint64_t *addr, uint64_t* data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint64_t)0, &dummyStatus, 0, node);}
-
-      bool      respTryGetWrite              (uint32_t *addr, uint8_t*  data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint8_t) 0, &status, 0, node); return status;}
-      bool      respTryGetWrite              (uint32_t *addr, uint16_t* data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint16_t)0, &status, 0, node); return status;}
-      bool      respTryGetWrite              (uint32_t *addr, uint32_t* data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint32_t)0, &status, 0, node); return status;}
-      bool      respTryGetWrite              (uint64_t *addr, uint8_t*  data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint8_t)0,  &status, 0, node); return status;}
-      bool      respTryGetWrite              (uint64_t *addr, uint16_t* data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint16_t)0, &status, 0, node); return status;}
-      bool      respTryGetWrite              (uint64_t *addr, uint32_t* data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint32_t)0, &status, 0, node); return status;}
-      bool      respTryGetWrite              (uint64_t *addr, uint64_t* data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint64_t)0, &status, 0, node); return status;}
-
-      void      respGetWriteAddress          (uint32_t* addr)                     {VTransUserCommon(WRITE_ADDRESS, addr, (uint32_t)0, &dummyStatus, 0, node);}
-      void      respGetWriteAddress          (uint64_t* addr)                     {VTransUserCommon(WRITE_ADDRESS, addr, (uint64_t)0, &dummyStatus, 0, node);}
-
-      bool      respTryGetWriteAddress       (uint32_t* addr)                     {int status; VTransUserCommon(ASYNC_WRITE_ADDRESS, addr, (uint32_t)0, &status, 0, node); return status;}
-      bool      respTryGetWriteAddress       (uint64_t* addr)                     {int status; VTransUserCommon(ASYNC_WRITE_ADDRESS, addr, (uint64_t)0, &status, 0, node); return status;}
-
-      void      respGetWriteData             (uint8_t*  data)                     {*data = VTransUserCommon(WRITE_DATA, &dummyAddr32, (uint8_t)0,  &dummyStatus, 0, node);}
-      void      respGetWriteData             (uint16_t* data)                     {*data = VTransUserCommon(WRITE_DATA, &dummyAddr32, (uint16_t)0, &dummyStatus, 0, node);}
-      void      respGetWriteData             (uint32_t* data)                     {*data = VTransUserCommon(WRITE_DATA, &dummyAddr32, (uint32_t)0, &dummyStatus, 0, node);}
-      void      respGetWriteData             (uint64_t* data)                     {*data = VTransUserCommon(WRITE_DATA, &dummyAddr64, (uint64_t)0, &dummyStatus, 0, node);}
-
-      bool      respTryGetWriteData          (uint8_t*  data)                     {int status; *data = VTransUserCommon(ASYNC_WRITE_DATA, &dummyAddr32, (uint8_t)0,  &status, 0, node); return status;}
-      bool      respTryGetWriteData          (uint16_t* data)                     {int status; *data = VTransUserCommon(ASYNC_WRITE_DATA, &dummyAddr32, (uint16_t)0, &status, 0, node); return status;}
-      bool      respTryGetWriteData          (uint32_t* data)                     {int status; *data = VTransUserCommon(ASYNC_WRITE_DATA, &dummyAddr32, (uint32_t)0, &status, 0, node); return status;}
-      bool      respTryGetWriteData          (uint64_t* data)                     {int status; *data = VTransUserCommon(ASYNC_WRITE_DATA, &dummyAddr64, (uint64_t)0, &status, 0, node); return status;}
-
-
-      void      respSendRead                 (uint32_t* addr, uint8_t  data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node);}
-      void      respSendRead                 (uint32_t* addr, uint16_t data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node);}
-      void      respSendRead                 (uint32_t* addr, uint32_t data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node);}
-      void      respSendRead                 (uint64_t* addr, uint8_t  data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node);}
-      void      respSendRead                 (uint64_t* addr, uint16_t data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node);}
-      void      respSendRead                 (uint64_t* addr, uint32_t data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node);}
-      void      respSendRead                 (uint64_t* addr, uint64_t data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node);}
-
-      bool      respTrySendRead              (uint32_t* addr, uint8_t  data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node); return status;}
-      bool      respTrySendRead              (uint32_t* addr, uint16_t data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node); return status;}
-      bool      respTrySendRead              (uint32_t* addr, uint32_t data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node); return status;}
-      bool      respTrySendRead              (uint64_t* addr, uint8_t  data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node); return status;}
-      bool      respTrySendRead              (uint64_t* addr, uint16_t data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node); return status;}
-      bool      respTrySendRead              (uint64_t* addr, uint32_t data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node); return status;}
-      bool      respTrySendRead              (uint64_t* addr, uint64_t data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node); return status;}
-
-      void      respGetReadAddress           (uint32_t* addr)                     {VTransUserCommon(READ_ADDRESS, addr, (uint32_t)0, &dummyStatus, 0, node);}
-      void      respGetReadAddress           (uint64_t* addr)                     {VTransUserCommon(READ_ADDRESS, addr, (uint64_t)0, &dummyStatus, 0, node);}
-
-      bool      respTryGetReadAddress        (uint32_t* addr)                     {int status; VTransUserCommon(ASYNC_READ_ADDRESS, addr, (uint32_t)0, &status, 0, node); return status;}
-      bool      respTryGetReadAddress        (uint64_t* addr)                     {int status; VTransUserCommon(ASYNC_READ_ADDRESS, addr, (uint64_t)0, &status, 0, node); return status;}
-
-      void      respSendReadData             (uint8_t  data)                      {VTransUserCommon(READ_DATA, &dummyAddr32, data, &dummyStatus, 0, node);}
-      void      respSendReadData             (uint16_t data)                      {VTransUserCommon(READ_DATA, &dummyAddr32, data, &dummyStatus, 0, node);}
-      void      respSendReadData             (uint32_t data)                      {VTransUserCommon(READ_DATA, &dummyAddr32, data, &dummyStatus, 0, node);}
-      void      respSendReadData             (uint64_t data)                      {VTransUserCommon(READ_DATA, &dummyAddr64, data, &dummyStatus, 0, node);}
-
-      bool      respSendReadDataAsync        (uint8_t  data)                      {int status; VTransUserCommon(ASYNC_READ_DATA, &dummyAddr32, data, &status, 0, node); return status;}
-      bool      respSendReadDataAsync        (uint16_t data)                      {int status; VTransUserCommon(ASYNC_READ_DATA, &dummyAddr32, data, &status, 0, node); return status;}
-      bool      respSendReadDataAsync        (uint32_t data)                      {int status; VTransUserCommon(ASYNC_READ_DATA, &dummyAddr32, data, &status, 0, node); return status;}
-      bool      respSendReadDataAsync        (uint64_t data)                      {int status; VTransUserCommon(ASYNC_READ_DATA, &dummyAddr64, data, &status, 0, node); return status;}
+      void      respGetWrite                 (uint32_t *addr, uint8_t*  data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint8_t) 0, &dummyStatus, 0, node); writeLatency(*addr);}
+      void      respGetWrite                 (uint32_t *addr, uint16_t* data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint16_t)0, &dummyStatus, 0, node); writeLatency(*addr);}
+      void      respGetWrite                 (uint32_t *addr, uint32_t* data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint32_t)0, &dummyStatus, 0, node); writeLatency(*addr);}
+      void      respGetWrite                 (uint64_t *addr, uint8_t*  data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint8_t)0,  &dummyStatus, 0, node); writeLatency(*addr);}
+      void      respGetWrite                 (uint64_t *addr, uint16_t* data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint16_t)0, &dummyStatus, 0, node); writeLatency(*addr);}
+      void      respGetWrite                 (uint64_t *addr, uint32_t* data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint32_t)0, &dummyStatus, 0, node); writeLatency(*addr);}
+      void      respGetWrite                 (uint64_t *addr, uint64_t* data)     {*data = VTransUserCommon(WRITE_OP, addr, (uint64_t)0, &dummyStatus, 0, node); writeLatency(*addr);}
+
+      bool      respTryGetWrite              (uint32_t *addr, uint8_t*  data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint8_t) 0, &status, 0, node); if (status) writeLatency(*addr); return status;}
+      bool      respTryGetWrite              (uint32_t *addr, uint16_t* data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint16_t)0, &status, 0, node); if (status) writeLatency(*addr); return status;}
+      bool      respTryGetWrite              (uint32_t *addr, uint32_t* data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint32_t)0, &status, 0, node); if (status) writeLatency(*addr); return status;}
+      bool      respTryGetWrite              (uint64_t *addr, uint8_t*  data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint8_t)0,  &status, 0, node); if (status) writeLatency(*addr); return status;}
+      bool      respTryGetWrite              (uint64_t *addr, uint16_t* data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint16_t)0, &status, 0, node); if (status) writeLatency(*addr); return status;}
+      bool      respTryGetWrite              (uint64_t *addr, uint32_t* data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint32_t)0, &status, 0, node); if (status) writeLatency(*addr); return status;}
+      bool      respTryGetWrite              (uint64_t *addr, uint64_t* data)     {int status; *data = VTransUserCommon(ASYNC_WRITE, addr, (uint64_t)0, &status, 0, node); if (status) writeLatency(*addr); return status;}
+
+      void      respGetWriteAddress          (uint32_t* addr)                     {VTransUserCommon(WRITE_ADDRESS, addr, (uint32_t)0, &dummyStatus, 0, node); addLatency(*addr, false);}
+      void      respGetWriteAddress          (uint64_t* addr)                     {VTransUserCommon(WRITE_ADDRESS, addr, (uint64_t)0, &dummyStatus, 0, node); addLatency(*addr, false);}
+
+      bool      respTryGetWriteAddress       (uint32_t* addr)                     {int status; VTransUserCommon(ASYNC_WRITE_ADDRESS, addr, (uint32_t)0, &status, 0, node); if (status) addLatency(*addr, false); return status;}
+      bool      respTryGetWriteAddress       (uint64_t* addr)                     {int status; VTransUserCommon(ASYNC_WRITE_ADDRESS, addr, (uint64_t)0, &status, 0, node); if (status) addLatency(*addr, false); return status;}
+
+      void      respGetWriteData             (uint8_t*  data)                     {*data = VTransUserCommon(WRITE_DATA, &dummyAddr32, (uint8_t)0,  &dummyStatus, 0, node, takeLatency(false));}
+      void      respGetWriteData             (uint16_t* data)                     {*data = VTransUserCommon(WRITE_DATA, &dummyAddr32, (uint16_t)0, &dummyStatus, 0, node, takeLatency(false));}
+      void      respGetWriteData             (uint32_t* data)                     {*data = VTransUserCommon(WRITE_DATA, &dummyAddr32, (uint32_t)0, &dummyStatus, 0, node, takeLatency(false));}
+      void      respGetWriteData             (uint64_t* data)                     {*data = VTransUserCommon(WRITE_DATA, &dummyAddr64, (uint64_t)0, &dummyStatus, 0, node, takeLatency(false));}
+
+      bool      respTryGetWriteData          (uint8_t*  data)                     {int status; *data = VTransUserCommon(ASYNC_WRITE_DATA, &dummyAddr32, (uint8_t)0,  &status, 0, node, takeLatency(false)); return status;}
+      bool      respTryGetWriteData          (uint16_t* data)                     {int status; *data = VTransUserCommon(ASYNC_WRITE_DATA, &dummyAddr32, (uint16_t)0, &status, 0, node, takeLatency(false)); return status;}
+      bool      respTryGetWriteData          (uint32_t* data)                     {int status; *data = VTransUserCommon(ASYNC_WRITE_DATA, &dummyAddr32, (uint32_t)0, &status, 0, node, takeLatency(false)); return status;}
+      bool      respTryGetWriteData          (uint64_t* data)                     {int status; *data = VTransUserCommon(ASYNC_WRITE_DATA, &dummyAddr64, (uint64_t)0, &status, 0, node, takeLatency(false)); return status;}
+
+
+      void      respSendRead                 (uint32_t* addr, uint8_t  data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node, takeLatency(true));}
+      void      respSendRead                 (uint32_t* addr, uint16_t data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node, takeLatency(true));}
+      void      respSendRead                 (uint32_t* addr, uint32_t data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node, takeLatency(true));}
+      void      respSendRead                 (uint64_t* addr, uint8_t  data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node, takeLatency(true));}
+      void      respSendRead                 (uint64_t* addr, uint16_t data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node, takeLatency(true));}
+      void      respSendRead                 (uint64_t* addr, uint32_t data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node, takeLatency(true));}
+      void      respSendRead                 (uint64_t* addr, uint64_t data)      {VTransUserCommon(READ_OP, addr, data, &dummyStatus, 0, node, takeLatency(true));}
+
+      bool      respTrySendRead              (uint32_t* addr, uint8_t  data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node, takeLatency(true)); return status;}
+      bool      respTrySendRead              (uint32_t* addr, uint16_t data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node, takeLatency(true)); return status;}
+      bool      respTrySendRead              (uint32_t* addr, uint32_t data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node, takeLatency(true)); return status;}
+      bool      respTrySendRead              (uint64_t* addr, uint8_t  data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node, takeLatency(true)); return status;}
+      bool      respTrySendRead              (uint64_t* addr, uint16_t data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node, takeLatency(true)); return status;}
+      bool      respTrySendRead              (uint64_t* addr, uint32_t data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node, takeLatency(true)); return status;}
+      bool      respTrySendRead              (uint64_t* addr, uint64_t data)      {int status; VTransUserCommon(ASYNC_READ, addr, data, &status, 0, node, takeLatency(true)); return status;}
+
+      void      respGetReadAddress           (uint32_t* addr)                     {VTransUserCommon(READ_ADDRESS, addr, (uint32_t)0, &dummyStatus, 0, node); addLatency(*addr, true);}
+      void      respGetReadAddress           (uint64_t* addr)                     {VTransUserCommon(READ_ADDRESS, addr, (uint64_t)0, &dummyStatus, 0, node); addLatency(*addr, true);}
+
+      bool      respTryGetReadAddress        (uint32_t* addr)                     {int status; VTransUserCommon(ASYNC_READ_ADDRESS, addr, (uint32_t)0, &status, 0, node); if (status) addLatency(*addr, true); return status;}
+      bool      respTryGetReadAddress        (uint64_t* addr)                     {int status; VTransUserCommon(ASYNC_READ_ADDRESS, addr, (uint64_t)0, &status, 0, node); if (status) addLatency(*addr, true); return status;}
+
+      void      respSendReadData             (uint8_t  data)                      {VTransUserCommon(READ_DATA, &dummyAddr32, data, &dummyStatus, 0, node, takeLatency(true));}
+      void      respSendReadData             (uint16_t data)                      {VTransUserCommon(READ_DATA, &dummyAddr32, data, &dummyStatus, 0, node, takeLatency(true));}
+      void      respSendReadData             (uint32_t data)                      {VTransUserCommon(READ_DATA, &dummyAddr32, data, &dummyStatus, 0, node, takeLatency(true));}
+      void      respSendReadData             (uint64_t data)                      {VTransUserCommon(READ_DATA, &dummyAddr64, data, &dummyStatus, 0, node, takeLatency(true));}
+
+      bool      respSendReadDataAsync        (uint8_t  data)                      {int status; VTransUserCommon(ASYNC_READ_DATA, &dummyAddr32, data, &status, 0, node, takeLatency(true)); return status;}
+      bool      respSendReadDataAsync        (uint16_t data)                      {int status; VTransUserCommon(ASYNC_READ_DATA, &dummyAddr32, data, &status, 0, node, takeLatency(true)); return status;}
+      bool      respSendReadDataAsync        (uint32_t data)                      {int status; VTransUserCommon(ASYNC_READ_DATA, &dummyAddr32, data, &status, 0, node, takeLatency(true)); return status;}
+      bool      respSendReadDataAsync        (uint64_t data)                      {int status; VTransUserCommon(ASYNC_READ_DATA, &dummyAddr64, data, &status, 0, node, takeLatency(true)); return status;}
+
+      // Wait for a write or read address on either channel, returning WRITE_CHANNEL or READ_CHANNEL.
+      // Write data is returned in data, whilst a read must be completed with respSendReadData.
+      int       respWaitAny                  (uint32_t* addr, uint8_t*  data)     {int ch = VTransUserWaitAny(addr, data, node); if (ch == READ_CHANNEL) addLatency(*addr, true); else if (ch) writeLatency(*addr); return ch;}
+      int       respWaitAny                  (uint32_t* addr, uint16_t* data)     {int ch = VTransUserWaitAny(addr, data, node); if (ch == READ_CHANNEL) addLatency(*addr, true); else if (ch) writeLatency(*addr); return ch;}
+      int       respWaitAny                  (uint32_t* addr, uint32_t* data)     {int ch = VTransUserWaitAny(addr, data, node); if (ch == READ_CHANNEL) addLatency(*addr, true); else if (ch) writeLatency(*addr); return ch;}
+      int       respWaitAny                  (uint64_t* addr, uint8_t*  data)     {int ch = VTransUserWaitAny(addr, data, node); if (ch == READ_CHANNEL) addLatency(*addr, true); else if (ch) writeLatency(*addr); return ch;}
+      int       respWaitAny                  (uint64_t* addr, uint16_t* data)     {int ch = VTransUserWaitAny(addr, data, node); if (ch == READ_CHANNEL) addLatency(*addr, true); else if (ch) writeLatency(*addr); return ch;}
+      int       respWaitAny                  (uint64_t* addr, uint32_t* data)     {int ch = VTransUserWaitAny(addr, data, node); if (ch == READ_CHANNEL) addLatency(*addr, true); else if (ch) writeLatency(*addr); return ch;}
+      int       respWaitAny                  (uint64_t* addr, uint64_t* data)     {int ch = VTransUserWaitAny(addr, data, node); if (ch == READ_CHANNEL) addLatency(*addr, true); else if (ch) writeLatency(*addr); return ch;}
 
       void      respWaitForTransaction       (void)                               {VTransTransactionWait(WAIT_FOR_TRANSACTION,       node);}
       void      respWaitForWriteTransaction  (void)                               {VTransTransactionWait(WAIT_FOR_WRITE_TRANSACTION, node);}
@@ -137,12 +149,28 @@ public:
       int       respGetWriteTransactionCount (void)                               {return VTransGetCount(GET_WRITE_TRANSACTION_COUNT, node);}
       int       respGetReadTransactionCount  (void)                               {return VTransGetCount(GET_READ_TRANSACTION_COUNT,  node);}
 
+      // Register a table of latencies, by address range, applied to responses on this node. The latency
+      // for a received read address is inserted in the simulation before that read's data response
+      // (respSendReadData), and for a received write address before that write's data (respGetWriteData),
+      // so that no per-cycle exchanges are required. The combined respSendRead and respTrySendRead do not
+      // know their address in advance and so only absorb any outstanding read latency. A write received
+      // whole (respGetWrite, respTryGetWrite or respWaitAny) has already been answered by the model, so
+      // its latency is ticked straight away, delaying the responder's next operation.
+      void      respSetLatencyTable          (OsvvmCosimLatency* tbl)             {latency = tbl; pendingRead = 0; pendingWrite = 0;}
+
       void      waitForSim                   (void)                               {VWaitForSim(node);}
 
       int       getNodeNumber                (void)                               {return node;}
 
 private:
 
+      int       takeLatency                  (const bool rnw)                     {int& pending = rnw ? pendingRead : pendingWrite; int ticks = pending; pending = 0; return ticks;}
+      void      addLatency                   (const uint64_t addr, const bool rnw){if (latency != NULL) (rnw ? pendingRead : pendingWrite) += latency->getLatency(addr, rnw);}
+      void      writeLatency                 (const uint64_t addr)                {int ticks = (latency != NULL) ? latency->getLatency(addr, false) : 0; if (ticks) VTick(ticks, false, false, node);}
+
+      OsvvmCosimLatency* latency;
+      int      pendingRead;
+      int      pendingWrite;
       int      dummyStatus;
       uint32_t dummyAddr32;
       uint64_t dummyAddr64;
@@ -0,0 +1,447 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimScoreboard.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Simulator co-simulation C++ class for a tagged scoreboard of
+//      expected items, matched against actuals in constant time via
+//      open addressing hash tables of fixed capacity. Items for a tag
+//      may be required in order, or matched out of order by value.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdint.h>
+#include <vector>
+
+#include "OsvvmVUser.h"
+
+#ifndef __OSVVM_COSIM_SCOREBOARD_H_
+#define __OSVVM_COSIM_SCOREBOARD_H_
+
+class OsvvmCosimScoreboard
+{
+public:
+
+      // Matching modes. In order checks each actual against the oldest
+      // expected item for its tag, which is removed whether or not it
+      // matches. Out of order matches an actual against any outstanding
+      // expected item for its tag with the same value.
+      typedef enum sb_mode_e
+      {
+          SB_IN_ORDER,
+          SB_OUT_OF_ORDER
+      } sb_mode_t;
+
+      // Default maximum number of outstanding expected items, and depth of
+      // the record of matched items kept for detecting duplicates
+      static const uint32_t default_max_items    = 64 * 1024;
+      static const uint32_t default_retire_depth = 4 * 1024;
+
+      // Number of individual errors reported before only being counted
+      static const uint32_t max_reported_errors  = 10;
+
+                OsvvmCosimScoreboard (const sb_mode_t mode        = SB_OUT_OF_ORDER,
+                                      const uint32_t  maxitems    = default_max_items,
+                                      const uint32_t  retiredepth = default_retire_depth,
+                                      const char*     name        = "OsvvmCosimScoreboard") :
+                    sbmode(mode), max_items(maxitems), sbname(name),
+                    items(tableSize(maxitems)), tags(tableSize(maxitems)),
+                    retired(tableSize(retiredepth)), retire_ring(retiredepth ? retiredepth : 1), retire_head(0)
+                {
+                    clear();
+                };
+
+      // -------------------------------------------------------------------------
+      // push()
+      //
+      // Add an expected item, with the given tag, returning false if the
+      // scoreboard already holds the maximum number of outstanding items.
+      // A burst of bytes is stored as a 64 bit digest of its contents.
+      //
+      // -------------------------------------------------------------------------
+
+      bool push (const uint64_t tag, const uint64_t value)
+      {
+          if (outstanding >= max_items)
+          {
+              overflows++;
+              reportError("push overflow for tag", tag, value, 0);
+              return false;
+          }
+
+          if (sbmode == SB_IN_ORDER)
+          {
+              // Items keyed on tag and per-tag sequence number
+              entry_t* tagent = tags.insert(tag, 0);
+
+              items.insert(tag, tagent->val2++)->val1 = value;
+          }
+          else
+          {
+              // Items keyed on tag and value, with a count of identical items,
+              // and a count of all the tag's items
+              items.insert(tag, value)->val1++;
+              tags.insert(tag, 0)->val1++;
+          }
+
+          outstanding++;
+          pushed++;
+
+          return true;
+      }
+
+      bool push (const uint64_t tag, const uint8_t* data, const int len)  {return push(tag, digest(data, len));}
+
+      // -------------------------------------------------------------------------
+      // check()
+      //
+      // Check an actual item, with the given tag, against the expected items,
+      // returning true on a match. An actual with no outstanding item to
+      // match against is counted as a duplicate if it matches a recently
+      // matched item, else as unexpected.
+      //
+      // -------------------------------------------------------------------------
+
+      bool check (const uint64_t tag, const uint64_t value)
+      {
+          entry_t* ent = NULL;
+
+          if (sbmode == SB_IN_ORDER)
+          {
+              entry_t* tagent = tags.find(tag, 0);
+
+              if (tagent != NULL)
+              {
+                  // Head sequence number in val1 and next push sequence number in val2
+                  uint64_t seq = tagent->val1++;
+
+                  ent = items.find(tag, seq);
+                  uint64_t expvalue = ent->val1;
+
+                  items.erase(ent);
+
+                  if (tagent->val1 == tagent->val2)
+                  {
+                      tags.erase(tagent);
+                  }
+
+                  outstanding--;
+
+                  if (expvalue != value)
+                  {
+                      mismatches++;
+                      reportError("mismatch for tag", tag, value, expvalue);
+                      return false;
+                  }
+              }
+          }
+          else
+          {
+              ent = items.find(tag, value);
+
+              if (ent != NULL)
+              {
+                  entry_t* tagent = tags.find(tag, 0);
+
+                  if (--ent->val1 == 0)
+                  {
+                      items.erase(ent);
+                  }
+
+                  if (--tagent->val1 == 0)
+                  {
+                      tags.erase(tagent);
+                  }
+
+                  outstanding--;
+              }
+              // An actual for a tag with items outstanding, but not of this value, is a mismatch
+              else if (tags.find(tag, 0) != NULL)
+              {
+                  mismatches++;
+                  reportError("no matching value for tag", tag, value, 0);
+                  return false;
+              }
+          }
+
+          if (ent == NULL)
+          {
+              if (retired.find(tag, value) != NULL)
+              {
+                  duplicates++;
+                  reportError("duplicate for tag", tag, value, value);
+              }
+              else
+              {
+                  unexpected++;
+                  reportError("unexpected item for tag", tag, value, 0);
+              }
+              return false;
+          }
+
+          retire(tag, value);
+          matches++;
+
+          return true;
+      }
+
+      bool check (const uint64_t tag, const uint8_t* data, const int len) {return check(tag, digest(data, len));}
+
+      // -------------------------------------------------------------------------
+      // summary()
+      //
+      // Print a summary of the scoreboard's counts, with any items still
+      // outstanding counted as dropped, and return true if there were no
+      // errors of any kind.
+      //
+      // -------------------------------------------------------------------------
+
+      bool summary (void)
+      {
+          bool pass = errors() == 0;
+
+          VPrint("%s: %s pushed=%llu matched=%llu mismatched=%llu duplicates=%llu unexpected=%llu dropped=%llu overflows=%llu\n",
+                 sbname, pass ? "PASSED" : "***ERROR: FAILED",
+                 (unsigned long long)pushed,     (unsigned long long)matches,
+                 (unsigned long long)mismatches, (unsigned long long)duplicates,
+                 (unsigned long long)unexpected, (unsigned long long)outstanding,
+                 (unsigned long long)overflows);
+
+          return pass;
+      }
+
+      uint64_t numPushed     (void)        {return pushed;}
+      uint64_t numMatched    (void)        {return matches;}
+      uint64_t numMismatched (void)        {return mismatches;}
+      uint64_t numDuplicates (void)        {return duplicates;}
+      uint64_t numUnexpected (void)        {return unexpected;}
+      uint64_t numDropped    (void)        {return outstanding;}
+      uint64_t numOverflows  (void)        {return overflows;}
+      uint64_t errors        (void)        {return mismatches + duplicates + unexpected + outstanding + overflows;}
+
+      void clear (void)
+      {
+          items.clear();
+          tags.clear();
+          retired.clear();
+
+          for (uint32_t idx = 0; idx < retire_ring.size(); idx++)
+          {
+              retire_ring[idx].used = false;
+          }
+
+          retire_head = 0;
+          outstanding = pushed = matches = mismatches = duplicates = unexpected = overflows = 0;
+          reported    = 0;
+      }
+
+      // FNV-1a 64 bit digest of a burst of bytes, including its length
+      static uint64_t digest (const uint8_t* data, const int len)
+      {
+          uint64_t hash = 0xcbf29ce484222325ULL ^ (uint64_t)len;
+
+          for (int idx = 0; idx < len; idx++)
+          {
+              hash = (hash ^ data[idx]) * 0x100000001b3ULL;
+          }
+
+          return hash;
+      }
+
+private:
+
+      // Hash table entry, keyed on key1 and key2, with two values
+      typedef struct
+      {
+          uint64_t key1;
+          uint64_t key2;
+          uint64_t val1;
+          uint64_t val2;
+          bool     used;
+      } entry_t;
+
+      // Key of a matched item in the retire ring
+      typedef struct
+      {
+          uint64_t tag;
+          uint64_t value;
+          bool     used;
+      } retire_t;
+
+      // Table size, as a power of 2 of at least twice the number of entries, for a load of 0.5 or less
+      static uint32_t tableSize (const uint32_t entries)
+      {
+          uint32_t size = 2;
+
+          while (size < 2 * entries)
+          {
+              size <<= 1;
+          }
+
+          return size;
+      }
+
+      // -------------------------------------------------------------------------
+      // Open addressing hash table, with linear probing and backward shift
+      // deletion, so no tombstones build up with use. Never more than half
+      // full, so probe sequences are short and always end at an empty slot.
+      // -------------------------------------------------------------------------
+
+      class hash_table_t
+      {
+      public:
+                   hash_table_t (const uint32_t size) : tbl(size), mask(size - 1) {clear();};
+
+          void     clear (void)                    {for (uint32_t idx = 0; idx <= mask; idx++) tbl[idx].used = false;}
+
+          entry_t* find (const uint64_t key1, const uint64_t key2)
+          {
+              for (uint32_t idx = hash(key1, key2); tbl[idx].used; idx = (idx + 1) & mask)
+              {
+                  if (tbl[idx].key1 == key1 && tbl[idx].key2 == key2)
+                  {
+                      return &tbl[idx];
+                  }
+              }
+
+              return NULL;
+          }
+
+          // Return the entry for the keys, adding one with zero values if not present
+          entry_t* insert (const uint64_t key1, const uint64_t key2)
+          {
+              uint32_t idx = hash(key1, key2);
+
+              for (; tbl[idx].used; idx = (idx + 1) & mask)
+              {
+                  if (tbl[idx].key1 == key1 && tbl[idx].key2 == key2)
+                  {
+                      return &tbl[idx];
+                  }
+              }
+
+              tbl[idx].key1 = key1;
+              tbl[idx].key2 = key2;
+              tbl[idx].val1 = 0;
+              tbl[idx].val2 = 0;
+              tbl[idx].used = true;
+
+              return &tbl[idx];
+          }
+
+          void erase (entry_t* ent)
+          {
+              uint32_t hole = ent - &tbl[0];
+
+              // Shift back any following entries in the probe run that may fill the hole
+              for (uint32_t idx = (hole + 1) & mask; tbl[idx].used; idx = (idx + 1) & mask)
+              {
+                  uint32_t home = hash(tbl[idx].key1, tbl[idx].key2);
+
+                  if (((idx - home) & mask) >= ((idx - hole) & mask))
+                  {
+                      tbl[hole] = tbl[idx];
+                      hole      = idx;
+                  }
+              }
+
+              tbl[hole].used = false;
+          }
+
+      private:
+          uint32_t hash (const uint64_t key1, const uint64_t key2)
+          {
+              uint64_t h = key1 * 0x9e3779b97f4a7c15ULL ^ (key2 + 0x632be59bd9b4e019ULL + (key1 << 6) + (key1 >> 2));
+
+              h ^= h >> 33;
+              h *= 0xff51afd7ed558ccdULL;
+              h ^= h >> 33;
+
+              return (uint32_t)h & mask;
+          }
+
+          std::vector<entry_t> tbl;
+          uint32_t             mask;
+      };
+
+      // Record a matched item, replacing the oldest record when full
+      void retire (const uint64_t tag, const uint64_t value)
+      {
+          retire_t& slot = retire_ring[retire_head];
+
+          if (slot.used)
+          {
+              entry_t* ent = retired.find(slot.tag, slot.value);
+
+              if (ent != NULL && --ent->val1 == 0)
+              {
+                  retired.erase(ent);
+              }
+          }
+
+          slot.tag    = tag;
+          slot.value  = value;
+          slot.used   = true;
+          retire_head = (retire_head + 1) % retire_ring.size();
+
+          retired.insert(tag, value)->val1++;
+      }
+
+      void reportError (const char* msg, const uint64_t tag, const uint64_t value, const uint64_t expvalue)
+      {
+          if (reported++ < max_reported_errors)
+          {
+              VPrint("***ERROR: %s: %s 0x%llx. Got 0x%llx, exp 0x%llx\n", sbname, msg,
+                     (unsigned long long)tag, (unsigned long long)value, (unsigned long long)expvalue);
+          }
+      }
+
+      const sb_mode_t       sbmode;
+      const uint64_t        max_items;
+      const char*           sbname;
+
+      hash_table_t          items;
+      hash_table_t          tags;
+      hash_table_t          retired;
+      std::vector<retire_t> retire_ring;
+      uint32_t              retire_head;
+
+      uint64_t              outstanding;
+      uint64_t              pushed;
+      uint64_t              matches;
+      uint64_t              mismatches;
+      uint64_t              duplicates;
+      uint64_t              unexpected;
+      uint64_t              overflows;
+      uint32_t              reported;
+};
+
+#endif
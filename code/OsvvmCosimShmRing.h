@@ -0,0 +1,473 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimShmRing.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Simulator co-simulation C++ class for a shared memory host
+//      connection, as a pair of byte stream ring buffers (one in each
+//      direction) in a named POSIX shared memory object. The simulation
+//      side creates the object and waits for a single host process to
+//      attach, after which each side writes to one ring and reads from
+//      the other, with the same byte stream semantics as a socket.
+//
+//      Each ring has free running read and write indexes, and a doorbell
+//      word for each, on which a blocked reader or writer sleeps (using
+//      a futex) after a short spin on multiprocessor hosts, and which the
+//      other side rings when it has moved its index, only making a system
+//      call if there is a sleeper. Linux only.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <atomic>
+#include <string>
+
+#if defined (__linux__)
+# include <unistd.h>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <sys/syscall.h>
+# include <linux/futex.h>
+#endif
+
+#ifndef __OSVVM_COSIM_SHM_RING_H_
+#define __OSVVM_COSIM_SHM_RING_H_
+
+class OsvvmCosimShmRing
+{
+public:
+      // Size of each ring, in bytes (must be a power of 2)
+      static const uint32_t ring_size     = 64 * 1024;
+
+      // Number of polls of an index before sleeping on its doorbell, when
+      // the other side can be running at the same time
+      static const int      spin_count    = 4000;
+
+                OsvvmCosimShmRing () : region(NULL), fd(-1), server(false) {};
+               ~OsvvmCosimShmRing () {detach();};
+
+#if defined (__linux__)
+
+      // -------------------------------------------------------------------------
+      // create()
+      //
+      // Create the named shared memory object (replacing any stale one of
+      // the same name), map it, and open it for a host to attach. Returns
+      // 0 on success, else -1.
+      //
+      // -------------------------------------------------------------------------
+
+      int create (const std::string &name)
+      {
+          shm_unlink(name.c_str());
+
+          if ((fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600)) < 0)
+          {
+              return -1;
+          }
+
+          if (ftruncate(fd, sizeof(region_t)) < 0 || mapRegion() < 0)
+          {
+              detach();
+              shm_unlink(name.c_str());
+              return -1;
+          }
+
+          shm_name = name;
+          server   = true;
+
+          region->size = ring_size;
+          region->state.store(STATE_LISTEN);
+          region->magic.store(shm_magic, std::memory_order_release);
+
+          return 0;
+      }
+
+      // -------------------------------------------------------------------------
+      // accept()
+      //
+      // Wait for a host to attach to a created region. The object's name is
+      // then removed, so no other host can attach, whilst the mapping remains.
+      // Returns 0 when attached, else -1.
+      //
+      // -------------------------------------------------------------------------
+
+      int accept (void)
+      {
+          uint32_t state;
+
+          if (region == NULL || !server)
+          {
+              return -1;
+          }
+
+          while ((state = region->state.load()) == STATE_LISTEN)
+          {
+              futexWait(region->state, STATE_LISTEN);
+          }
+
+          shm_unlink(shm_name.c_str());
+
+          return (state == STATE_ATTACHED) ? 0 : -1;
+      }
+
+      // -------------------------------------------------------------------------
+      // attach()
+      //
+      // Attach, as the host, to the named shared memory object created by the
+      // simulation. Returns 0 on success, else -1 if it does not exist, is not
+      // yet ready, or already has a host attached.
+      //
+      // -------------------------------------------------------------------------
+
+      int attach (const std::string &name)
+      {
+          struct stat st;
+          uint32_t    state = STATE_LISTEN;
+
+          if ((fd = shm_open(name.c_str(), O_RDWR, 0600)) < 0)
+          {
+              return -1;
+          }
+
+          if (fstat(fd, &st) < 0 || st.st_size < (off_t)sizeof(region_t) || mapRegion() < 0)
+          {
+              detach();
+              return -1;
+          }
+
+          if (region->magic.load(std::memory_order_acquire) != shm_magic || region->size != ring_size ||
+              !region->state.compare_exchange_strong(state, STATE_ATTACHED))
+          {
+              munmap(region, sizeof(region_t));
+              region = NULL;
+              detach();
+              return -1;
+          }
+
+          futexWake(region->state);
+
+          return 0;
+      }
+
+      // -------------------------------------------------------------------------
+      // read()
+      //
+      // Read up to maxlen bytes that are available from the receive ring
+      // into buf, waiting until there are some. Returns the number of bytes
+      // read, 0 if the other side has detached with no more to read, or -1
+      // if not attached.
+      //
+      // -------------------------------------------------------------------------
+
+      int read (void* buf, const uint32_t maxlen)
+      {
+          if (region == NULL)
+          {
+              return -1;
+          }
+
+          ring_t*  rx = &region->ring[server ? 0 : 1];
+          uint32_t rd = rx->rd_idx.load(std::memory_order_relaxed);
+
+          if (!waitChange(rx->wr_idx, rd, rx->wr_bell, rx->wr_waiters))
+          {
+              return 0;
+          }
+
+          uint32_t avail = rx->wr_idx.load(std::memory_order_acquire) - rd;
+          uint32_t pos   = rd & (ring_size-1);
+          uint32_t len   = (avail < maxlen) ? avail : maxlen;
+          uint32_t first = (len < ring_size - pos) ? len : ring_size - pos;
+
+          memcpy(buf, &rx->buf[pos], first);
+          memcpy((uint8_t*)buf + first, rx->buf, len - first);
+
+          rx->rd_idx.store(rd + len);
+          ring(rx->rd_bell, rx->rd_waiters);
+
+          return len;
+      }
+
+      // -------------------------------------------------------------------------
+      // write()
+      //
+      // Write len bytes from buf to the transmit ring, waiting for space as
+      // necessary. Returns false if not attached or the other side detaches.
+      //
+      // -------------------------------------------------------------------------
+
+      bool write (const void* buf, const uint32_t len)
+      {
+          if (region == NULL)
+          {
+              return false;
+          }
+
+          ring_t*  tx = &region->ring[server ? 1 : 0];
+          uint32_t wr = tx->wr_idx.load(std::memory_order_relaxed);
+
+          for (uint32_t idx = 0; idx < len; )
+          {
+              // Wait for the reader to move on if full
+              if (wr - tx->rd_idx.load(std::memory_order_acquire) == ring_size &&
+                  !waitChange(tx->rd_idx, wr - ring_size, tx->rd_bell, tx->rd_waiters))
+              {
+                  return false;
+              }
+
+              if (region->state.load() != STATE_ATTACHED)
+              {
+                  return false;
+              }
+
+              uint32_t space = ring_size - (wr - tx->rd_idx.load(std::memory_order_acquire));
+              uint32_t pos   = wr & (ring_size-1);
+              uint32_t chunk = (len - idx < space) ? len - idx : space;
+              uint32_t first = (chunk < ring_size - pos) ? chunk : ring_size - pos;
+
+              memcpy(&tx->buf[pos], (const uint8_t*)buf + idx, first);
+              memcpy(tx->buf, (const uint8_t*)buf + idx + first, chunk - first);
+
+              wr  += chunk;
+              idx += chunk;
+
+              tx->wr_idx.store(wr);
+              ring(tx->wr_bell, tx->wr_waiters);
+          }
+
+          return true;
+      }
+
+      // -------------------------------------------------------------------------
+      // detach()
+      //
+      // Close the connection, waking any sleeper on the other side, and unmap
+      // the region. A simulation side region's name is removed if no host
+      // had attached.
+      //
+      // -------------------------------------------------------------------------
+
+      void detach (void)
+      {
+          if (region != NULL)
+          {
+              if (region->state.exchange(STATE_CLOSED) == STATE_LISTEN && server)
+              {
+                  shm_unlink(shm_name.c_str());
+              }
+
+              wakeAll();
+
+              munmap(region, sizeof(region_t));
+              region = NULL;
+          }
+
+          if (fd >= 0)
+          {
+              ::close(fd);
+              fd = -1;
+          }
+      }
+
+      // -------------------------------------------------------------------------
+      // shutdown()
+      //
+      // Close the connection, waking any sleepers, but leave the region
+      // mapped, so that another thread blocked in read() or write() can
+      // safely return before detach() is called.
+      //
+      // -------------------------------------------------------------------------
+
+      void shutdown (void)
+      {
+          if (region != NULL)
+          {
+              region->state.store(STATE_CLOSED);
+
+              wakeAll();
+          }
+      }
+
+#else
+
+      // Shared memory connections are not supported on this platform
+      int  create (const std::string &name)             {return -1;}
+      int  accept (void)                                {return -1;}
+      int  attach (const std::string &name)             {return -1;}
+      int  read   (void* buf, const uint32_t maxlen)    {return -1;}
+      bool write  (const void* buf, const uint32_t len) {return false;}
+      void detach (void)                                {}
+      void shutdown (void)                              {}
+
+#endif
+
+      bool      attached    (void)        {return region != NULL && region->state.load() == STATE_ATTACHED;}
+
+private:
+
+      static const uint32_t shm_magic     = 0x4f534852; // "OSHR"
+
+      // Region connection states
+      static const uint32_t STATE_LISTEN   = 1;
+      static const uint32_t STATE_ATTACHED = 2;
+      static const uint32_t STATE_CLOSED   = 3;
+
+      // A byte stream ring, with each index, its doorbell and count of
+      // sleepers on the doorbell in separate cache lines
+      typedef struct
+      {
+          std::atomic<uint32_t> wr_idx;
+          std::atomic<uint32_t> wr_bell;
+          std::atomic<uint32_t> wr_waiters;
+          uint8_t               wr_pad[52];
+
+          std::atomic<uint32_t> rd_idx;
+          std::atomic<uint32_t> rd_bell;
+          std::atomic<uint32_t> rd_waiters;
+          uint8_t               rd_pad[52];
+
+          uint8_t               buf[ring_size];
+      } ring_t;
+
+      // Shared memory layout, with the host to simulation ring first
+      typedef struct
+      {
+          std::atomic<uint32_t> magic;
+          std::atomic<uint32_t> state;
+          uint32_t              size;
+          uint8_t               pad[52];
+
+          ring_t                ring[2];
+      } region_t;
+
+#if defined (__linux__)
+
+      int mapRegion (void)
+      {
+          void* addr = mmap(NULL, sizeof(region_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+          if (addr == MAP_FAILED)
+          {
+              return -1;
+          }
+
+          region = (region_t*)addr;
+
+          return 0;
+      }
+
+      // Sleep on a (process shared) doorbell word while it has the value val
+      static void futexWait (std::atomic<uint32_t> &bell, const uint32_t val)
+      {
+          syscall(SYS_futex, (uint32_t*)&bell, FUTEX_WAIT, val, NULL, NULL, 0);
+      }
+
+      static void futexWake (std::atomic<uint32_t> &bell)
+      {
+          syscall(SYS_futex, (uint32_t*)&bell, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+      }
+
+      // Ring a doorbell, waking any sleepers on it
+      static void ring (std::atomic<uint32_t> &bell, std::atomic<uint32_t> &waiters)
+      {
+          bell.fetch_add(1);
+
+          if (waiters.load() != 0)
+          {
+              futexWake(bell);
+          }
+      }
+
+      // Wake all sleepers, on the connection state and both rings' doorbells
+      void wakeAll (void)
+      {
+          futexWake(region->state);
+
+          for (int idx = 0; idx < 2; idx++)
+          {
+              ring(region->ring[idx].wr_bell, region->ring[idx].wr_waiters);
+              ring(region->ring[idx].rd_bell, region->ring[idx].rd_waiters);
+          }
+      }
+
+      // Wait until an index no longer has the value val, returning false if
+      // the connection closes first. The doorbell value is sampled, and the
+      // sleeper counted, before the index is checked a final time, so that
+      // a ring between the check and sleeping is never lost.
+      bool waitChange (std::atomic<uint32_t> &idx, const uint32_t val,
+                       std::atomic<uint32_t> &bell, std::atomic<uint32_t> &waiters)
+      {
+          // Only spin when there is more than one processor, as the other side
+          // cannot move the index whilst this side occupies the only one
+          static const int spins = (sysconf(_SC_NPROCESSORS_ONLN) > 1) ? spin_count : 0;
+
+          for (int count = 0; count < spins; count++)
+          {
+              if (idx.load(std::memory_order_acquire) != val)
+              {
+                  return true;
+              }
+#if defined (__x86_64__) || defined (__i386__)
+              __builtin_ia32_pause();
+#endif
+          }
+
+          while (true)
+          {
+              uint32_t rung = bell.load();
+
+              waiters.fetch_add(1);
+
+              if (idx.load() != val || region->state.load() != STATE_ATTACHED)
+              {
+                  waiters.fetch_sub(1);
+                  return idx.load() != val;
+              }
+
+              futexWait(bell, rung);
+
+              waiters.fetch_sub(1);
+          }
+      }
+
+#endif
+
+      region_t*             region;
+      int                   fd;
+      bool                  server;
+      std::string           shm_name;
+};
+
+#endif
@@ -15,6 +15,14 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Buffered socket reads and single send responses,
+//                         support for derived multi-client server,
+//                         negotiated binary protocol, any length
+//                         memory packets (m, M, x and X) as bursts,
+//                         Unix domain socket and shared memory
+//                         transports, pipelined no-ack mode, an
+//                         asynchronous network I/O thread, and
+//                         interrupt notifications
 //    10/2022   2023.01    Initial revision
 //
 //
@@ -41,6 +49,7 @@
 // -------------------------------------------------------------------------
 
 #include <signal.h>
+#include <string.h>
 #include <errno.h>
 #include <fcntl.h>
 
@@ -62,15 +71,17 @@
 // INCLUDES (Linux)
 // -------------------------------------------------------------------------
 
-# include <string.h>
 # include <unistd.h>
 # include <sys/types.h>
 # include <sys/socket.h>
+# include <sys/un.h>
 # include <netinet/in.h>
+# include <netinet/tcp.h>
 # include <termios.h>
 #endif
 
 #include "OsvvmCosim.h"
+#include "OsvvmCosimStream.h"
 #include "OsvvmCosimSktHdr.h"
 #include "OsvvmCosimSkt.h"
 
@@ -83,6 +94,10 @@
 // -------------------------------------------------------------------------
 
 const char OsvvmCosimSkt::HEXCHARS[HEX_BUF_SIZE] = "0123456789abcdef";
+const char OsvvmCosimSkt::BIN_NEGOTIATE_STR[]    = "OsvvmBinary";
+const char OsvvmCosimSkt::NOACK_START_STR[]      = "StartNoAckMode";
+const char OsvvmCosimSkt::INT_NOTIFY_STR[]       = "OsvvmInterrupts";
+const char OsvvmCosimSkt::INT_EVENT_STR[]        = "Interrupt:";
 
 // -------------------------------------------------------------------------
 // STATIC VARIABLES
@@ -93,14 +108,28 @@ OsvvmCosimSkt::OsvvmCosimSkt (const int  NodeNum,
                               const bool LittleEndian,
                               const char Eop,
                               const char Sop,
-                              const int  SfxBytes) :
-    node(NodeNum),
-    portnum(PortNumber),
-    ack_char(GDB_ACK_CHAR),
+                              const int  SfxBytes,
+                              const int  Transport,
+                              const std::string Path,
+                              const bool Connect) :
+    little_endian(LittleEndian),
     sop_char(Sop),
     eop_char(Eop),
-    little_endian(LittleEndian),
-    suffix_bytes(SfxBytes)
+    suffix_bytes(SfxBytes),
+    coalesce(true),
+    skt_hdl(-1),
+    portnum(PortNumber),
+    transport(Transport),
+    path(Path),
+    rx_rd_idx(0),
+    rx_wr_idx(0),
+    binary(false),
+    no_ack(false),
+    async_io(false),
+    io_status(OSVVM_COSIM_OK),
+    int_notify(false),
+    ack_char(GDB_ACK_CHAR),
+    node(NodeNum)
 {
 
     if (init() < 0)
@@ -109,10 +138,34 @@ OsvvmCosimSkt::OsvvmCosimSkt (const int  NodeNum,
         exit(1);
     }
 
-    // Create a TCP/IP socket
-    if ((skt_hdl = connect_skt(portnum)) < 0)
+    // Default the Unix domain socket path, or shared memory object name, from the port number
+    if (path.empty() && transport != OSVVM_COSIM_TCP)
     {
-        VPrint("osvvm_cosim_skt: ***ERROR creating a TCP/IP socket. Exiting...\n");
+        char name[64];
+        sprintf(name, (transport == OSVVM_COSIM_SHM) ? OSVVM_COSIM_SHM_NAME_FMT : OSVVM_COSIM_UNIX_PATH_FMT, portnum);
+        path = name;
+    }
+
+    // Create the host connection, unless a derived server manages its own connections
+    if (Connect && transport == OSVVM_COSIM_SHM)
+    {
+        if (shm.create(path) < 0)
+        {
+            VPrint("osvvm_cosim_skt: ***ERROR creating shared memory %s. Exiting...\n", path.c_str());
+            exit(2);
+        }
+
+        VPrint("OSVVM_COSIM_SKT: Using shared memory: %s\n", path.c_str());
+
+        if (shm.accept() < 0)
+        {
+            VPrint("osvvm_cosim_skt: ***ERROR on shared memory attach. Exiting...\n");
+            exit(2);
+        }
+    }
+    else if (Connect && (skt_hdl = connect_skt(portnum)) < 0)
+    {
+        VPrint("osvvm_cosim_skt: ***ERROR creating a %s socket. Exiting...\n", (transport == OSVVM_COSIM_UNIX) ? "Unix domain" : "TCP/IP");
         exit(2);
     }
 }
@@ -143,16 +196,16 @@ int OsvvmCosimSkt::init(void)
 }
 
 // -------------------------------------------------------------------------
-// OsvvmCosimSkt::connect_skt()
+// OsvvmCosimSkt::listen_skt()
 //
-// Opens a TCP socket connection, suitable for remote debugging, on the
-// given port number (portno). It listens for a single connection, before
-// returning the connection handle established. If any error occurs,
-// OSVVM_COSIM_ERR is returned instead.
+// Opens a TCP socket, on the given port number (portno), or the next free
+// port of up to ten consecutive port numbers, and listens for connections,
+// returning the listening socket handle, with the port number used in
+// boundport. If any error occurs, OSVVM_COSIM_ERR is returned instead.
 //
 // -------------------------------------------------------------------------
 
-OsvvmCosimSkt::osvvm_cosim_skt_t OsvvmCosimSkt::connect_skt (const int portno)
+OsvvmCosimSkt::osvvm_cosim_skt_t OsvvmCosimSkt::listen_skt (const int portno, int &boundport)
 {
     int enable = 1;
 
@@ -218,8 +271,105 @@ OsvvmCosimSkt::osvvm_cosim_skt_t OsvvmCosimSkt::connect_skt (const int portno)
         return OSVVM_COSIM_ERR;
     }
 
+    boundport = portno + attempts;
+
+    return svrskt;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::listen_unix_skt()
+//
+// Opens a Unix domain stream socket, bound to the given path (replacing
+// any stale socket file), and listens for connections, returning the
+// listening socket handle. If any error occurs, or Unix domain sockets
+// are not supported, OSVVM_COSIM_ERR is returned instead.
+//
+// -------------------------------------------------------------------------
+
+OsvvmCosimSkt::osvvm_cosim_skt_t OsvvmCosimSkt::listen_unix_skt (const std::string &path)
+{
+#if defined (_WIN32) || defined (_WIN64)
+    VPrint("ERROR Unix domain sockets not supported\n");
+    return OSVVM_COSIM_ERR;
+#else
+    osvvm_cosim_skt_t svrskt;
+    struct sockaddr_un serv_addr;
+
+    if (path.length() >= sizeof(serv_addr.sun_path))
+    {
+        VPrint("ERROR Unix domain socket path too long: %s\n", path.c_str());
+        return OSVVM_COSIM_ERR;
+    }
+
+    if ((svrskt = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+    {
+        VPrint("ERROR opening socket\n");
+        return OSVVM_COSIM_ERR;
+    }
+
+    ZeroMemory((char *) &serv_addr, sizeof(serv_addr));
+
+    serv_addr.sun_family = AF_UNIX;
+    strcpy(serv_addr.sun_path, path.c_str());
+
+    unlink(path.c_str());
+
+    if (bind(svrskt, (struct sockaddr *) &serv_addr, sizeof(serv_addr)) < 0)
+    {
+        VPrint("ERROR on Binding: %s\n", path.c_str());
+        closesocket(svrskt);
+        return OSVVM_COSIM_ERR;
+    }
+
+    VPrint("OSVVM_COSIM_SKT: Using Unix domain socket: %s\n", path.c_str());
+
+    if (listen(svrskt, MAXBACKLOG) < 0)
+    {
+        VPrint("ERROR on listening\n");
+        closesocket(svrskt);
+        unlink(path.c_str());
+        return OSVVM_COSIM_ERR;
+    }
+
+    return svrskt;
+#endif
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::connect_skt()
+//
+// Opens a TCP socket connection, suitable for remote debugging, on the
+// given port number (portno), or a Unix domain socket connection on the
+// configured path. It listens for a single connection, before
+// returning the connection handle established. If any error occurs,
+// OSVVM_COSIM_ERR is returned instead.
+//
+// -------------------------------------------------------------------------
+
+OsvvmCosimSkt::osvvm_cosim_skt_t OsvvmCosimSkt::connect_skt (const int portno)
+{
+    int enable = 1;
+    int boundport;
+
+    // Create a listening socket
+    osvvm_cosim_skt_t svrskt;
+
+    if (transport == OSVVM_COSIM_UNIX)
+    {
+        svrskt = listen_unix_skt(path);
+    }
+    else
+    {
+        svrskt = listen_skt(portno, boundport);
+    }
+
+    if (svrskt < 0)
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
     // Get a client address structure, and length as has to be passed as a pointer to accept()
-    struct sockaddr_in cli_addr;
+    struct sockaddr_storage cli_addr;
     socklen_t clilen = sizeof(cli_addr);
 
     // Accept a connection, and get returned handle
@@ -231,126 +381,606 @@ OsvvmCosimSkt::osvvm_cosim_skt_t OsvvmCosimSkt::connect_skt (const int portno)
         return OSVVM_COSIM_ERR;
     }
 
-    // No longer need the server side (listening) socket
-    closesocket(svrskt);
+    // No longer need the server side (listening) socket, nor the Unix domain socket's name
+    closesocket(svrskt);
+
+    if (transport == OSVVM_COSIM_UNIX)
+    {
+#if !defined (_WIN32) && !defined (_WIN64)
+        unlink(path.c_str());
+#endif
+        return skt_hdl;
+    }
+
+    // Responses are sent as whole packets, so send them without waiting to coalesce
+    // with later ones, which would stall until the host acknowledges earlier data
+    if (setsockopt(skt_hdl, IPPROTO_TCP, TCP_NODELAY, (char*)&enable, sizeof(int)) < 0)
+    {
+        VPrint("ERROR setting socket option\n");
+    }
+
+    // Return the handle to the connected socket. With this handle can
+    // use recv()/send() to read and write (or, Linux only, read()/write()).
+    return skt_hdl;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::cleanup()
+//
+// Does any open TCP socket cleanup before exiting the program. Current,
+// only windows requires any handling.
+//
+// -------------------------------------------------------------------------
+
+inline void OsvvmCosimSkt::cleanup(void)
+{
+#if defined (_WIN32) || defined (_WIN64)
+    WSACleanup();
+#endif
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::fill_rx_buf()
+//
+// Receive as many bytes as are available from the socket (or shared memory
+// ring), up to the free contiguous space, into the receive ring buffer.
+// Return true on successful read, else return false, including when the
+// connection has been closed by the host. Any coalesced responses are
+// sent first, as the host may be waiting on them before sending more
+// (unless receiving on the network I/O thread, when ProcessPkts() sends
+// them).
+//
+// -------------------------------------------------------------------------
+
+bool OsvvmCosimSkt::fill_rx_buf (const osvvm_cosim_skt_t skt_hdl)
+{
+    if (!async_io && !tx_pend.empty() && !flush_tx())
+    {
+        return false;
+    }
+
+    // When empty, restart at the beginning of the buffer to receive as much as possible
+    if (rx_rd_idx == rx_wr_idx)
+    {
+        rx_rd_idx = 0;
+        rx_wr_idx = 0;
+    }
+
+    uint32_t wr_pos = rx_wr_idx & (RX_BUF_SIZE-1);
+    uint32_t space  = RX_BUF_SIZE - (rx_wr_idx - rx_rd_idx);
+    uint32_t contig = (space < RX_BUF_SIZE - wr_pos) ? space : RX_BUF_SIZE - wr_pos;
+
+    int len = (transport == OSVVM_COSIM_SHM) ? shm.read(&rx_buf[wr_pos], contig) :
+                                               recv(skt_hdl, &rx_buf[wr_pos], contig, 0);
+
+    if (len <= 0)
+    {
+        if (len < 0)
+        {
+            VPrint("ERROR reading from socket\n");
+        }
+        cleanup();
+        return false;
+    }
+
+    rx_wr_idx += len;
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::rx_span()
+//
+// Return the number of contiguous bytes available in the receive ring
+// buffer, pointed to by span, receiving more from the socket if empty.
+// Returns OSVVM_COSIM_ERR if the socket could not be read.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSkt::rx_span (const osvvm_cosim_skt_t skt_hdl, const char* &span)
+{
+    if (rx_rd_idx == rx_wr_idx && !fill_rx_buf(skt_hdl))
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    uint32_t rd_pos = rx_rd_idx & (RX_BUF_SIZE-1);
+    uint32_t avail  = rx_wr_idx - rx_rd_idx;
+
+    span = &rx_buf[rd_pos];
+
+    return (avail < RX_BUF_SIZE - rd_pos) ? avail : RX_BUF_SIZE - rd_pos;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::read_cmd()
+//
+// Read a byte from the socket receive buffer and place in the buffer (buf),
+// receiving from the socket if no bytes are buffered. Return true on
+// successful read, else return false.
+//
+// -------------------------------------------------------------------------
+
+inline bool OsvvmCosimSkt::read_cmd (const osvvm_cosim_skt_t skt_hdl, char* buf)
+{
+    const char* span;
+
+    if (rx_span(skt_hdl, span) < 0)
+    {
+        return false;
+    }
+
+    *buf = *span;
+    rx_rd_idx++;
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::write_cmd()
+//
+// Write len bytes to the socket from the buffer (buf), with a single
+// send unless the socket only accepts part of it, or to the shared memory
+// ring. Return true on successful write, else return false.
+//
+// -------------------------------------------------------------------------
+
+inline bool OsvvmCosimSkt::write_cmd (const osvvm_cosim_skt_t skt_hdl, const char* buf, const int len)
+{
+    if (transport == OSVVM_COSIM_SHM)
+    {
+        if (!shm.write(buf, len))
+        {
+            VPrint("ERROR writing to shared memory\n");
+            return false;
+        }
+
+        return true;
+    }
+
+    for (int idx = 0; idx < len; )
+    {
+        int sent = send(skt_hdl, &buf[idx], len - idx, 0);
+
+        if (sent < 0)
+        {
+            VPrint("ERROR writing to socket\n");
+            return false;
+        }
+
+        idx += sent;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::flush_tx()
+//
+// Send any coalesced pipelined responses with a single write. Return
+// true on successful write, else return false.
+//
+// -------------------------------------------------------------------------
+
+bool OsvvmCosimSkt::flush_tx (void)
+{
+    bool ok = write_cmd(skt_hdl, tx_pend.data(), tx_pend.length());
+
+    tx_pend.clear();
+
+    return ok;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::proc_cmd()
+//
+// Processes a single command, as stored in cmd_rec. The command is
+// inspected and the appropriate local functions called. Generated replies
+// are added to op_buf, with this function bracketing these with $ and #,
+// followed by the two character checksum, returned by the functions (if
+// any). An exception to a reply is for the kill (k) command which has
+// no reply. Unsupported commands return a default reply of "$#00".
+// The function sends the reply to the socket and then return either
+// true if a 'detach' command (D) was seen, otherwise false.
+//
+// -------------------------------------------------------------------------
+
+bool OsvvmCosimSkt::proc_cmd (CmdAttrType &cmd_rec, const int nodenum)
+{
+    if (cmd_rec.Detach || cmd_rec.Kill)
+    {
+        return true;
+    }
+    else if (cmd_rec.Negotiate || cmd_rec.StartNoAck || cmd_rec.Subscribe)
+    {
+        // Protocol switch or subscription only, with no transaction
+        return false;
+    }
+
+    // A command record with no operation (as from a derived class's
+    // ParsePkt) is a single word access selected by Rnw
+    if (cmd_rec.Op == BIN_OP_NONE)
+    {
+        cmd_rec.Op = cmd_rec.Rnw ? BIN_OP_READ : BIN_OP_WRITE;
+    }
+
+    proc_op(cmd_rec, nodenum);
+
+    return false;
+}
+
+// -------------------------------------------------------------------------
+// cosim_word_op()
+//
+// Local template function to process a word operation of data type T,
+// with address type A, on the node's address bus or stream interfaces.
+//
+// -------------------------------------------------------------------------
+
+template <typename T, typename A> static void cosim_word_op (OsvvmCosim&                 cosim,
+                                                             OsvvmCosimStream&           stream,
+                                                             OsvvmCosimSkt::CmdAttrType& cmd_rec)
+{
+    A   addr   = (A)cmd_rec.Addr;
+    T   wdata  = (T)cmd_rec.Data;
+    T   rdata  = 0;
+    int status = 0;
+
+    switch (cmd_rec.Op)
+    {
+    case BIN_OP_WRITE:          cosim.transWrite(addr, wdata, cmd_rec.Prot);                break;
+    case BIN_OP_READ:           cosim.transRead(addr, &rdata, cmd_rec.Prot);                break;
+    case BIN_OP_WRITE_AND_READ: cosim.transWriteAndRead(addr, wdata, &rdata, cmd_rec.Prot); break;
+    case BIN_OP_READ_CHECK:     cosim.transReadCheck(addr, wdata, cmd_rec.Prot);            break;
+    case BIN_OP_STREAM_SEND:    stream.streamSend(wdata, cmd_rec.Param);                    break;
+    case BIN_OP_STREAM_GET:     stream.streamGet(&rdata, &status);                          break;
+    case BIN_OP_STREAM_CHECK:   stream.streamCheck(wdata, cmd_rec.Param);                   break;
+    }
+
+    cmd_rec.Data = rdata;
+
+    if (cmd_rec.Op == BIN_OP_STREAM_GET)
+    {
+        cmd_rec.Param = status;
+    }
+}
+
+// -------------------------------------------------------------------------
+// cosim_burst_op()
+//
+// Local function to process an address bus burst operation of any
+// length on the command record's payload, as a series of bursts split
+// at chunksize aligned address boundaries (chunksize being a power of 2
+// less than the transfer buffer size). The 64 bit address API is used
+// if any part of the burst is above 4GB.
+//
+// -------------------------------------------------------------------------
+
+static void cosim_burst_op (OsvvmCosim& cosim, OsvvmCosimSkt::CmdAttrType& cmd_rec, const int chunksize)
+{
+    uint8_t* data   = cmd_rec.Payload.data();
+    int      len    = cmd_rec.Payload.size();
+    bool     addr64 = (cmd_rec.Addr + len) > 0x100000000ULL;
+    int      chunk;
+
+    for (int idx = 0; idx < len; idx += chunk)
+    {
+        uint64_t addr = cmd_rec.Addr + idx;
+
+        chunk = chunksize - (int)(addr & (chunksize - 1));
+        chunk = (chunk < len - idx) ? chunk : len - idx;
+
+        switch (cmd_rec.Op)
+        {
+        case BIN_OP_BURST_WRITE:
+            addr64 ? cosim.transBurstWrite(addr, &data[idx], chunk, cmd_rec.Prot) : cosim.transBurstWrite((uint32_t)addr, &data[idx], chunk, cmd_rec.Prot);
+            break;
+        case BIN_OP_BURST_READ:
+            addr64 ? cosim.transBurstRead(addr, &data[idx], chunk, cmd_rec.Prot) : cosim.transBurstRead((uint32_t)addr, &data[idx], chunk, cmd_rec.Prot);
+            break;
+        case BIN_OP_BURST_READ_CHECK:
+            addr64 ? cosim.transBurstReadCheckData(addr, &data[idx], chunk, cmd_rec.Prot) : cosim.transBurstReadCheckData((uint32_t)addr, &data[idx], chunk, cmd_rec.Prot);
+            break;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::proc_op()
+//
+// Processes a single command operation, as stored in cmd_rec, on node
+// nodenum, placing any read data in the command record's Data (word
+// operations) or Payload (bursts), ready for the response.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSkt::proc_op (CmdAttrType &cmd_rec, const int nodenum)
+{
+    OsvvmCosim       cosim(nodenum);
+    OsvvmCosimStream stream(nodenum);
+
+    bool     addr64 = cmd_rec.Addr > 0xffffffffULL;
+    uint8_t* data;
+    int      len;
+    int      status = 0;
+
+    if (cmd_rec.Error)
+    {
+        return;
+    }
+
+    switch (cmd_rec.Op)
+    {
+    case BIN_OP_WRITE:
+    case BIN_OP_READ:
+    case BIN_OP_WRITE_AND_READ:
+    case BIN_OP_READ_CHECK:
+    case BIN_OP_STREAM_SEND:
+    case BIN_OP_STREAM_GET:
+    case BIN_OP_STREAM_CHECK:
+        switch (cmd_rec.DataWidth)
+        {
+        case  8: addr64 ? cosim_word_op<uint8_t,  uint64_t>(cosim, stream, cmd_rec) : cosim_word_op<uint8_t,  uint32_t>(cosim, stream, cmd_rec); break;
+        case 16: addr64 ? cosim_word_op<uint16_t, uint64_t>(cosim, stream, cmd_rec) : cosim_word_op<uint16_t, uint32_t>(cosim, stream, cmd_rec); break;
+        case 32: addr64 ? cosim_word_op<uint32_t, uint64_t>(cosim, stream, cmd_rec) : cosim_word_op<uint32_t, uint32_t>(cosim, stream, cmd_rec); break;
+        case 64:          cosim_word_op<uint64_t, uint64_t>(cosim, stream, cmd_rec);                                                               break;
+        default: cmd_rec.Error = OSVVM_COSIM_ERR; break;
+        }
+        break;
+
+    case BIN_OP_BURST_READ:
+    case BIN_OP_STREAM_BURST_GET:
+        if (cmd_rec.Param > BIN_MAX_PAYLOAD)
+        {
+            cmd_rec.Error = OSVVM_COSIM_ERR;
+            break;
+        }
+
+        cmd_rec.Payload.resize(cmd_rec.Param);
+
+        if (cmd_rec.Op == BIN_OP_BURST_READ)
+        {
+            cosim_burst_op(cosim, cmd_rec, BURST_CHUNK_SIZE);
+            break;
+        }
+        // Fall through
+
+    case BIN_OP_STREAM_BURST_SEND:
+    case BIN_OP_STREAM_BURST_CHECK:
+
+        // Stream bursts can't be split, so are limited to the transfer buffer size
+        if (cmd_rec.Payload.empty() || cmd_rec.Payload.size() >= DATABUF_SIZE)
+        {
+            cmd_rec.Error = OSVVM_COSIM_ERR;
+            cmd_rec.Payload.clear();
+            break;
+        }
+
+        data = cmd_rec.Payload.data();
+        len  = cmd_rec.Payload.size();
+
+        switch (cmd_rec.Op)
+        {
+        case BIN_OP_STREAM_BURST_SEND:
+            stream.streamBurstSend(data, len, cmd_rec.Param);
+            break;
+        case BIN_OP_STREAM_BURST_GET:
+            stream.streamBurstGet(data, len, &status);
+            cmd_rec.Param = status;
+            break;
+        case BIN_OP_STREAM_BURST_CHECK:
+            stream.streamBurstCheck(data, len, cmd_rec.Param);
+            break;
+        }
+
+        if (cmd_rec.Op != BIN_OP_STREAM_BURST_GET)
+        {
+            cmd_rec.Payload.clear();
+        }
+        break;
+
+    case BIN_OP_BURST_WRITE:
+    case BIN_OP_BURST_READ_CHECK:
+        cosim_burst_op(cosim, cmd_rec, BURST_CHUNK_SIZE);
+
+        // Only read data is returned
+        cmd_rec.Payload.clear();
+        break;
+
+    case BIN_OP_TICK:
+        cosim.tick(cmd_rec.Param);
+        break;
+
+    default:
+        cmd_rec.Error = OSVVM_COSIM_ERR;
+        break;
+    }
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::bin_pkt_size()
+//
+// Return the total size of the binary packet whose first len bytes are
+// in buf, or 0 if the header is not yet complete. Returns
+// OSVVM_COSIM_ERR if the bytes are not a valid binary packet header.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSkt::bin_pkt_size (const char* buf, const int len)
+{
+    if (len > 0 && (uint8_t)buf[0] != BIN_MAGIC)
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    if (len < BIN_HDR_SIZE)
+    {
+        return 0;
+    }
+
+    uint64_t payload = get_le(&buf[16], 4);
 
-    // Return the handle to the connected socket. With this handle can
-    // use recv()/send() to read and write (or, Linux only, read()/write()).
-    return skt_hdl;
+    return (payload > BIN_MAX_PAYLOAD) ? OSVVM_COSIM_ERR : BIN_HDR_SIZE + (int)payload;
 }
 
 // -------------------------------------------------------------------------
-// OsvvmCosimSkt::cleanup()
+// OsvvmCosimSkt::parse_bin_pkt()
 //
-// Does any open TCP socket cleanup before exiting the program. Current,
-// only windows requires any handling.
+// Parse the binary packet in cmdstr, with a header as defined for
+// BIN_HDR_SIZE, and construct a command record.
 //
 // -------------------------------------------------------------------------
 
-inline void OsvvmCosimSkt::cleanup(void)
+OsvvmCosimSkt::CmdAttrType OsvvmCosimSkt::parse_bin_pkt (const std::string &cmdstr)
 {
-#if defined (_WIN32) || defined (_WIN64)
-    WSACleanup();
-#endif
+    CmdAttrType cmd_rec;
+    const char* buf     = cmdstr.data();
+    int         width   = (uint8_t)buf[2];
+    int         op      = (uint8_t)buf[1];
+    bool        word_op = (op >= BIN_OP_WRITE       && op <= BIN_OP_READ_CHECK) ||
+                          (op >= BIN_OP_STREAM_SEND && op <= BIN_OP_STREAM_CHECK);
+
+    cmd_rec.Binary    = true;
+    cmd_rec.Op        = op;
+    cmd_rec.DataWidth = width * 8;
+    cmd_rec.Prot      = (uint8_t)buf[3];
+    cmd_rec.Tag       = get_le(&buf[4], 4);
+    cmd_rec.Addr      = get_le(&buf[8], 8);
+    cmd_rec.AddrWidth = (cmd_rec.Addr > 0xffffffffULL) ? 64 : 32;
+    cmd_rec.Param     = get_le(&buf[20], 4);
+    cmd_rec.Rnw       = cmd_rec.Op == BIN_OP_READ || cmd_rec.Op == BIN_OP_BURST_READ || cmd_rec.Op == BIN_OP_STREAM_GET ||
+                        cmd_rec.Op == BIN_OP_STREAM_BURST_GET;
+    cmd_rec.Detach    = cmd_rec.Op == BIN_OP_DETACH;
+    cmd_rec.Kill      = cmd_rec.Op == BIN_OP_KILL;
+    cmd_rec.Subscribe = cmd_rec.Op == BIN_OP_INTERRUPT;
+
+    if (cmd_rec.Op <= BIN_OP_NONE || cmd_rec.Op >= BIN_OP_MAX)
+    {
+        cmd_rec.Error = OSVVM_COSIM_ERR;
+    }
+
+    // Word data is in the first width bytes of the payload, else the payload is burst data
+    if (cmdstr.size() > (size_t)BIN_HDR_SIZE)
+    {
+        if (word_op && width > 0 && width <= 8)
+        {
+            cmd_rec.Data = get_le(&buf[BIN_HDR_SIZE], (cmdstr.size() - BIN_HDR_SIZE < (size_t)width) ? cmdstr.size() - BIN_HDR_SIZE : width);
+        }
+        else
+        {
+            cmd_rec.Payload.assign((const uint8_t*)&buf[BIN_HDR_SIZE], (const uint8_t*)buf + cmdstr.size());
+        }
+    }
+
+    DebugVPrint("parse_bin_pkt(): op=%d addr=%016llx width=%d len=%d tag=%d\n",
+                cmd_rec.Op, cmd_rec.Addr, width, (int)(cmdstr.size() - BIN_HDR_SIZE), cmd_rec.Tag);
+
+    return cmd_rec;
 }
 
 // -------------------------------------------------------------------------
-// OsvvmCosimSkt::read_cmd()
+// OsvvmCosimSkt::gen_bin_resp()
 //
-// Read a byte from the socket and place in the buffer (buf). Return true
-// on successful read, else return false. Compile dependent for windows
-// (ReadFile) and linux (read)
+// Generate a binary response packet from the command record, echoing
+// the request header's operation, width, tag and address, with a status,
+// and any read data as payload.
 //
 // -------------------------------------------------------------------------
 
-inline bool OsvvmCosimSkt::read_cmd (const osvvm_cosim_skt_t skt_hdl, char* buf)
+std::string OsvvmCosimSkt::gen_bin_resp (const CmdAttrType &resp)
 {
-    int status = OSVVM_COSIM_OK;
-
-    // Read from the connection (up to 255 bytes plus null termination).
-    if (recv(skt_hdl, buf, 1, 0) < 0)
+    std::string pkt;
+    int         width   = resp.DataWidth / 8;
+    bool        rdword  = !resp.Error && (resp.Op == BIN_OP_READ || resp.Op == BIN_OP_WRITE_AND_READ || resp.Op == BIN_OP_STREAM_GET);
+    int         payload = rdword ? width : resp.Payload.size();
+
+    pkt.reserve(BIN_HDR_SIZE + payload);
+
+    pkt.push_back((char)BIN_MAGIC);
+    pkt.push_back((char)resp.Op);
+    pkt.push_back((char)width);
+    pkt.push_back((char)(resp.Error ? 1 : 0));
+    put_le(pkt, resp.Tag,   4);
+    put_le(pkt, resp.Addr,  8);
+    put_le(pkt, payload,    4);
+    put_le(pkt, resp.Param, 4);
+
+    if (rdword)
     {
-        VPrint("ERROR reading from socket\n");
-        cleanup();
-        status = OSVVM_COSIM_ERR;
+        put_le(pkt, resp.Data, width);
+    }
+    else if (payload)
+    {
+        pkt.append((const char*)resp.Payload.data(), payload);
     }
 
-    return status == OSVVM_COSIM_OK;
+    return pkt;
 }
 
 // -------------------------------------------------------------------------
-// OsvvmCosimSkt::write_cmd()
+// OsvvmCosimSkt::gen_int_pkt()
 //
-// Write a byte to the socket from the buffer (buf). Return true
-// on successful read, else return false. Compile dependent for windows
-// (WriteFile) and linux (write)
+// Generate an interrupt notification packet for a change of a node's
+// interrupt vector to vec, in binary (with a BIN_NOTIFY_TAG tag), or as
+// a gdb style %Interrupt:<hex vector>#<checksum> notification.
 //
 // -------------------------------------------------------------------------
 
-inline bool OsvvmCosimSkt::write_cmd (const osvvm_cosim_skt_t skt_hdl, const char* buf)
+std::string OsvvmCosimSkt::gen_int_pkt (const int vec, const int nodenum, const bool bin)
 {
-    int status = OSVVM_COSIM_OK;
+    std::string   pkt;
+    char          vecstr[HEX_BUF_SIZE];
+    unsigned char chksum = 0;
+
+    if (bin)
+    {
+        pkt.push_back((char)BIN_MAGIC);
+        pkt.push_back((char)BIN_OP_INTERRUPT);
+        pkt.push_back(0);
+        pkt.push_back(0);
+        put_le(pkt, BIN_NOTIFY_TAG, 4);
+        put_le(pkt, nodenum,        8);
+        put_le(pkt, 0,              4);
+        put_le(pkt, (uint32_t)vec,  4);
+
+        return pkt;
+    }
+
+    snprintf(vecstr, HEX_BUF_SIZE, "%s%x", INT_EVENT_STR, (unsigned)vec);
+
+    pkt.push_back(GDB_NOTIFY_CHAR);
 
-    if (send(skt_hdl, buf, 1, 0) < 0)
+    for (int idx = 0; vecstr[idx] != '\0'; idx++)
     {
-        VPrint("ERROR writing to socket\n");
-        status = OSVVM_COSIM_ERR;
+        pkt.push_back(vecstr[idx]);
+        chksum += vecstr[idx];
     }
 
-    return status == OSVVM_COSIM_OK;
+    pkt.push_back(eop_char);
+    pkt.push_back(hihexchar(chksum));
+    pkt.push_back(lohexchar(chksum));
+
+    return pkt;
 }
 
 // -------------------------------------------------------------------------
-// OsvvmCosimSkt::proc_cmd()
+// OsvvmCosimSkt::int_tap()
 //
-// Processes a single command, as stored in cmd_rec. The command is
-// inspected and the appropriate local functions called. Generated replies
-// are added to op_buf, with this function bracketing these with $ and #,
-// followed by the two character checksum, returned by the functions (if
-// any). An exception to a reply is for the kill (k) command which has
-// no reply. Unsupported commands return a default reply of "$#00".
-// The function sends the reply to the socket and then return either
-// true if a 'detach' command (D) was seen, otherwise false.
+// Interrupt tap, called on the node's thread, during a transaction,
+// whenever the interrupt vector of node nodenum changes whilst the client
+// is subscribed, recording the new vector to be notified.
 //
 // -------------------------------------------------------------------------
 
-bool OsvvmCosimSkt::proc_cmd (CmdAttrType &cmd_rec)
+void OsvvmCosimSkt::int_tap (const int vec, const uint32_t nodenum, void* hdl)
 {
-    OsvvmCosim cosim(node);
+    OsvvmCosimSkt* skt = (OsvvmCosimSkt*)hdl;
 
-    if (cmd_rec.Detach || cmd_rec.Kill)
-    {
-        return true;
-    }
-    else
+    // Only changes on the socket's own node are notified
+    if ((int)nodenum == skt->node)
     {
-        if (cmd_rec.Rnw)
-        {
-            switch(cmd_rec.DataWidth)
-            {
-                uint32_t rdata32;
-                uint16_t rdata16;
-                uint8_t  rdata8;
-
-                case 32: cosim.transRead((uint32_t)cmd_rec.Addr, (uint32_t*)&rdata32); cmd_rec.Data = rdata32; break;
-                case 16: cosim.transRead((uint32_t)cmd_rec.Addr, (uint16_t*)&rdata16); cmd_rec.Data = rdata16; break;
-                case  8: cosim.transRead((uint32_t)cmd_rec.Addr,  (uint8_t*)&rdata8);  cmd_rec.Data = rdata8;  break;
-                default: cmd_rec.Error = OSVVM_COSIM_ERR; return true;
-            }
-        }
-        else
-        {
-             switch(cmd_rec.DataWidth)
-             {
-                 case 32: cosim.transWrite((uint32_t)cmd_rec.Addr, (uint32_t)cmd_rec.Data); break;
-                 case 16: cosim.transWrite((uint32_t)cmd_rec.Addr, (uint16_t)cmd_rec.Data); break;
-                 case  8: cosim.transWrite((uint32_t)cmd_rec.Addr,  (uint8_t)cmd_rec.Data); break;
-                 default: cmd_rec.Error = OSVVM_COSIM_ERR; return true;
-             }
-        }
+        skt->int_events.push_back(vec);
     }
-
-    return false;
 }
 
 // -------------------------------------------------------------------------
@@ -368,6 +998,12 @@ OsvvmCosimSkt::CmdAttrType OsvvmCosimSkt::ParsePkt (const std::string cmdstr)
     int         len = 0;
     uint8_t     byte;
 
+    // Binary protocol packets are identified by their first byte
+    if (!cmdstr.empty() && (uint8_t)cmdstr.at(0) == BIN_MAGIC)
+    {
+        return parse_bin_pkt(cmdstr);
+    }
+
     // Initialise the command record
     cmd_rec.Addr       = 0;
     cmd_rec.Data       = 0x0badc0de;
@@ -383,7 +1019,7 @@ OsvvmCosimSkt::CmdAttrType OsvvmCosimSkt::ParsePkt (const std::string cmdstr)
     // Get command character
     char cmd = cmdstr.at(cdx++);
 
-    if (cmd != 'D' && cmd != 'k')
+    if (cmd != 'D' && cmd != 'k' && cmd != 'Q')
     {
 
         // Get address
@@ -421,9 +1057,23 @@ OsvvmCosimSkt::CmdAttrType OsvvmCosimSkt::ParsePkt (const std::string cmdstr)
     switch(cmd)
     {
 
-    // Read memory
+    // Read memory, as hex (m) or escaped binary (x) data, with
+    // lengths other than single words read as bursts
     case 'm':
+    case 'x':
         cmd_rec.Rnw        = true;
+
+        if (cmd == 'x' || !(len == 1 || len == 2 || len == 4 || len == 8))
+        {
+            cmd_rec.Op         = BIN_OP_BURST_READ;
+            cmd_rec.Param      = len;
+            cmd_rec.DataWidth  = 0;
+            cmd_rec.Escaped    = (cmd == 'x');
+        }
+        else
+        {
+            cmd_rec.Op         = BIN_OP_READ;
+        }
         break;
 
     // Write memory
@@ -435,20 +1085,73 @@ OsvvmCosimSkt::CmdAttrType OsvvmCosimSkt::ParsePkt (const std::string cmdstr)
         // Skip colon
         cdx++;
 
-        // Get hex characters byte values and put into memory
-        for (unsigned int idx = 0; idx < len; idx++)
+        if (cdx + 2*len > cmdstr.length())
+        {
+            cmd_rec.Error = OSVVM_COSIM_ERR;
+        }
+        else if (len == 1 || len == 2 || len == 4 || len == 8)
+        {
+            cmd_rec.Op         = BIN_OP_WRITE;
+
+            // Get hex characters byte values and put into memory
+            for (unsigned int idx = 0; idx < len; idx++)
+            {
+                cmd_rec.Data <<= 8;
+
+                // Get byte value from hex
+                uint8_t byte = 0;
+
+                byte |= char2nib(cmdstr.at(cdx)) << 4; cdx++;
+                byte |= char2nib(cmdstr.at(cdx));      cdx++;
+
+                cmd_rec.Data |= byte;
+            }
+        }
+        else
         {
-            cmd_rec.Data <<= 8;
+            cmd_rec.Op         = BIN_OP_BURST_WRITE;
+            cmd_rec.DataWidth  = 0;
+
+            // Get hex characters byte values as burst data, in memory order
+            cmd_rec.Payload.resize(len);
+
+            for (int idx = 0; idx < len; idx++, cdx += 2)
+            {
+                cmd_rec.Payload[idx] = (char2nib(cmdstr[cdx]) << 4) | char2nib(cmdstr[cdx+1]);
+            }
+        }
+        break;
+
+    // Write memory with escaped binary data
+    case 'X':
+    {
+        cmd_rec.Rnw        = false;
+        cmd_rec.Op         = BIN_OP_BURST_WRITE;
+        cmd_rec.DataWidth  = 0;
+
+        // Data is between the colon and the EOP
+        int end = cmdstr.length() - suffix_bytes - 1;
 
-            // Get byte value from hex
-            uint8_t byte = 0;
+        cmd_rec.Payload.reserve(len);
 
-            byte |= char2nib(cmdstr.at(cdx)) << 4; cdx++;
-            byte |= char2nib(cmdstr.at(cdx));      cdx++;
+        for (cdx++; cdx < end; cdx++)
+        {
+            if (cmdstr[cdx] == GDB_ESC_CHAR && cdx + 1 < end)
+            {
+                cmd_rec.Payload.push_back(cmdstr[++cdx] ^ 0x20);
+            }
+            else
+            {
+                cmd_rec.Payload.push_back(cmdstr[cdx]);
+            }
+        }
 
-            cmd_rec.Data |= byte;
+        if (cmd_rec.Payload.size() != (size_t)len)
+        {
+            cmd_rec.Error = OSVVM_COSIM_ERR;
         }
         break;
+    }
 
     case 'D':
         cmd_rec.Detach = true;
@@ -457,6 +1160,30 @@ OsvvmCosimSkt::CmdAttrType OsvvmCosimSkt::ParsePkt (const std::string cmdstr)
     case 'k':
         cmd_rec.Kill   = true;
         break;
+
+    // Query to switch to the binary protocol, or to no-ack mode
+    case 'Q':
+        cmd_rec.Rnw    = false;
+
+        if (cmdstr.compare(cdx, strlen(BIN_NEGOTIATE_STR), BIN_NEGOTIATE_STR) == 0)
+        {
+            cmd_rec.Negotiate = true;
+        }
+        else if (cmdstr.compare(cdx, strlen(NOACK_START_STR), NOACK_START_STR) == 0)
+        {
+            cmd_rec.StartNoAck = true;
+        }
+        else if (cmdstr.compare(cdx, strlen(INT_NOTIFY_STR), INT_NOTIFY_STR) == 0)
+        {
+            // Subscribe, unless :0 follows
+            cmd_rec.Subscribe  = true;
+            cmd_rec.Param      = cmdstr.compare(cdx + strlen(INT_NOTIFY_STR), 2, ":0") != 0;
+        }
+        else
+        {
+            cmd_rec.Error     = OSVVM_COSIM_ERR;
+        }
+        break;
     }
 
    DebugVPrint("%s: addr=%08llx awidth=%d, data=%08llx dwidth=%d detach=%d kill=%d error=%d\n",
@@ -473,7 +1200,7 @@ OsvvmCosimSkt::CmdAttrType OsvvmCosimSkt::ParsePkt (const std::string cmdstr)
 //
 // Generate a response packet based on the response record settings,
 // returning a string with the complete response, including the
-// acknowledgement.
+// acknowledgement (unless Resp.Ack is false, in no-ack mode).
 //
 // -------------------------------------------------------------------------
 
@@ -487,6 +1214,11 @@ std::string OsvvmCosimSkt::GenRespPkt (const OsvvmCosimSkt::CmdAttrType Resp,
 
     unsigned char chksum = 0;
 
+    if (Resp.Binary)
+    {
+        return gen_bin_resp(Resp);
+    }
+
     if (!Resp.Error)
     {
         if (Resp.Detach || Resp.Kill)
@@ -496,7 +1228,38 @@ std::string OsvvmCosimSkt::GenRespPkt (const OsvvmCosimSkt::CmdAttrType Resp,
                 cmd.append("OK");
             }
         }
-        if (!Resp.Rnw)
+        else if (Resp.Op == BIN_OP_BURST_READ)
+        {
+            cmd.reserve(Resp.Payload.size() * 2 + 1);
+
+            if (Resp.Escaped)
+            {
+                // Binary data, escaping bytes that are special to the protocol
+                cmd.push_back('b');
+
+                for (size_t idx = 0; idx < Resp.Payload.size(); idx++)
+                {
+                    char byte = Resp.Payload[idx];
+
+                    if (byte == SopByte || byte == EopByte || byte == GDB_ESC_CHAR || byte == '*')
+                    {
+                        cmd.push_back(GDB_ESC_CHAR);
+                        byte ^= 0x20;
+                    }
+                    cmd.push_back(byte);
+                }
+            }
+            else
+            {
+                // Hex data, in memory order
+                for (size_t idx = 0; idx < Resp.Payload.size(); idx++)
+                {
+                    cmd.push_back(hihexchar(Resp.Payload[idx]));
+                    cmd.push_back(lohexchar(Resp.Payload[idx]));
+                }
+            }
+        }
+        else if (!Resp.Rnw)
         {
             cmd.append("OK");
         }
@@ -533,11 +1296,11 @@ std::string OsvvmCosimSkt::GenRespPkt (const OsvvmCosimSkt::CmdAttrType Resp,
         chksum += cmd.at(idx);
     }
 
-    // Prepend an acknowledgement and SOP
+    // Prepend an acknowledgement, unless in no-ack mode, and SOP
     char prefix[3];
 
-    prefix[0] = ack_char;
-    prefix[1] = SopByte;
+    prefix[0] = Resp.Ack ? ack_char : SopByte;
+    prefix[1] = Resp.Ack ? SopByte  : '\0';
     prefix[2] = '\0';
     cmd.insert(0, prefix);
 
@@ -559,41 +1322,67 @@ std::string OsvvmCosimSkt::GenRespPkt (const OsvvmCosimSkt::CmdAttrType Resp,
 // Method to read a packet from the open socket in a generic way, using
 // the sop_char and eop_char to delimit the packet, and the read any
 // suffix bytes, as defined by suffix_bytes, all set at construction.
+// The packet is taken from the socket receive buffer, a contiguous span
+// at a time, so that the socket is only read when the buffer is empty.
 //
 // -------------------------------------------------------------------------
 
 int OsvvmCosimSkt::fetch_next_pkt(const OsvvmCosimSkt::osvvm_cosim_skt_t skt, std::string &cmdstr)
 {
-    bool  status;
-    char ipbyte;
+    const char* span;
+    const char* delim;
+    int         len;
+    char        ipbyte;
 
     cmdstr.clear();
 
-    // Read bytes from socket, discarding bytes, until SOP
+    // Once negotiated, packets are a binary header and payload
+    if (binary)
+    {
+        int size;
+
+        if (fetch_bin_bytes(skt, cmdstr, BIN_HDR_SIZE) || (size = bin_pkt_size(cmdstr.data(), cmdstr.size())) < 0)
+        {
+            return OSVVM_COSIM_ERR;
+        }
+
+        return fetch_bin_bytes(skt, cmdstr, size - BIN_HDR_SIZE);
+    }
+
+    // Discard buffered bytes until SOP
     do
     {
-        if (!read_cmd(skt, &ipbyte))
+        if ((len = rx_span(skt, span)) < 0)
         {
             return OSVVM_COSIM_ERR;
         }
+
+        delim      = (const char*)memchr(span, sop_char, len);
+        rx_rd_idx += delim ? delim - span : len;
     }
-    while (ipbyte != sop_char);
+    while (delim == NULL);
 
     // Add the SOP to the command string
+    read_cmd(skt, &ipbyte);
     cmdstr.push_back(ipbyte);
 
-    // Read bytes from socket, adding bytes to string, until EOP
+    // Add buffered bytes to string, a span at a time, up to and including EOP
     do
     {
-        if (!read_cmd(skt, &ipbyte))
+        if ((len = rx_span(skt, span)) < 0)
         {
             return OSVVM_COSIM_ERR;
         }
-        cmdstr.push_back(ipbyte);
+
+        delim      = (const char*)memchr(span, eop_char, len);
+        len        = delim ? delim - span + 1 : len;
+
+        cmdstr.append(span, len);
+        rx_rd_idx += len;
     }
-    while (ipbyte != eop_char);
+    while (delim == NULL);
 
-    // Read bytes from socket, adding bytes to string for suffix bytes
+    // Add bytes to string for suffix bytes
     for (int idx = 0; idx < suffix_bytes; idx++)
     {
         if (!read_cmd(skt, &ipbyte))
@@ -607,6 +1396,147 @@ int OsvvmCosimSkt::fetch_next_pkt(const OsvvmCosimSkt::osvvm_cosim_skt_t skt, st
 }
 
 
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::fetch_bin_bytes()
+//
+// Append len bytes from the socket receive buffer to cmdstr, a
+// contiguous span at a time.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSkt::fetch_bin_bytes(const OsvvmCosimSkt::osvvm_cosim_skt_t skt, std::string &cmdstr, const int len)
+{
+    const char* span;
+    int         avail;
+
+    for (int remaining = len; remaining > 0; remaining -= avail)
+    {
+        if ((avail = rx_span(skt, span)) < 0)
+        {
+            return OSVVM_COSIM_ERR;
+        }
+
+        avail      = (avail < remaining) ? avail : remaining;
+
+        cmdstr.append(span, avail);
+        rx_rd_idx += avail;
+    }
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::next_cmd()
+//
+// Get the next command record, either by fetching a packet into cmdstr
+// and parsing it, or, with the network I/O thread, from its queue of
+// parsed commands. Any coalesced responses are sent before waiting on
+// an empty queue, as the host may be waiting on them before sending
+// more. Returns OSVVM_COSIM_ERR (or the I/O thread's error status) if
+// the connection is lost.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSkt::next_cmd (std::string &cmdstr, CmdAttrType &cmd_rec)
+{
+    if (!async_io)
+    {
+        int status = fetch_next_pkt(skt_hdl, cmdstr);
+
+        if (status == OSVVM_COSIM_OK)
+        {
+            cmd_rec = ParsePkt(cmdstr);
+        }
+
+        return status;
+    }
+
+    if (!tx_pend.empty() && rx_queue.empty() && !flush_tx())
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    if (!rx_queue.pop(cmd_rec))
+    {
+        return (io_status != OSVVM_COSIM_OK) ? io_status : OSVVM_COSIM_ERR;
+    }
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::io_loop()
+//
+// Network I/O thread. Fetches and parses packets, pushing the command
+// records to the queue consumed by ProcessPkts(), until a detach or kill
+// command, or the connection is lost. The framing switches to binary as
+// soon as a negotiation is parsed, as the packets following it are
+// binary.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSkt::io_loop (void)
+{
+    std::string cmdstr;
+    CmdAttrType cmd_rec;
+    bool        done = false;
+
+    while (!done && (io_status = fetch_next_pkt(skt_hdl, cmdstr)) == OSVVM_COSIM_OK)
+    {
+        cmd_rec = ParsePkt(cmdstr);
+
+        binary  = binary || (cmd_rec.Negotiate && !cmd_rec.Error);
+        done    = cmd_rec.Detach || cmd_rec.Kill;
+
+        if (!rx_queue.push(cmd_rec))
+        {
+            break;
+        }
+    }
+
+    rx_queue.close();
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSkt::stop_io()
+//
+// Stop any interrupt notifications, and stop the network I/O thread, if
+// running, unblocking it if still receiving or waiting on a full queue,
+// and wait for it to finish.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSkt::stop_io (void)
+{
+    if (int_notify)
+    {
+        VRegInterruptTap(NULL, NULL, node);
+        int_notify = false;
+    }
+
+    if (!io_thread.joinable())
+    {
+        return;
+    }
+
+    rx_queue.close();
+
+    if (transport == OSVVM_COSIM_SHM)
+    {
+        shm.shutdown();
+    }
+    else
+    {
+#if defined (_WIN32) || defined (_WIN64)
+        shutdown(skt_hdl, SD_RECEIVE);
+#else
+        shutdown(skt_hdl, SHUT_RD);
+#endif
+    }
+
+    io_thread.join();
+}
+
 // -------------------------------------------------------------------------
 // OsvvmCosimSkt::process_pkt()
 //
@@ -634,6 +1564,12 @@ int OsvvmCosimSkt::ProcessPkts (void)
     std::string cmdstr, respstr;
     CmdAttrType cmd_rec;
 
+    // Start the network I/O thread, if enabled, to fetch and parse packets ahead of their processing
+    if (async_io)
+    {
+        io_thread = std::thread(&OsvvmCosimSkt::io_loop, this);
+    }
+
     while (!detached)
     {
         // If waiting for first communication, flag that attachment has happened.
@@ -645,40 +1581,75 @@ int OsvvmCosimSkt::ProcessPkts (void)
         }
         else
         {
-            // Fetch a whole packet and place in cmdstr
-            int status = fetch_next_pkt (skt_hdl, cmdstr);
+            // Fetch a whole packet, and parse it into the transaction
+            // command record
+            int status = next_cmd(cmdstr, cmd_rec);
 
             // If an error occured, return with status
             if (status)
             {
+                stop_io();
                 return status;
             }
 
-            // Parse the packet in the command string and return
-            // the transaction command record
-            cmd_rec  = ParsePkt(cmdstr);
+            cmd_rec.Ack = !no_ack;
 
             // Process the command record with co-sim accesses to the OSVVM address bus manager transactor
-            detached = proc_cmd(cmd_rec);
+            detached = proc_cmd(cmd_rec, node);
+
+            // Subscribe to, or unsubscribe from, the node's interrupt vector changes
+            if (cmd_rec.Subscribe && !cmd_rec.Error)
+            {
+                int_notify = cmd_rec.Param != 0;
+                VRegInterruptTap(int_notify ? int_tap : NULL, this, node);
+            }
 
             // If not a kill command, send a response
             if (!cmd_rec.Kill)
             {
-                // Generate a response from the command record
-                respstr = GenRespPkt(cmd_rec, sop_char, eop_char, little_endian);
+                // Generate a response from the command record, preceded by notifications of
+                // any interrupt vector changes during its transaction
+                respstr.clear();
+
+                for (size_t idx = 0; idx < int_events.size(); idx++)
+                {
+                    respstr.append(gen_int_pkt(int_events[idx], node, cmd_rec.Binary));
+                }
+
+                int_events.clear();
+
+                respstr.append(GenRespPkt(cmd_rec, sop_char, eop_char, little_endian));
 
                 DebugVPrint("respstr = %s (%d)\n", respstr.c_str(), respstr.length());
 
-                // Send the response packet
-                for (int idx = 0; idx < respstr.length(); idx++)
+                // Send the response packet, or, when pipelined, add it to those to be
+                // sent once no more packets are buffered
+                if (coalesce && (no_ack || cmd_rec.Binary))
                 {
-                    char rchar = respstr.at(idx);
-                    if (!write_cmd(skt_hdl, &rchar))
+                    tx_pend.append(respstr);
+
+                    if (tx_pend.length() >= TX_COALESCE_SIZE && !flush_tx())
                     {
                         VPrint("OSVVM_COSIM_SKT: ERROR writing to host: terminating.\n");
+                        stop_io();
                         return true;
                     }
                 }
+                else if (!write_cmd(skt_hdl, respstr.data(), respstr.length()))
+                {
+                    VPrint("OSVVM_COSIM_SKT: ERROR writing to host: terminating.\n");
+                    stop_io();
+                    return true;
+                }
+
+                // Switch to the binary protocol, or no-ack mode, once acknowledged.
+                // With a network I/O thread, binary is owned (and already switched)
+                // by that thread, and is not touched here.
+                if (!async_io)
+                {
+                    binary = binary || (cmd_rec.Negotiate && !cmd_rec.Error);
+                }
+                no_ack = no_ack || (cmd_rec.StartNoAck && !cmd_rec.Error);
             }
         }
     }
@@ -692,8 +1663,22 @@ int OsvvmCosimSkt::ProcessPkts (void)
         VPrint("OSVVM_COSIM_SKT: connection lost to host: terminating.\n");
     }
 
-    // Close socket of TCP connection
-    closesocket(skt_hdl);
+    // Send any remaining coalesced responses, and close the connection
+    if (!tx_pend.empty())
+    {
+        flush_tx();
+    }
+
+    stop_io();
+
+    if (transport == OSVVM_COSIM_SHM)
+    {
+        shm.detach();
+    }
+    else
+    {
+        closesocket(skt_hdl);
+    }
 
     return OSVVM_COSIM_OK;
 }
@@ -13,8 +13,71 @@
 //      Defines  osvvm_cosim_skt class to support co-simulation
 //      communications via TCP/IP socket
 //
+//      Packets are in the gdb remote serial protocol format by default.
+//      Memory reads and writes (m and M, or x and X with binary data)
+//      of 1, 2, 4 or 8 bytes are single word accesses, with other lengths
+//      being bursts, split as necessary.
+//      A client may switch to a compact binary format by sending
+//      $QOsvvmBinary#<checksum> on connection, which is acknowledged
+//      with OK, after which all packets, in both directions, consist of
+//      a fixed BIN_HDR_SIZE byte header, followed by length bytes of
+//      raw payload. The header fields, little endian, are:
+//
+//        byte  0      : BIN_MAGIC
+//        byte  1      : operation (BinOpType)
+//        byte  2      : access width in bytes (1, 2, 4 or 8) for word operations
+//        byte  3      : protection (request) or status (response, 0 is OK)
+//        bytes 4-7    : tag, returned in the response
+//        bytes 8-15   : address
+//        bytes 16-19  : payload length
+//        bytes 20-23  : parameter (read/get byte length, stream param,
+//                       tick count, or get status in the response)
+//
+//      Word data is carried as width bytes of payload, and burst data as
+//      the payload itself.
+//
+//      A client may also send $QStartNoAckMode#<checksum>, as for gdb,
+//      which is acknowledged (with +) and answered with OK, after which
+//      responses carry no acknowledgement. The client may then stream
+//      any number of packets without waiting, which are executed in
+//      order, with their responses (as for the binary protocol)
+//      coalesced into as few sends as possible: pending responses are
+//      only sent when no more complete packets are buffered, or they
+//      reach TX_COALESCE_SIZE bytes, unless disabled with SetCoalesce().
+//
+//      The host connection is a TCP/IP socket by default, but may be
+//      selected as a Unix domain stream socket, or (Linux only) a shared
+//      memory ring pair (see OsvvmCosimShmRing.h), for hosts on the same
+//      machine, with a path (or shared memory object name) derived from
+//      the port number if none is given.
+//
+//      With SetAsyncIo(), a separate network I/O thread receives and
+//      parses packets into a lock-free queue (see OsvvmCosimSpscQueue.h),
+//      which ProcessPkts() consumes, so that host latency and parsing
+//      overlap the simulation of earlier packets' transactions.
+//
+//      A client may subscribe to the node's interrupts with
+//      $QOsvvmInterrupts:1#<checksum> (or :0 to unsubscribe), or a
+//      binary BIN_OP_INTERRUPT request with a parameter of 1 (or 0),
+//      answered with OK (or an echoed header). Whenever the interrupt
+//      vector changes, as detected for the VIntVecCB callback, during a
+//      transaction, the client is then sent a notification before the
+//      transaction's response. A notification is a %Interrupt:<hex
+//      vector>#<checksum> packet, as for gdb notifications, with no
+//      acknowledgement, or, in binary, a BIN_OP_INTERRUPT header with a
+//      tag of BIN_NOTIFY_TAG, the node as the address and the vector
+//      as the parameter.
+//
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Buffered socket reads and single send responses,
+//                         support for derived multi-client server,
+//                         negotiated binary protocol, any length
+//                         memory packets (m, M, x and X) as bursts,
+//                         Unix domain socket and shared memory
+//                         transports, pipelined no-ack mode, an
+//                         asynchronous network I/O thread, and
+//                         interrupt notifications
 //    10/2022   2023.01    Initial revision
 //
 //
@@ -43,7 +106,10 @@
 // INCLUDES
 // -------------------------------------------------------------------------
 
+#include <stdint.h>
 #include <string>
+#include <vector>
+#include <thread>
 
 #if defined (_WIN32) || defined (_WIN64)
 
@@ -52,6 +118,9 @@
 #endif
 
 #include "OsvvmCosimSktHdr.h"
+#include "OsvvmCosimShmRing.h"
+#include "OsvvmCosimSpscQueue.h"
+#include "OsvvmVProc.h"
 
 // -------------------------------------------------------------------------
 // CLASS DEFINITION
@@ -84,14 +153,38 @@ public:
                bool     Kill;
                int      Error;
 
+               // Operation, and binary protocol attributes
+               bool     Binary;
+               bool     Negotiate;
+               bool     StartNoAck;
+               bool     Subscribe;
+               bool     Ack;
+               bool     Escaped;
+               int      Op;
+               int      Prot;
+               uint32_t Tag;
+               uint32_t Param;
+               std::vector<uint8_t> Payload;
+
                CmdAttrClass() :
+                   Rnw        (false),
                    Addr       (0),
                    AddrWidth  (0),
                    Data       (0),
                    DataWidth  (32),
                    Detach     (false),
                    Kill       (false),
-                   Error      (OSVVM_COSIM_OK)
+                   Error      (OSVVM_COSIM_OK),
+                   Binary     (false),
+                   Negotiate  (false),
+                   StartNoAck (false),
+                   Subscribe  (false),
+                   Ack        (true),
+                   Escaped    (false),
+                   Op         (BIN_OP_NONE),
+                   Prot       (0),
+                   Tag        (0),
+                   Param      (0)
                {
                };
 
@@ -103,12 +196,23 @@ public:
                                             const bool LittleEndian = false,
                                             const char Eop          = GDB_EOP_CHAR,
                                             const char Sop          = GDB_SOP_CHAR,
-                                            const int  SuffixBytes  = 2
+                                            const int  SuffixBytes  = 2,
+                                            const int  Transport    = OSVVM_COSIM_TCP,
+                                            const std::string Path  = "",
+                                            const bool Connect      = true
                                             ) ;
 
     // User entry point method
            int               ProcessPkts   (void);
 
+    // Configuration method, to enable or disable coalescing of pipelined responses
+           void              SetCoalesce   (const bool Coalesce) {coalesce = Coalesce;}
+
+    // Configuration method, to enable a network I/O thread that receives and parses
+    // packets ahead of their processing. Must be called before ProcessPkts(), and
+    // any ParsePkt() override is then called from the I/O thread.
+           void              SetAsyncIo    (const bool AsyncIo)  {async_io = AsyncIo;}
+
     ////////////////////////////////
     // PROTECTED
     ////////////////////////////////
@@ -120,13 +224,40 @@ protected:
                                             const char        EopByte,
                                             const bool        LittleEndian) ;
 
+    // Internal type definition
+
+#if defined (_WIN32) || defined (_WIN64)
+           // Map the socket type for windows
+           typedef SOCKET    osvvm_cosim_skt_t;
+#else
+           // Map the socket type for Linux
+           typedef long long osvvm_cosim_skt_t;
+#endif
+
+           static const int  DEFAULT_TCP_PORTNUM = 0xc000;
+           static const int  TX_COALESCE_SIZE    = 0x10000;
+
+    // Methods shared with derived servers
+           osvvm_cosim_skt_t listen_skt      (const int portno, int &boundport);
+           bool              proc_cmd        (CmdAttrType &cmd_rec, const int nodenum);
+           int               bin_pkt_size    (const char* buf, const int len);
+           std::string       gen_int_pkt     (const int vec, const int nodenum, const bool bin);
+
+    // Packet protocol configuration shared with derived servers
+    const  bool              little_endian;
+    const  char              sop_char;
+    const  char              eop_char;
+    const  int               suffix_bytes;
+
+           // Coalescing of pipelined responses enabled
+           bool              coalesce;
+
     ////////////////////////////////
     // PRIVATE
     ////////////////////////////////
 
 private:
     // Internal constants
-           static const int  DEFAULT_TCP_PORTNUM = 0xc000;
            static const int  HEX_BUF_SIZE        = 100;
            static const char GDB_ACK_CHAR        = '+';
            static const char GDB_NAK_CHAR        = '-';
@@ -134,33 +265,53 @@ private:
            static const char GDB_EOP_CHAR        = '#';
            static const char GDB_MEM_DELIM_CHAR  = ':';
            static const int  MAXBACKLOG          = 5;
+           static const int  RX_BUF_SIZE         = 4096; // Must be a power of 2
+           static const int  BURST_CHUNK_SIZE    = DATABUF_SIZE/2; // Must be a power of 2
+           static const char GDB_ESC_CHAR        = '}';
+           static const char GDB_NOTIFY_CHAR     = '%';
 
-           // Hexadecimal character LUT
-           static const char HEXCHARS[HEX_BUF_SIZE] ;
+           // Query commands to switch to the binary protocol, and to no-ack mode, and to
+           // subscribe to interrupt notifications
+           static const char BIN_NEGOTIATE_STR[] ;
+           static const char NOACK_START_STR[] ;
+           static const char INT_NOTIFY_STR[] ;
 
-    // Internal type definition
+           // Interrupt notification string
+           static const char INT_EVENT_STR[] ;
 
-#if defined (_WIN32) || defined (_WIN64)
-           // Map the socket type for windows
-           typedef SOCKET    osvvm_cosim_skt_t;
-#else
-           // Map the socket type for Linux
-           typedef long long osvvm_cosim_skt_t;
-#endif
+           // Hexadecimal character LUT
+           static const char HEXCHARS[HEX_BUF_SIZE] ;
 
     // Private methods
 
            // Methods for managing the socket connection
            int               init            (void);
+           osvvm_cosim_skt_t listen_unix_skt (const std::string &path);
            osvvm_cosim_skt_t connect_skt     (const int portno);
            void              cleanup         (void);
 
            // Methods for processing commands
-           bool              proc_cmd        (CmdAttrType &cmd_rec);
            bool              read_cmd        (const osvvm_cosim_skt_t skt_hdl,       char* buf);
-           bool              write_cmd       (const osvvm_cosim_skt_t skt_hdl, const char* buf);
+           bool              write_cmd       (const osvvm_cosim_skt_t skt_hdl, const char* buf, const int len);
+           bool              flush_tx        (void);
+           void              proc_op         (CmdAttrType &cmd_rec, const int nodenum);
+           int               next_cmd        (std::string &cmdstr, CmdAttrType &cmd_rec);
+           void              io_loop         (void);
+           void              stop_io         (void);
+
+           // Interrupt tap, registered whilst the client is subscribed to interrupts
+    static void              int_tap         (const int vec, const uint32_t nodenum, void* hdl);
+
+           // Methods for the buffered socket receive data
+           bool              fill_rx_buf     (const osvvm_cosim_skt_t skt_hdl);
+           int               rx_span         (const osvvm_cosim_skt_t skt_hdl, const char* &span);
 
            int               fetch_next_pkt  (const osvvm_cosim_skt_t skt, std::string &cmdstr);
+           int               fetch_bin_bytes (const osvvm_cosim_skt_t skt, std::string &cmdstr, const int len);
+
+           // Methods for the binary protocol
+           CmdAttrType       parse_bin_pkt   (const std::string &cmdstr);
+           std::string       gen_bin_resp    (const CmdAttrType &resp);
 
            // Utility methods
     inline int               char2nib        (char x)
@@ -173,18 +324,54 @@ private:
     inline char              hihexchar       (unsigned x){ return HEXCHARS[(x & 0xf0) >> 4]; }
     inline char              lohexchar       (unsigned x){ return HEXCHARS[x & 0x0f]; }
 
+    inline uint64_t          get_le          (const char* buf, const int bytes)
+                             {
+                                 uint64_t val = 0;
+                                 for (int idx = bytes-1; idx >= 0; idx--) val = (val << 8) | (uint8_t)buf[idx];
+                                 return val;
+                             }
+
+    inline void              put_le          (std::string &buf, uint64_t val, const int bytes)
+                             {
+                                 for (int idx = 0; idx < bytes; idx++, val >>= 8) buf.push_back((char)(val & 0xff));
+                             }
+
     // Private member variables
 
-           // TCP/IP connection state
+           // Host connection state, with the socket handle for TCP and Unix domain
+           // sockets, and the ring pair for shared memory
            osvvm_cosim_skt_t skt_hdl;
     const  int               portnum;
+    const  int               transport;
+           std::string       path;
+           OsvvmCosimShmRing shm;
+
+           // Socket receive ring buffer, with free running read and write indexes
+           char              rx_buf[RX_BUF_SIZE];
+           uint32_t          rx_rd_idx;
+           uint32_t          rx_wr_idx;
+
+           // Binary protocol, or no-ack mode, negotiated for the connection
+           bool              binary;
+           bool              no_ack;
+
+           // Pipelined responses waiting to be sent, when coalescing
+           std::string       tx_pend;
+
+           // Network I/O thread, when enabled, with its queue of parsed commands and its
+           // final status
+           bool              async_io;
+           std::thread       io_thread;
+           int               io_status;
+           OsvvmCosimSpscQueue<CmdAttrType> rx_queue;
+
+           // Interrupt vector changes, whilst subscribed, to be notified before the
+           // current transaction's response
+           bool              int_notify;
+           std::vector<int>  int_events;
 
            // Configuration state for packet protocol
-    const  bool              little_endian;
-    const  char              sop_char;
-    const  char              eop_char;
     const  char              ack_char;
-    const  int               suffix_bytes;
     const  int               node;
 
 };
@@ -0,0 +1,1136 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimSktClient.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Defines methods for the OsvvmCosimSktClient class, a host side
+//      client of the co-simulation socket over TCP/IP, Unix domain
+//      socket or shared memory transports, and its C API
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+#if defined (_WIN32) || defined (_WIN64)
+# undef   UNICODE
+# define  WIN32_LEAN_AND_MEAN
+
+# include <windows.h>
+# include <winsock2.h>
+# include <ws2tcpip.h>
+#else
+# include <unistd.h>
+# include <sys/types.h>
+# include <sys/socket.h>
+# include <sys/un.h>
+# include <netinet/in.h>
+# include <netinet/tcp.h>
+# include <netdb.h>
+#endif
+
+#include "OsvvmCosimSktClient.h"
+
+// -------------------------------------------------------------------------
+// DEFINES
+// -------------------------------------------------------------------------
+
+#define CLIENT_SOP_CHAR   '$'
+#define CLIENT_EOP_CHAR   '#'
+#define CLIENT_NOTIFY_CHAR '%'
+#define CLIENT_INT_STR    "Interrupt:"
+
+// -------------------------------------------------------------------------
+// Constructor
+// -------------------------------------------------------------------------
+
+OsvvmCosimSktClient::OsvvmCosimSktClient (void) :
+    transport(OSVVM_COSIM_TCP), connected(false), skt_hdl(-1), rx_rd_idx(0), rx_wr_idx(0),
+    binary(false), next_tag(0), resp_bytes(0), resp_error(false), int_vec(0), int_cb(NULL), int_hdl(NULL)
+{
+}
+
+// -------------------------------------------------------------------------
+// Destructor
+// -------------------------------------------------------------------------
+
+OsvvmCosimSktClient::~OsvvmCosimSktClient (void)
+{
+    Close();
+}
+
+// -------------------------------------------------------------------------
+// Connect()
+//
+// Connect to the simulation over the selected transport. For TCP/IP,
+// Name is the host name or address, and defaults to localhost. For the
+// Unix domain socket and shared memory transports, Name is the socket
+// path or shared memory object name, and, if empty, is derived from
+// PortNumber in the same way as the simulation side. Returns
+// OSVVM_COSIM_OK on success, else OSVVM_COSIM_ERR.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::Connect (const int Transport, const int PortNumber, const std::string Name)
+{
+    std::string name = Name;
+    int         status;
+
+    Close();
+
+    transport  = Transport;
+    rx_rd_idx  = 0;
+    rx_wr_idx  = 0;
+    binary     = false;
+    resp_bytes = 0;
+    resp_error = false;
+
+    tx_pend.clear();
+    pending.clear();
+
+    if (name.empty() && transport != OSVVM_COSIM_TCP)
+    {
+        char defname[64];
+        sprintf(defname, (transport == OSVVM_COSIM_SHM) ? OSVVM_COSIM_SHM_NAME_FMT : OSVVM_COSIM_UNIX_PATH_FMT, PortNumber);
+        name = defname;
+    }
+
+    switch (transport)
+    {
+    case OSVVM_COSIM_TCP:
+        status = connect_tcp(PortNumber, name.empty() ? "localhost" : name);
+        break;
+
+    case OSVVM_COSIM_UNIX:
+        status = connect_unix(name);
+        break;
+
+    case OSVVM_COSIM_SHM:
+        if ((status = shm.attach(name)) < 0)
+        {
+            fprintf(stderr, "***ERROR: OsvvmCosimSktClient::Connect() failed to attach to shared memory %s\n", name.c_str());
+        }
+        break;
+
+    default:
+        fprintf(stderr, "***ERROR: OsvvmCosimSktClient::Connect() unrecognised transport %d\n", transport);
+        status = OSVVM_COSIM_ERR;
+        break;
+    }
+
+    connected = (status == OSVVM_COSIM_OK);
+
+    return connected ? OSVVM_COSIM_OK : OSVVM_COSIM_ERR;
+}
+
+// -------------------------------------------------------------------------
+// Close()
+//
+// Close the connection, if open
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktClient::Close (void)
+{
+    if (transport == OSVVM_COSIM_SHM)
+    {
+        shm.detach();
+    }
+    else if (skt_hdl != (osvvm_cosim_skt_t)-1)
+    {
+        closesocket(skt_hdl);
+        skt_hdl = -1;
+
+#if defined (_WIN32) || defined (_WIN64)
+        WSACleanup();
+#endif
+    }
+
+    connected = false;
+}
+
+// -------------------------------------------------------------------------
+// Send()
+//
+// Send len bytes from buf, returning OSVVM_COSIM_OK once all are sent,
+// else OSVVM_COSIM_ERR.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::Send (const char* buf, const int len)
+{
+    if (!connected)
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    if (transport == OSVVM_COSIM_SHM)
+    {
+        return shm.write(buf, len) ? OSVVM_COSIM_OK : OSVVM_COSIM_ERR;
+    }
+
+    for (int idx = 0; idx < len; )
+    {
+        int sent = send(skt_hdl, &buf[idx], len - idx, 0);
+
+        if (sent < 0)
+        {
+            return OSVVM_COSIM_ERR;
+        }
+
+        idx += sent;
+    }
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// Recv()
+//
+// Receive up to maxlen bytes into buf, taking any already buffered first,
+// and otherwise waiting for some to arrive. Returns the number of bytes
+// received, 0 if the connection has been closed, or OSVVM_COSIM_ERR.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::Recv (char* buf, const int maxlen)
+{
+    if (rx_rd_idx < rx_wr_idx)
+    {
+        int len = (rx_wr_idx - rx_rd_idx < maxlen) ? rx_wr_idx - rx_rd_idx : maxlen;
+
+        memcpy(buf, &rx_buf[rx_rd_idx], len);
+        rx_rd_idx += len;
+
+        return len;
+    }
+
+    if (!connected)
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    return raw_recv(buf, maxlen);
+}
+
+// -------------------------------------------------------------------------
+// SendPkt()
+//
+// Send a command as a gdb remote serial protocol packet, adding the start
+// and end of packet characters and the checksum.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::SendPkt (const std::string Cmd)
+{
+    static const char hexchars[] = "0123456789abcdef";
+
+    std::string pkt;
+    uint8_t     chksum = 0;
+
+    pkt.reserve(Cmd.length() + 4);
+
+    pkt.push_back(CLIENT_SOP_CHAR);
+
+    for (size_t idx = 0; idx < Cmd.length(); idx++)
+    {
+        chksum += (uint8_t)Cmd[idx];
+    }
+
+    pkt.append(Cmd);
+    pkt.push_back(CLIENT_EOP_CHAR);
+    pkt.push_back(hexchars[chksum >> 4]);
+    pkt.push_back(hexchars[chksum & 0xf]);
+
+    return Send(pkt.data(), pkt.length());
+}
+
+// -------------------------------------------------------------------------
+// RecvPkt()
+//
+// Receive a gdb remote serial protocol response packet, skipping any
+// acknowledgement before it, and return its contents, without the
+// framing or checksum, in Resp. Any interrupt notifications before it
+// are handled.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::RecvPkt (std::string &Resp)
+{
+    int  byte;
+    bool notify;
+
+    do
+    {
+        Resp.clear();
+
+        // Skip to the start of packet, or of a notification
+        do
+        {
+            if ((byte = next_byte()) < 0)
+            {
+                return OSVVM_COSIM_ERR;
+            }
+        } while (byte != CLIENT_SOP_CHAR && byte != CLIENT_NOTIFY_CHAR);
+
+        notify = (byte == CLIENT_NOTIFY_CHAR);
+
+        // Accumulate the packet contents up to the end of packet
+        while ((byte = next_byte()) != CLIENT_EOP_CHAR)
+        {
+            if (byte < 0)
+            {
+                return OSVVM_COSIM_ERR;
+            }
+
+            Resp.push_back((char)byte);
+        }
+
+        // Discard the checksum
+        if (next_byte() < 0 || next_byte() < 0)
+        {
+            return OSVVM_COSIM_ERR;
+        }
+
+        if (notify && Resp.compare(0, strlen(CLIENT_INT_STR), CLIENT_INT_STR) == 0)
+        {
+            interrupt((int)strtoul(Resp.c_str() + strlen(CLIENT_INT_STR), NULL, 16));
+        }
+
+    } while (notify);
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// Transact()
+//
+// Send a command packet and wait for its response
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::Transact (const std::string Cmd, std::string &Resp)
+{
+    if (SendPkt(Cmd) != OSVVM_COSIM_OK)
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    return RecvPkt(Resp);
+}
+
+// -------------------------------------------------------------------------
+// StartNoAckMode()
+//
+// Negotiate no-ack mode, returning OSVVM_COSIM_OK if accepted. Any number
+// of packets may then be sent with SendPkt() before collecting their
+// responses, in order, with RecvPkt().
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::StartNoAckMode (void)
+{
+    std::string resp;
+
+    if (Transact("QStartNoAckMode", resp) != OSVVM_COSIM_OK || resp != "OK")
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSktClient::connect_tcp()
+//
+// Open a TCP/IP connection to the host and port number, without delaying
+// sends to coalesce them.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::connect_tcp (const int portno, const std::string &host)
+{
+    struct addrinfo  hints;
+    struct addrinfo* addrs;
+    char             portstr[16];
+    int              enable = 1;
+
+#if defined (_WIN32) || defined (_WIN64)
+    WSADATA wsaData;
+
+    if (WSAStartup(MAKEWORD(VER_MAJOR, VER_MINOR), &wsaData))
+    {
+        fprintf(stderr, "***ERROR: OsvvmCosimSktClient::Connect() WSAStartup failed\n");
+        return OSVVM_COSIM_ERR;
+    }
+#endif
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    sprintf(portstr, "%d", portno);
+
+    if (getaddrinfo(host.c_str(), portstr, &hints, &addrs) != 0)
+    {
+        fprintf(stderr, "***ERROR: OsvvmCosimSktClient::Connect() unknown host %s\n", host.c_str());
+        return OSVVM_COSIM_ERR;
+    }
+
+    // Try each address for the host until one connects
+    for (struct addrinfo* addr = addrs; addr != NULL; addr = addr->ai_next)
+    {
+        if ((skt_hdl = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol)) < 0)
+        {
+            continue;
+        }
+
+        if (connect(skt_hdl, addr->ai_addr, addr->ai_addrlen) == 0)
+        {
+            break;
+        }
+
+        closesocket(skt_hdl);
+        skt_hdl = -1;
+    }
+
+    freeaddrinfo(addrs);
+
+    if (skt_hdl == (osvvm_cosim_skt_t)-1)
+    {
+        fprintf(stderr, "***ERROR: OsvvmCosimSktClient::Connect() failed to connect to %s:%d\n", host.c_str(), portno);
+        return OSVVM_COSIM_ERR;
+    }
+
+    setsockopt(skt_hdl, IPPROTO_TCP, TCP_NODELAY, (char*)&enable, sizeof(int));
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSktClient::connect_unix()
+//
+// Open a Unix domain socket connection to the socket at path
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::connect_unix (const std::string &path)
+{
+#if defined (_WIN32) || defined (_WIN64)
+
+    fprintf(stderr, "***ERROR: OsvvmCosimSktClient::Connect() Unix domain sockets not supported on Windows\n");
+    return OSVVM_COSIM_ERR;
+
+#else
+
+    struct sockaddr_un addr;
+
+    if (path.length() >= sizeof(addr.sun_path))
+    {
+        fprintf(stderr, "***ERROR: OsvvmCosimSktClient::Connect() Unix domain socket path too long: %s\n", path.c_str());
+        return OSVVM_COSIM_ERR;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path.c_str());
+
+    if ((skt_hdl = socket(AF_UNIX, SOCK_STREAM, 0)) < 0 ||
+        connect(skt_hdl, (struct sockaddr*)&addr, sizeof(addr)) < 0)
+    {
+        fprintf(stderr, "***ERROR: OsvvmCosimSktClient::Connect() failed to connect to %s\n", path.c_str());
+
+        if (skt_hdl >= 0)
+        {
+            closesocket(skt_hdl);
+        }
+        skt_hdl = -1;
+
+        return OSVVM_COSIM_ERR;
+    }
+
+    return OSVVM_COSIM_OK;
+
+#endif
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSktClient::raw_recv()
+//
+// Receive up to maxlen bytes from the connection into buf, waiting for
+// some to arrive, and bypassing the receive buffer
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::raw_recv (char* buf, const int maxlen)
+{
+    if (transport == OSVVM_COSIM_SHM)
+    {
+        return shm.read(buf, maxlen);
+    }
+
+    return recv(skt_hdl, buf, maxlen, 0);
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSktClient::fill_rx_buf()
+//
+// Refill the (empty) receive buffer with as many bytes as are available,
+// waiting for some to arrive. Returns OSVVM_COSIM_ERR if the connection
+// is closed or in error.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::fill_rx_buf (void)
+{
+    int len;
+
+    rx_rd_idx = 0;
+    rx_wr_idx = 0;
+
+    if (!connected || (len = raw_recv(rx_buf, RX_BUF_SIZE)) <= 0)
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    rx_wr_idx = len;
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSktClient::next_byte()
+//
+// Return the next received byte, refilling the receive buffer as
+// necessary, or OSVVM_COSIM_ERR if the connection is closed or in error.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::next_byte (void)
+{
+    if (rx_rd_idx == rx_wr_idx && fill_rx_buf() != OSVVM_COSIM_OK)
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    return (uint8_t)rx_buf[rx_rd_idx++];
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSktClient::recv_bytes()
+//
+// Receive exactly len bytes into buf, from the receive buffer, refilling
+// it as necessary, except for large remainders, which are received
+// directly into buf.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::recv_bytes (char* buf, const int len)
+{
+    for (int idx = 0; idx < len; )
+    {
+        int avail;
+
+        if (rx_rd_idx == rx_wr_idx)
+        {
+            if (len - idx >= RX_BUF_SIZE)
+            {
+                if (!connected || (avail = raw_recv(&buf[idx], len - idx)) <= 0)
+                {
+                    return OSVVM_COSIM_ERR;
+                }
+
+                idx += avail;
+                continue;
+            }
+
+            if (fill_rx_buf() != OSVVM_COSIM_OK)
+            {
+                return OSVVM_COSIM_ERR;
+            }
+        }
+
+        avail = std::min(rx_wr_idx - rx_rd_idx, len - idx);
+
+        memcpy(&buf[idx], &rx_buf[rx_rd_idx], avail);
+
+        rx_rd_idx += avail;
+        idx       += avail;
+    }
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSktClient::start_binary()
+//
+// Negotiate the binary protocol, for the transaction methods
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::start_binary (void)
+{
+    std::string resp;
+
+    if (Transact("QOsvvmBinary", resp) != OSVVM_COSIM_OK || resp != "OK")
+    {
+        fprintf(stderr, "***ERROR: OsvvmCosimSktClient: binary protocol refused\n");
+        return OSVVM_COSIM_ERR;
+    }
+
+    binary = true;
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSktClient::queue_req()
+//
+// Add a binary protocol request to the send buffer, and to the pending
+// requests, returning its tag. Responses are first collected, as needed,
+// to keep within the pipeline window, and the send buffer is sent once
+// full. Returns OSVVM_COSIM_ERR if not connected, or on a failure.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::queue_req (const int op, const int width, const uint64_t addr, const uint8_t* payload,
+                                    const int len, const int prot, const int rdlen, uint64_t* data, uint8_t* buf,
+                                    const uint32_t param)
+{
+    if (!connected || (!binary && start_binary() != OSVVM_COSIM_OK))
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    while (!pending.empty() && ((int)pending.size() >= PIPELINE_WINDOW || resp_bytes + BIN_HDR_SIZE + rdlen > RESP_WINDOW))
+    {
+        if (Flush() != OSVVM_COSIM_OK || recv_resp() != OSVVM_COSIM_OK)
+        {
+            return OSVVM_COSIM_ERR;
+        }
+    }
+
+    pending_t req = {next_tag++ & 0x7fffffff, rdlen, data, buf};
+    uint64_t  hdr[3];
+    uint8_t*  hdr8 = (uint8_t*)hdr;
+
+    // Little endian header fields: magic, op, width, prot, tag, address, payload length, parameter
+    hdr8[0] = BIN_MAGIC;
+    hdr8[1] = op;
+    hdr8[2] = width;
+    hdr8[3] = prot;
+
+    for (int idx = 0; idx < 4; idx++)
+    {
+        hdr8[4+idx]  = (uint8_t)(req.tag >> (8*idx));
+        hdr8[16+idx] = (uint8_t)(len     >> (8*idx));
+        hdr8[20+idx] = (uint8_t)(param   >> (8*idx));
+    }
+
+    for (int idx = 0; idx < 8; idx++)
+    {
+        hdr8[8+idx]  = (uint8_t)(addr >> (8*idx));
+    }
+
+    tx_pend.append((const char*)hdr8, BIN_HDR_SIZE);
+    tx_pend.append((const char*)payload, len);
+
+    pending.push_back(req);
+    resp_bytes += BIN_HDR_SIZE + rdlen;
+
+    if (tx_pend.length() >= TX_BUF_SIZE && Flush() != OSVVM_COSIM_OK)
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    return (int)req.tag;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSktClient::recv_resp()
+//
+// Receive the response for the oldest pending request, placing any read
+// data as requested, and flagging any error status
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::recv_resp (void)
+{
+    uint8_t hdr[BIN_HDR_SIZE];
+    uint8_t word[8];
+
+    uint32_t tag;
+    uint32_t param;
+    int      len;
+
+    // Receive the next header, handling any interrupt notifications before it
+    do
+    {
+        if (pending.empty() || recv_bytes((char*)hdr, BIN_HDR_SIZE) != OSVVM_COSIM_OK)
+        {
+            return OSVVM_COSIM_ERR;
+        }
+
+        tag   = 0;
+        param = 0;
+        len   = 0;
+
+        for (int idx = 3; idx >= 0; idx--)
+        {
+            tag   = (tag   << 8) | hdr[4+idx];
+            len   = (len   << 8) | hdr[16+idx];
+            param = (param << 8) | hdr[20+idx];
+        }
+
+        if (hdr[1] == BIN_OP_INTERRUPT && tag == BIN_NOTIFY_TAG)
+        {
+            interrupt((int)param);
+        }
+
+    } while (hdr[1] == BIN_OP_INTERRUPT && tag == BIN_NOTIFY_TAG);
+
+    pending_t req = pending.front();
+
+    pending.pop_front();
+    resp_bytes -= BIN_HDR_SIZE + req.rdlen;
+
+    if (hdr[0] != BIN_MAGIC || tag != req.tag || len < 0 || len > BIN_MAX_PAYLOAD)
+    {
+        fprintf(stderr, "***ERROR: OsvvmCosimSktClient: bad response (tag %d, expected %d)\n", tag, req.tag);
+        return OSVVM_COSIM_ERR;
+    }
+
+    resp_error |= (hdr[3] != 0);
+
+    // Place read data, discarding anything beyond the expected length
+    int rdlen = std::min(len, req.rdlen);
+
+    if (req.data != NULL && len <= 8)
+    {
+        if (recv_bytes((char*)word, len) != OSVVM_COSIM_OK)
+        {
+            return OSVVM_COSIM_ERR;
+        }
+
+        *req.data = 0;
+
+        for (int idx = rdlen-1; idx >= 0; idx--)
+        {
+            *req.data = (*req.data << 8) | word[idx];
+        }
+
+        return OSVVM_COSIM_OK;
+    }
+
+    if (req.buf != NULL && recv_bytes((char*)req.buf, rdlen) != OSVVM_COSIM_OK)
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    for (len -= (req.buf != NULL) ? rdlen : 0; len > 0; len -= std::min(len, 8))
+    {
+        if (recv_bytes((char*)word, std::min(len, 8)) != OSVVM_COSIM_OK)
+        {
+            return OSVVM_COSIM_ERR;
+        }
+    }
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimSktClient::interrupt()
+//
+// Record a notified interrupt vector, and call any registered callback
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktClient::interrupt (const int vec)
+{
+    int_vec = vec;
+
+    if (int_cb != NULL)
+    {
+        (*int_cb)(vec, int_hdl);
+    }
+}
+
+// -------------------------------------------------------------------------
+// Asynchronous word transaction methods
+// -------------------------------------------------------------------------
+
+static inline bool word_size (const int bytes)
+{
+    return bytes == 1 || bytes == 2 || bytes == 4 || bytes == 8;
+}
+
+int OsvvmCosimSktClient::WriteAsync (const uint64_t Addr, const uint64_t Data, const int Bytes, const int Prot)
+{
+    uint8_t wdata[8];
+
+    if (!word_size(Bytes))
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    for (int idx = 0; idx < 8; idx++)
+    {
+        wdata[idx] = (uint8_t)(Data >> (8*idx));
+    }
+
+    return queue_req(BIN_OP_WRITE, Bytes, Addr, wdata, Bytes, Prot, 0, NULL, NULL);
+}
+
+int OsvvmCosimSktClient::ReadAsync (const uint64_t Addr, uint64_t* Data, const int Bytes, const int Prot)
+{
+    if (!word_size(Bytes))
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    return queue_req(BIN_OP_READ, Bytes, Addr, NULL, 0, Prot, Bytes, Data, NULL);
+}
+
+int OsvvmCosimSktClient::ReadCheckAsync (const uint64_t Addr, const uint64_t Expected, const int Bytes, const int Prot)
+{
+    uint8_t expdata[8];
+
+    if (!word_size(Bytes))
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    for (int idx = 0; idx < 8; idx++)
+    {
+        expdata[idx] = (uint8_t)(Expected >> (8*idx));
+    }
+
+    return queue_req(BIN_OP_READ_CHECK, Bytes, Addr, expdata, Bytes, Prot, 0, NULL, NULL);
+}
+
+// -------------------------------------------------------------------------
+// Asynchronous burst transaction methods. Bursts larger than the maximum
+// payload are split, returning the tag of the last part, as requests
+// complete in order.
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::BurstWriteAsync (const uint64_t Addr, const uint8_t* Data, const int Len, const int Prot)
+{
+    int tag = OSVVM_COSIM_ERR;
+
+    for (int idx = 0; idx < Len; idx += BIN_MAX_PAYLOAD)
+    {
+        if ((tag = queue_req(BIN_OP_BURST_WRITE, 0, Addr + idx, &Data[idx], std::min(Len - idx, BIN_MAX_PAYLOAD), Prot, 0, NULL, NULL)) < 0)
+        {
+            break;
+        }
+    }
+
+    return tag;
+}
+
+int OsvvmCosimSktClient::BurstReadAsync (const uint64_t Addr, uint8_t* Data, const int Len, const int Prot)
+{
+    int tag = OSVVM_COSIM_ERR;
+
+    for (int idx = 0; idx < Len; idx += BIN_MAX_PAYLOAD)
+    {
+        int chunk = std::min(Len - idx, BIN_MAX_PAYLOAD);
+
+        // The read length is the request's parameter
+        if ((tag = queue_req(BIN_OP_BURST_READ, 0, Addr + idx, NULL, 0, Prot, chunk, NULL, &Data[idx], chunk)) < 0)
+        {
+            break;
+        }
+    }
+
+    return tag;
+}
+
+int OsvvmCosimSktClient::BurstReadCheckAsync (const uint64_t Addr, const uint8_t* Expected, const int Len, const int Prot)
+{
+    int tag = OSVVM_COSIM_ERR;
+
+    for (int idx = 0; idx < Len; idx += BIN_MAX_PAYLOAD)
+    {
+        if ((tag = queue_req(BIN_OP_BURST_READ_CHECK, 0, Addr + idx, &Expected[idx], std::min(Len - idx, BIN_MAX_PAYLOAD), Prot, 0, NULL, NULL)) < 0)
+        {
+            break;
+        }
+    }
+
+    return tag;
+}
+
+// -------------------------------------------------------------------------
+// Synchronous transaction methods, as the asynchronous methods followed
+// by a wait for their completion
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::Write (const uint64_t Addr, const uint64_t Data, const int Bytes, const int Prot)
+{
+    return Wait(WriteAsync(Addr, Data, Bytes, Prot));
+}
+
+int OsvvmCosimSktClient::Read (const uint64_t Addr, uint64_t &Data, const int Bytes, const int Prot)
+{
+    return Wait(ReadAsync(Addr, &Data, Bytes, Prot));
+}
+
+int OsvvmCosimSktClient::ReadCheck (const uint64_t Addr, const uint64_t Expected, const int Bytes, const int Prot)
+{
+    return Wait(ReadCheckAsync(Addr, Expected, Bytes, Prot));
+}
+
+int OsvvmCosimSktClient::BurstWrite (const uint64_t Addr, const uint8_t* Data, const int Len, const int Prot)
+{
+    return Wait(BurstWriteAsync(Addr, Data, Len, Prot));
+}
+
+int OsvvmCosimSktClient::BurstRead (const uint64_t Addr, uint8_t* Data, const int Len, const int Prot)
+{
+    return Wait(BurstReadAsync(Addr, Data, Len, Prot));
+}
+
+int OsvvmCosimSktClient::BurstReadCheck (const uint64_t Addr, const uint8_t* Expected, const int Len, const int Prot)
+{
+    return Wait(BurstReadCheckAsync(Addr, Expected, Len, Prot));
+}
+
+// -------------------------------------------------------------------------
+// Flush()
+//
+// Send all buffered requests with a single write
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::Flush (void)
+{
+    int status = OSVVM_COSIM_OK;
+
+    if (!tx_pend.empty())
+    {
+        status = Send(tx_pend.data(), tx_pend.length());
+        tx_pend.clear();
+    }
+
+    return status;
+}
+
+// -------------------------------------------------------------------------
+// Wait()
+//
+// Send any buffered requests and wait for the request with the given tag,
+// and all those before it, to complete. Returns OSVVM_COSIM_ERR if the tag
+// is invalid, or the connection fails, or any request completed since the
+// last wait had an error.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::Wait (const int Tag)
+{
+    if (Tag < 0 || Flush() != OSVVM_COSIM_OK)
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    // Nothing to wait for if the request is no longer pending
+    std::deque<pending_t>::const_iterator it = pending.begin();
+
+    while (it != pending.end() && it->tag != (uint32_t)Tag)
+    {
+        it++;
+    }
+
+    for (int count = (it == pending.end()) ? 0 : (int)(it - pending.begin()) + 1; count > 0; count--)
+    {
+        if (recv_resp() != OSVVM_COSIM_OK)
+        {
+            return OSVVM_COSIM_ERR;
+        }
+    }
+
+    int status = resp_error ? OSVVM_COSIM_ERR : OSVVM_COSIM_OK;
+
+    resp_error = false;
+
+    return status;
+}
+
+// -------------------------------------------------------------------------
+// WaitAll()
+//
+// Send any buffered requests and wait for all pending requests to complete
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::WaitAll (void)
+{
+    return Wait(pending.empty() ? 0 : (int)pending.back().tag);
+}
+
+// -------------------------------------------------------------------------
+// Detach()
+//
+// Complete any pending requests and detach from the simulation
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::Detach (void)
+{
+    std::string resp;
+
+    if (!binary)
+    {
+        return Transact("D", resp);
+    }
+
+    int status = WaitAll();
+
+    if (Wait(queue_req(BIN_OP_DETACH, 0, 0, NULL, 0, 0, 0, NULL, NULL)) != OSVVM_COSIM_OK)
+    {
+        status = OSVVM_COSIM_ERR;
+    }
+
+    return status;
+}
+
+// -------------------------------------------------------------------------
+// SubscribeInterrupts()
+//
+// Subscribe to (or, if Enable is false, unsubscribe from) the node's
+// interrupt notifications, in whichever protocol is in use
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::SubscribeInterrupts (const bool Enable)
+{
+    std::string resp;
+
+    if (!binary)
+    {
+        if (Transact(Enable ? "QOsvvmInterrupts:1" : "QOsvvmInterrupts:0", resp) != OSVVM_COSIM_OK || resp != "OK")
+        {
+            return OSVVM_COSIM_ERR;
+        }
+
+        return OSVVM_COSIM_OK;
+    }
+
+    return Wait(queue_req(BIN_OP_INTERRUPT, 0, 0, NULL, 0, 0, 0, NULL, NULL, Enable ? 1 : 0));
+}
+
+// -------------------------------------------------------------------------
+// Tick()
+//
+// Advance the simulation by Ticks clock cycles, with no transaction,
+// receiving any interrupt notifications in that time
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktClient::Tick (const uint32_t Ticks)
+{
+    return Wait(queue_req(BIN_OP_TICK, 0, 0, NULL, 0, 0, 0, NULL, NULL, Ticks));
+}
+
+// -------------------------------------------------------------------------
+// C API
+// -------------------------------------------------------------------------
+
+#define CLIENT(_h) ((OsvvmCosimSktClient*)(_h))
+
+osvvm_cosim_client_t OsvvmCosimClientOpen (const int transport, const int portnum, const char* name)
+{
+    OsvvmCosimSktClient* client = new OsvvmCosimSktClient;
+
+    if (client->Connect(transport, portnum, (name != NULL) ? name : "") != OsvvmCosimSktClient::OSVVM_COSIM_OK)
+    {
+        delete client;
+        return NULL;
+    }
+
+    return client;
+}
+
+void OsvvmCosimClientClose (osvvm_cosim_client_t hdl)                                                                          {delete CLIENT(hdl);}
+int  OsvvmCosimClientDetach (osvvm_cosim_client_t hdl)                                                                         {return CLIENT(hdl)->Detach();}
+
+int  OsvvmCosimClientWrite          (osvvm_cosim_client_t hdl, const uint64_t addr, const uint64_t data,     const int bytes, const int prot) {return CLIENT(hdl)->Write(addr, data, bytes, prot);}
+int  OsvvmCosimClientRead           (osvvm_cosim_client_t hdl, const uint64_t addr,       uint64_t* data,     const int bytes, const int prot) {return CLIENT(hdl)->Read(addr, *data, bytes, prot);}
+int  OsvvmCosimClientReadCheck      (osvvm_cosim_client_t hdl, const uint64_t addr, const uint64_t expected, const int bytes, const int prot) {return CLIENT(hdl)->ReadCheck(addr, expected, bytes, prot);}
+int  OsvvmCosimClientBurstWrite     (osvvm_cosim_client_t hdl, const uint64_t addr, const uint8_t* data,     const int len,   const int prot) {return CLIENT(hdl)->BurstWrite(addr, data, len, prot);}
+int  OsvvmCosimClientBurstRead      (osvvm_cosim_client_t hdl, const uint64_t addr,       uint8_t* data,     const int len,   const int prot) {return CLIENT(hdl)->BurstRead(addr, data, len, prot);}
+int  OsvvmCosimClientBurstReadCheck (osvvm_cosim_client_t hdl, const uint64_t addr, const uint8_t* expected, const int len,   const int prot) {return CLIENT(hdl)->BurstReadCheck(addr, expected, len, prot);}
+
+int  OsvvmCosimClientWriteAsync          (osvvm_cosim_client_t hdl, const uint64_t addr, const uint64_t data,     const int bytes, const int prot) {return CLIENT(hdl)->WriteAsync(addr, data, bytes, prot);}
+int  OsvvmCosimClientReadAsync           (osvvm_cosim_client_t hdl, const uint64_t addr,       uint64_t* data,     const int bytes, const int prot) {return CLIENT(hdl)->ReadAsync(addr, data, bytes, prot);}
+int  OsvvmCosimClientReadCheckAsync      (osvvm_cosim_client_t hdl, const uint64_t addr, const uint64_t expected, const int bytes, const int prot) {return CLIENT(hdl)->ReadCheckAsync(addr, expected, bytes, prot);}
+int  OsvvmCosimClientBurstWriteAsync     (osvvm_cosim_client_t hdl, const uint64_t addr, const uint8_t* data,     const int len,   const int prot) {return CLIENT(hdl)->BurstWriteAsync(addr, data, len, prot);}
+int  OsvvmCosimClientBurstReadAsync      (osvvm_cosim_client_t hdl, const uint64_t addr,       uint8_t* data,     const int len,   const int prot) {return CLIENT(hdl)->BurstReadAsync(addr, data, len, prot);}
+int  OsvvmCosimClientBurstReadCheckAsync (osvvm_cosim_client_t hdl, const uint64_t addr, const uint8_t* expected, const int len,   const int prot) {return CLIENT(hdl)->BurstReadCheckAsync(addr, expected, len, prot);}
+
+int  OsvvmCosimClientFlush   (osvvm_cosim_client_t hdl)                {return CLIENT(hdl)->Flush();}
+int  OsvvmCosimClientWait    (osvvm_cosim_client_t hdl, const int tag) {return CLIENT(hdl)->Wait(tag);}
+int  OsvvmCosimClientWaitAll (osvvm_cosim_client_t hdl)                {return CLIENT(hdl)->WaitAll();}
+
+int  OsvvmCosimClientSubscribeInterrupts (osvvm_cosim_client_t hdl, const int enable)                             {return CLIENT(hdl)->SubscribeInterrupts(enable != 0);}
+void OsvvmCosimClientSetInterruptCB      (osvvm_cosim_client_t hdl, void (*func)(const int, void*), void* cbhdl) {CLIENT(hdl)->SetInterruptCB(func, cbhdl);}
+int  OsvvmCosimClientInterrupt           (osvvm_cosim_client_t hdl)                                               {return CLIENT(hdl)->Interrupt();}
+int  OsvvmCosimClientTick                (osvvm_cosim_client_t hdl, const uint32_t ticks)                         {return CLIENT(hdl)->Tick(ticks);}
+
+// -------------------------------------------------------------------------
+// OsvvmCosimClientTransact()
+//
+// Send a gdb remote serial protocol command and copy the response, as a
+// null terminated string truncated to maxlen, into resp
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimClientTransact (osvvm_cosim_client_t hdl, const char* cmd, char* resp, const int maxlen)
+{
+    std::string respstr;
+
+    int status = CLIENT(hdl)->Transact(cmd, respstr);
+
+    if (maxlen > 0)
+    {
+        strncpy(resp, respstr.c_str(), maxlen - 1);
+        resp[maxlen - 1] = 0;
+    }
+
+    return status;
+}
@@ -0,0 +1,273 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimSktClient.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Class definition for a host side client of the co-simulation
+//      socket (OsvvmCosimSkt), connecting over any of its transports:
+//      TCP/IP, a Unix domain socket, or (Linux only) a shared memory
+//      ring pair. Raw bytes may be sent and received, or whole gdb remote
+//      serial protocol packets, with framing and checksums handled, and
+//      no-ack mode may be negotiated for pipelining packets. The
+//      class has no dependencies on the simulation side code, so may be
+//      compiled into separate host programs.
+//
+//      Transaction methods (reads, writes, bursts and read checks) use
+//      the binary protocol, negotiated on first use, and may be called
+//      synchronously, or asynchronously, with requests buffered and
+//      pipelined, and completed by tag, or as a batch. A C API wraps
+//      the class for other languages, as used by the Python binding
+//      (Scripts/osvvm_cosim_client.py), with the shared library built
+//      with 'make client'.
+//
+//      A client may subscribe to the simulation node's interrupts, with
+//      notifications of interrupt vector changes picked out from the
+//      responses they precede, and passed to a registered callback.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_COSIM_SKT_CLIENT_H_
+#define _OSVVM_COSIM_SKT_CLIENT_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string>
+#include <deque>
+
+#if defined (_WIN32) || defined (_WIN64)
+# include <Winsock2.h>
+#endif
+
+#include "OsvvmCosimSktHdr.h"
+#include "OsvvmCosimShmRing.h"
+
+// -------------------------------------------------------------------------
+// CLASS DEFINITION
+// -------------------------------------------------------------------------
+
+class OsvvmCosimSktClient
+{
+    ////////////////////////////////
+    // PUBLIC
+    ////////////////////////////////
+
+public:
+           static const int  OSVVM_COSIM_OK      = 0;
+           static const int  OSVVM_COSIM_ERR     = -1;
+
+           static const int  DEFAULT_TCP_PORTNUM = 0xc000;
+
+    // Constructor/destructor
+                             OsvvmCosimSktClient   (void);
+                            ~OsvvmCosimSktClient   (void);
+
+    // Connection methods. The name is the host for TCP (default localhost),
+    // else the socket path or shared memory object name, derived from the
+    // port number if empty, as for the simulation side
+           int               Connect         (const int         Transport  = OSVVM_COSIM_TCP,
+                                              const int         PortNumber = DEFAULT_TCP_PORTNUM,
+                                              const std::string Name       = "");
+           bool              Connected       (void) {return connected;}
+           void              Close           (void);
+
+    // Raw byte methods
+           int               Send            (const char* buf, const int len);
+           int               Recv            (char* buf, const int maxlen);
+
+    // Packet methods
+           int               SendPkt         (const std::string Cmd);
+           int               RecvPkt         (std::string &Resp);
+           int               Transact        (const std::string Cmd, std::string &Resp);
+
+    // Switch to no-ack mode, after which packets may be pipelined, with
+    // responses returned in order
+           int               StartNoAckMode  (void);
+
+    // Synchronous transaction methods, waiting for the response. Bytes is
+    // the word size (1, 2, 4 or 8), and read checks are made by the
+    // simulation, with any mismatch reported there. Returns OSVVM_COSIM_ERR
+    // if the connection fails or the simulation flags an error.
+           int               Write           (const uint64_t Addr, const uint64_t Data,     const int Bytes = 4, const int Prot = 0);
+           int               Read            (const uint64_t Addr,       uint64_t &Data,     const int Bytes = 4, const int Prot = 0);
+           int               ReadCheck       (const uint64_t Addr, const uint64_t Expected, const int Bytes = 4, const int Prot = 0);
+           int               BurstWrite      (const uint64_t Addr, const uint8_t* Data,     const int Len,       const int Prot = 0);
+           int               BurstRead       (const uint64_t Addr,       uint8_t* Data,     const int Len,       const int Prot = 0);
+           int               BurstReadCheck  (const uint64_t Addr, const uint8_t* Expected, const int Len,       const int Prot = 0);
+
+    // Asynchronous transaction methods, buffering a request and returning
+    // its tag (else OSVVM_COSIM_ERR). Requests are sent, pipelined, when the
+    // send buffer fills, or on Flush() or a wait, with any read data placed
+    // at Data, which must remain valid until the request completes
+           int               WriteAsync          (const uint64_t Addr, const uint64_t Data,     const int Bytes = 4, const int Prot = 0);
+           int               ReadAsync           (const uint64_t Addr,       uint64_t* Data,     const int Bytes = 4, const int Prot = 0);
+           int               ReadCheckAsync      (const uint64_t Addr, const uint64_t Expected, const int Bytes = 4, const int Prot = 0);
+           int               BurstWriteAsync     (const uint64_t Addr, const uint8_t* Data,     const int Len,       const int Prot = 0);
+           int               BurstReadAsync      (const uint64_t Addr,       uint8_t* Data,     const int Len,       const int Prot = 0);
+           int               BurstReadCheckAsync (const uint64_t Addr, const uint8_t* Expected, const int Len,       const int Prot = 0);
+
+    // Send buffered requests, and wait for a request (and all those before
+    // it) or all requests to complete, returning OSVVM_COSIM_ERR if any
+    // completed since the last wait had an error
+           int               Flush           (void);
+           int               Wait            (const int Tag);
+           int               WaitAll         (void);
+           int               Outstanding     (void) {return (int)pending.size();}
+
+    // Detach from the simulation, in whichever protocol is in use
+           int               Detach          (void);
+
+    // Interrupt notifications. Once subscribed, each change of the node's
+    // interrupt vector is notified ahead of the response to the request
+    // during which it occurred, calling any registered callback (from the
+    // thread receiving the response) with the new vector. Tick() advances
+    // the simulation, with no transaction, so that a host waiting on an
+    // interrupt need not poll registers.
+           typedef void      (*pIntCB_t)     (const int Vec, void* Hdl);
+
+           int               SubscribeInterrupts (const bool Enable = true);
+           void              SetInterruptCB  (const pIntCB_t Func, void* Hdl = NULL) {int_cb = Func; int_hdl = Hdl;}
+           int               Interrupt       (void) {return int_vec;}
+           int               Tick            (const uint32_t Ticks);
+
+    ////////////////////////////////
+    // PRIVATE
+    ////////////////////////////////
+
+private:
+
+#if defined (_WIN32) || defined (_WIN64)
+           typedef SOCKET    osvvm_cosim_skt_t;
+#else
+           typedef long long osvvm_cosim_skt_t;
+#endif
+
+           static const int  RX_BUF_SIZE         = 0x10000;
+           static const int  TX_BUF_SIZE         = 0x10000;
+
+           // Pipeline limits on outstanding requests and their response bytes,
+           // so that the simulation never blocks sending responses whilst the
+           // client is blocked sending requests (kept under the shared memory
+           // ring size)
+           static const int  PIPELINE_WINDOW     = 256;
+           static const int  RESP_WINDOW         = 0x8000;
+
+           // An outstanding request, with its expected read data length, and
+           // where read data is to be placed
+           typedef struct {
+               uint32_t      tag;
+               int           rdlen;
+               uint64_t*     data;
+               uint8_t*      buf;
+           } pending_t;
+
+    // Private methods
+           int               connect_tcp     (const int portno, const std::string &host);
+           int               connect_unix    (const std::string &path);
+           int               raw_recv        (char* buf, const int maxlen);
+           int               fill_rx_buf     (void);
+           int               next_byte       (void);
+           int               recv_bytes      (char* buf, const int len);
+           int               start_binary    (void);
+           int               queue_req       (const int op, const int width, const uint64_t addr, const uint8_t* payload,
+                                              const int len, const int prot, const int rdlen, uint64_t* data, uint8_t* buf,
+                                              const uint32_t param = 0);
+           int               recv_resp       (void);
+           void              interrupt       (const int vec);
+
+    // Private member variables
+           int               transport;
+           bool              connected;
+           osvvm_cosim_skt_t skt_hdl;
+           OsvvmCosimShmRing shm;
+
+           // Receive buffer, with read and write indexes
+           char              rx_buf[RX_BUF_SIZE];
+           int               rx_rd_idx;
+           int               rx_wr_idx;
+
+           // Binary protocol state, with buffered requests, outstanding requests
+           // and their response bytes, and any error since the last wait
+           bool              binary;
+           uint32_t          next_tag;
+           std::string       tx_pend;
+           std::deque<pending_t> pending;
+           int               resp_bytes;
+           bool              resp_error;
+
+           // Last notified interrupt vector, and callback
+           int               int_vec;
+           pIntCB_t          int_cb;
+           void*             int_hdl;
+};
+
+// -------------------------------------------------------------------------
+// C API, for bindings from other languages. Asynchronous calls return a
+// tag, and other calls OSVVM_COSIM_OK or OSVVM_COSIM_ERR.
+// -------------------------------------------------------------------------
+
+extern "C" {
+
+typedef void* osvvm_cosim_client_t;
+
+osvvm_cosim_client_t OsvvmCosimClientOpen           (const int transport, const int portnum, const char* name);
+void                 OsvvmCosimClientClose          (osvvm_cosim_client_t hdl);
+int                  OsvvmCosimClientDetach         (osvvm_cosim_client_t hdl);
+
+int                  OsvvmCosimClientWrite          (osvvm_cosim_client_t hdl, const uint64_t addr, const uint64_t data,     const int bytes, const int prot);
+int                  OsvvmCosimClientRead           (osvvm_cosim_client_t hdl, const uint64_t addr,       uint64_t* data,     const int bytes, const int prot);
+int                  OsvvmCosimClientReadCheck      (osvvm_cosim_client_t hdl, const uint64_t addr, const uint64_t expected, const int bytes, const int prot);
+int                  OsvvmCosimClientBurstWrite     (osvvm_cosim_client_t hdl, const uint64_t addr, const uint8_t* data,     const int len,   const int prot);
+int                  OsvvmCosimClientBurstRead      (osvvm_cosim_client_t hdl, const uint64_t addr,       uint8_t* data,     const int len,   const int prot);
+int                  OsvvmCosimClientBurstReadCheck (osvvm_cosim_client_t hdl, const uint64_t addr, const uint8_t* expected, const int len,   const int prot);
+
+int                  OsvvmCosimClientWriteAsync          (osvvm_cosim_client_t hdl, const uint64_t addr, const uint64_t data,     const int bytes, const int prot);
+int                  OsvvmCosimClientReadAsync           (osvvm_cosim_client_t hdl, const uint64_t addr,       uint64_t* data,     const int bytes, const int prot);
+int                  OsvvmCosimClientReadCheckAsync      (osvvm_cosim_client_t hdl, const uint64_t addr, const uint64_t expected, const int bytes, const int prot);
+int                  OsvvmCosimClientBurstWriteAsync     (osvvm_cosim_client_t hdl, const uint64_t addr, const uint8_t* data,     const int len,   const int prot);
+int                  OsvvmCosimClientBurstReadAsync      (osvvm_cosim_client_t hdl, const uint64_t addr,       uint8_t* data,     const int len,   const int prot);
+int                  OsvvmCosimClientBurstReadCheckAsync (osvvm_cosim_client_t hdl, const uint64_t addr, const uint8_t* expected, const int len,   const int prot);
+
+int                  OsvvmCosimClientFlush          (osvvm_cosim_client_t hdl);
+int                  OsvvmCosimClientWait           (osvvm_cosim_client_t hdl, const int tag);
+int                  OsvvmCosimClientWaitAll        (osvvm_cosim_client_t hdl);
+int                  OsvvmCosimClientTransact       (osvvm_cosim_client_t hdl, const char* cmd, char* resp, const int maxlen);
+
+int                  OsvvmCosimClientSubscribeInterrupts (osvvm_cosim_client_t hdl, const int enable);
+void                 OsvvmCosimClientSetInterruptCB      (osvvm_cosim_client_t hdl, void (*func)(const int, void*), void* cbhdl);
+int                  OsvvmCosimClientInterrupt           (osvvm_cosim_client_t hdl);
+int                  OsvvmCosimClientTick                (osvvm_cosim_client_t hdl, const uint32_t ticks);
+
+}
+
+#endif
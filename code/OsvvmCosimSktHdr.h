@@ -11,10 +11,13 @@
 //
 //  Description:
 //      Defines osvvm_cosim_skt class internal definitions to support
-//       compilation on windows and linux
+//       compilation on windows and linux, and the binary protocol
+//       definitions shared by the server and client classes
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Selectable host connection transports, and
+//                         shared binary protocol definitions
 //    10/2022   2023.01    Initial revision
 //
 //
@@ -43,10 +46,17 @@
 // INCLUDES
 // -------------------------------------------------------------------------
 
+#include <stdint.h>
+
 // -------------------------------------------------------------------------
 // DEFINES
 // -------------------------------------------------------------------------
 
+// Default Unix domain socket path and shared memory object name formats,
+// given the port number of the connection
+#define OSVVM_COSIM_UNIX_PATH_FMT    "/tmp/osvvm_cosim_%d.skt"
+#define OSVVM_COSIM_SHM_NAME_FMT     "/osvvm_cosim_%d"
+
 #if defined (_WIN32) || defined (_WIN64)
 
 // -------------------------------------------------------------------------
@@ -77,8 +87,49 @@
 // TYPE DEFINITIONS
 // -------------------------------------------------------------------------
 
+// Binary protocol header definitions and maximum payload. These are also
+// hard-coded in Scripts/osvvm_cosim_client.py and Scripts/client_bench.py.
+static const int      BIN_MAGIC           = 0xb5;
+static const int      BIN_HDR_SIZE        = 24;
+static const int      BIN_MAX_PAYLOAD     = 0x100000;
+
+// Binary protocol tag of (unsolicited) interrupt notifications
+static const uint32_t BIN_NOTIFY_TAG      = 0xffffffff;
+
 // -------------------------------------------------------------------------
 // ENUMERATIONS
 // -------------------------------------------------------------------------
 
+// Host connection transports
+typedef enum
+{
+    OSVVM_COSIM_TCP = 0,
+    OSVVM_COSIM_UNIX,
+    OSVVM_COSIM_SHM
+} osvvm_cosim_transport_t;
+
+// Binary protocol operations
+typedef enum
+{
+    BIN_OP_NONE = 0,
+    BIN_OP_WRITE,
+    BIN_OP_READ,
+    BIN_OP_WRITE_AND_READ,
+    BIN_OP_READ_CHECK,
+    BIN_OP_BURST_WRITE,
+    BIN_OP_BURST_READ,
+    BIN_OP_BURST_READ_CHECK,
+    BIN_OP_STREAM_SEND,
+    BIN_OP_STREAM_GET,
+    BIN_OP_STREAM_CHECK,
+    BIN_OP_STREAM_BURST_SEND,
+    BIN_OP_STREAM_BURST_GET,
+    BIN_OP_STREAM_BURST_CHECK,
+    BIN_OP_TICK,
+    BIN_OP_DETACH,
+    BIN_OP_KILL,
+    BIN_OP_INTERRUPT,
+    BIN_OP_MAX
+} BinOpType;
+
 #endif
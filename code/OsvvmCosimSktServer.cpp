@@ -0,0 +1,816 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimSktServer.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Methods for the event driven, multi-client, co-simulation TCP/IP
+//      socket server, using epoll for the I/O thread's event loop.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision, with interrupt notifications
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <string.h>
+#include <errno.h>
+
+#if !(defined (_WIN32) || defined (_WIN64))
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/types.h>
+# include <sys/socket.h>
+# include <sys/epoll.h>
+# include <sys/eventfd.h>
+# include <netinet/in.h>
+# include <netinet/tcp.h>
+#endif
+
+#include "OsvvmCosim.h"
+#include "OsvvmCosimSktServer.h"
+
+// -------------------------------------------------------------------------
+// DEFINES
+// -------------------------------------------------------------------------
+
+// Event IDs of the listening socket and wake event. Client IDs start after these.
+#define SKT_SERVER_LISTEN_ID   0
+#define SKT_SERVER_WAKE_ID     1
+#define SKT_SERVER_FIRST_ID    2
+
+// -------------------------------------------------------------------------
+// Constructor
+// -------------------------------------------------------------------------
+
+OsvvmCosimSktServer::OsvvmCosimSktServer (const int  PortNumber,
+                                          const int  DefaultNode,
+                                          const bool LittleEndian,
+                                          const char Eop,
+                                          const char Sop,
+                                          const int  SuffixBytes) :
+    OsvvmCosimSkt(DefaultNode, PortNumber, LittleEndian, Eop, Sop, SuffixBytes, OSVVM_COSIM_TCP, "", false),
+    port_num(PortNumber),
+    default_node(DefaultNode),
+    first_node(DefaultNode),
+    num_nodes(1),
+    next_node(0),
+    persistent(false),
+    bound_port(-1),
+    listen_fd(-1),
+    epoll_fd(-1),
+    wake_fd(-1),
+    running(false),
+    stopped(false),
+    attached(false),
+    next_client(SKT_SERVER_FIRST_ID)
+{
+    for (int node = 0; node < VP_MAX_NODES; node++)
+    {
+        node_queues[node].serviced = false;
+    }
+}
+
+// -------------------------------------------------------------------------
+// Destructor
+// -------------------------------------------------------------------------
+
+OsvvmCosimSktServer::~OsvvmCosimSktServer (void)
+{
+    Stop();
+
+    if (io_thread.joinable())
+    {
+        io_thread.join();
+    }
+
+#if !(defined (_WIN32) || defined (_WIN64))
+    std::lock_guard<std::mutex> lock(client_mx);
+
+    while (!clients.empty())
+    {
+        close_client(clients.begin()->first);
+    }
+
+    if (listen_fd >= 0) close(listen_fd);
+    if (wake_fd   >= 0) close(wake_fd);
+    if (epoll_fd  >= 0) close(epoll_fd);
+#endif
+}
+
+// -------------------------------------------------------------------------
+// SetClientNodes()
+//
+// Assign connecting clients to nodes FirstNode to FirstNode+NumNodes-1
+// in turn, rather than all to the default node. A client's packets may
+// still select another node with a node prefix.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktServer::SetClientNodes (const int FirstNode, const int NumNodes)
+{
+    first_node = FirstNode;
+    num_nodes  = (NumNodes > 0) ? NumNodes : 1;
+    next_node  = 0;
+}
+
+// -------------------------------------------------------------------------
+// Start()
+//
+// Open the listening socket and start the I/O thread, which accepts
+// clients and queues their requests on nodes until the server is
+// stopped. Unless persistent, the server stops when the last client
+// has detached, or on a kill packet from any client.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktServer::Start (void)
+{
+#if defined (_WIN32) || defined (_WIN64)
+
+    VPrint("***ERROR: OsvvmCosimSktServer::Start() not supported on Windows\n");
+    return OSVVM_COSIM_ERR;
+
+#else
+
+    struct epoll_event ev;
+
+    if ((listen_fd = listen_skt(port_num, bound_port)) < 0)
+    {
+        return OSVVM_COSIM_ERR;
+    }
+
+    fcntl(listen_fd, F_SETFL, fcntl(listen_fd, F_GETFL) | O_NONBLOCK);
+
+    if ((epoll_fd = epoll_create1(0)) < 0 || (wake_fd = eventfd(0, EFD_NONBLOCK)) < 0)
+    {
+        VPrint("***ERROR: OsvvmCosimSktServer::Start() failed to create events (%s)\n", strerror(errno));
+        return OSVVM_COSIM_ERR;
+    }
+
+    ev.events   = EPOLLIN;
+    ev.data.u64 = SKT_SERVER_LISTEN_ID;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listen_fd, &ev);
+
+    ev.events   = EPOLLIN;
+    ev.data.u64 = SKT_SERVER_WAKE_ID;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &ev);
+
+    running   = true;
+    io_thread = std::thread(&OsvvmCosimSktServer::io_loop, this);
+
+    return OSVVM_COSIM_OK;
+#endif
+}
+
+// -------------------------------------------------------------------------
+// ProcessNode()
+//
+// Service the requests queued on node NodeNum, in order, until the server
+// is stopped. Called from the node's user thread, as the requests are
+// executed as that node's co-simulation transactions. May be called
+// before Start(), waiting for requests. Requests for the node are only
+// accepted whilst it is being serviced. Interrupt vector changes during
+// the transactions are notified to the node's subscribed clients.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktServer::ProcessNode (const int NodeNum)
+{
+    if (NodeNum < 0 || NodeNum >= VP_MAX_NODES)
+    {
+        VPrint("***ERROR: OsvvmCosimSktServer::ProcessNode() invalid node number %d\n", NodeNum);
+        return OSVVM_COSIM_ERR;
+    }
+
+    node_queue_t& q = node_queues[NodeNum];
+
+    {
+        std::lock_guard<std::mutex> lock(q.mx);
+
+        if (q.serviced)
+        {
+            VPrint("***ERROR: OsvvmCosimSktServer::ProcessNode() node %d already serviced\n", NodeNum);
+            return OSVVM_COSIM_ERR;
+        }
+
+        q.serviced = true;
+    }
+
+    VRegInterruptTap(notify_tap, this, NodeNum);
+
+    while (true)
+    {
+        request_t req;
+
+        {
+            std::unique_lock<std::mutex> lock(q.mx);
+
+            q.cv.wait(lock, [&] {return !q.queue.empty() || stopped;});
+
+            if (stopped)
+            {
+                q.serviced = false;
+                break;
+            }
+
+            req = q.queue.front();
+            q.queue.pop_front();
+        }
+
+        proc_cmd(req.cmd, NodeNum);
+
+        complete(req.client, req.seq, GenRespPkt(req.cmd, sop_char, eop_char, little_endian));
+    }
+
+    VRegInterruptTap(NULL, NULL, NodeNum);
+
+    return OSVVM_COSIM_OK;
+}
+
+// -------------------------------------------------------------------------
+// Stop()
+//
+// Stop the server, releasing all nodes from ProcessNode(). Requests still
+// queued are discarded.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktServer::Stop (void)
+{
+    for (int node = 0; node < VP_MAX_NODES; node++)
+    {
+        std::lock_guard<std::mutex> lock(node_queues[node].mx);
+
+        stopped = true;
+        node_queues[node].cv.notify_all();
+    }
+
+    running = false;
+
+    wake();
+}
+
+// -------------------------------------------------------------------------
+// NumClients()
+//
+// Return the number of currently connected clients
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimSktServer::NumClients (void)
+{
+    std::lock_guard<std::mutex> lock(client_mx);
+
+    return clients.size();
+}
+
+// -------------------------------------------------------------------------
+// NodeServiced()
+//
+// Return whether a ProcessNode() loop is servicing node NodeNum, so that
+// requests for it are accepted
+//
+// -------------------------------------------------------------------------
+
+bool OsvvmCosimSktServer::NodeServiced (const int NodeNum)
+{
+    if (NodeNum < 0 || NodeNum >= VP_MAX_NODES)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(node_queues[NodeNum].mx);
+
+    return node_queues[NodeNum].serviced;
+}
+
+// -------------------------------------------------------------------------
+// io_loop()
+//
+// I/O thread event loop, accepting clients, reading and queuing their
+// packets, and sending responses that could not be sent when completed.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktServer::io_loop (void)
+{
+#if !(defined (_WIN32) || defined (_WIN64))
+    struct epoll_event events[MAX_EVENTS];
+
+    while (running)
+    {
+        int num = epoll_wait(epoll_fd, events, MAX_EVENTS, -1);
+
+        if (num < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            VPrint("***ERROR: OsvvmCosimSktServer::io_loop() wait failed (%s)\n", strerror(errno));
+            Stop();
+            break;
+        }
+
+        for (int idx = 0; idx < num && running; idx++)
+        {
+            uint64_t id = events[idx].data.u64;
+
+            if (id == SKT_SERVER_LISTEN_ID)
+            {
+                accept_clients();
+            }
+            else if (id == SKT_SERVER_WAKE_ID)
+            {
+                uint64_t count;
+
+                if (read(wake_fd, &count, sizeof(count)) < 0)
+                {
+                    // Nothing to drain
+                }
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(client_mx);
+
+                std::map<uint64_t, client_t*>::iterator it = clients.find(id);
+
+                if (it == clients.end())
+                {
+                    continue;
+                }
+
+                client_t* client = it->second;
+
+                if ((events[idx].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) && !read_client(client, id))
+                {
+                    close_client(id);
+                }
+                else
+                {
+                    // Send any responses ready, closing a detached client once all are sent
+                    release(client, id);
+                }
+            }
+        }
+    }
+#endif
+}
+
+// -------------------------------------------------------------------------
+// accept_clients()
+//
+// Accept all pending connections, assigning each client a node
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktServer::accept_clients (void)
+{
+#if !(defined (_WIN32) || defined (_WIN64))
+    osvvm_cosim_skt_t fd;
+    int               enable = 1;
+
+    while ((fd = accept(listen_fd, NULL, NULL)) >= 0)
+    {
+        std::lock_guard<std::mutex> lock(client_mx);
+
+        client_t* client = new client_t;
+        uint64_t  id     = next_client++;
+
+        client->fd       = fd;
+        client->node     = first_node + (next_node++ % num_nodes);
+        client->next_seq = 0;
+        client->next_out = 0;
+        client->closing  = false;
+        client->want_out = false;
+        client->binary   = false;
+        client->no_ack   = false;
+        client->notify   = false;
+
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (char*)&enable, sizeof(int));
+
+        struct epoll_event ev;
+        ev.events   = EPOLLIN;
+        ev.data.u64 = id;
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev);
+
+        clients[id] = client;
+        attached    = true;
+
+        VPrint("OSVVM_COSIM_SKT: host attached as client %d on node %d.\n", (int)(id - SKT_SERVER_FIRST_ID), client->node);
+    }
+#endif
+}
+
+// -------------------------------------------------------------------------
+// read_client()
+//
+// Read whatever a client has sent and queue each complete packet. Any
+// partial packet remains buffered. Returns false if the client has
+// disconnected or the read failed. Called with client_mx held.
+//
+// -------------------------------------------------------------------------
+
+bool OsvvmCosimSktServer::read_client (client_t* client, const uint64_t id)
+{
+    char   buf[RX_CHUNK_SIZE];
+    int    len;
+    size_t pos = 0;
+
+    if ((len = recv(client->fd, buf, RX_CHUNK_SIZE, 0)) <= 0)
+    {
+        return len < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR);
+    }
+
+    client->rxbuf.append(buf, len);
+
+    // Extract each packet, from SOP to EOP plus suffix bytes, or a binary header and payload
+    while (!client->closing)
+    {
+        if (client->binary)
+        {
+            int size = bin_pkt_size(client->rxbuf.data() + pos, client->rxbuf.size() - pos);
+
+            if (size < 0)
+            {
+                VPrint("OSVVM_COSIM_SKT: ***ERROR bad binary packet from host client %d.\n", (int)(id - SKT_SERVER_FIRST_ID));
+                return false;
+            }
+
+            if (size == 0 || client->rxbuf.size() - pos < (size_t)size)
+            {
+                break;
+            }
+
+            std::string cmdstr = client->rxbuf.substr(pos, size);
+
+            pos += size;
+
+            queue_packet(client, id, cmdstr);
+            continue;
+        }
+
+        size_t sop = client->rxbuf.find(sop_char, pos);
+
+        if (sop == std::string::npos)
+        {
+            pos = client->rxbuf.size();
+            break;
+        }
+
+        size_t eop = client->rxbuf.find(eop_char, sop + 1);
+
+        if (eop == std::string::npos || client->rxbuf.size() - (eop + 1) < (size_t)suffix_bytes)
+        {
+            pos = sop;
+            break;
+        }
+
+        std::string cmdstr = client->rxbuf.substr(sop, eop + 1 + suffix_bytes - sop);
+
+        pos = eop + 1 + suffix_bytes;
+
+        queue_packet(client, id, cmdstr);
+    }
+
+    client->rxbuf.erase(0, pos);
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// queue_packet()
+//
+// Parse a client's packet and queue it on its node. A node prefix
+// selects the node for this packet only. Detach and kill are handled
+// here, in order with the client's other responses, as are requests
+// for an invalid node, or one not serviced by ProcessNode(), which are
+// answered with an error rather than left waiting. Called with
+// client_mx held.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktServer::queue_packet (client_t* client, const uint64_t id, std::string &cmdstr)
+{
+    int node = client->node;
+
+    // Strip any node prefix, leaving the SOP
+    if (!client->binary && cmdstr.size() > 1 && cmdstr[1] == NODE_PREFIX_CHAR)
+    {
+        size_t delim = cmdstr.find(':', 2);
+
+        if (delim != std::string::npos)
+        {
+            node = (int)strtol(cmdstr.substr(2, delim - 2).c_str(), NULL, 16);
+            cmdstr.erase(1, delim);
+        }
+    }
+
+    CmdAttrType cmd_rec = ParsePkt(cmdstr);
+    uint64_t    seq     = client->next_seq++;
+
+    cmd_rec.Ack = !client->no_ack;
+
+    if (cmd_rec.Kill)
+    {
+        VPrint("OSVVM_COSIM_SKT: host received 'kill': terminating.\n");
+        client->done[seq] = "";
+        client->closing   = true;
+        Stop();
+    }
+    else if (cmd_rec.Detach)
+    {
+        client->done[seq] = GenRespPkt(cmd_rec, sop_char, eop_char, little_endian);
+        client->closing   = true;
+    }
+    else if (cmd_rec.Negotiate)
+    {
+        // Switch to the binary protocol for this client's subsequent packets
+        client->done[seq] = GenRespPkt(cmd_rec, sop_char, eop_char, little_endian);
+        client->binary    = !cmd_rec.Error;
+    }
+    else if (cmd_rec.StartNoAck)
+    {
+        // Drop acknowledgements from this client's subsequent responses
+        client->done[seq] = GenRespPkt(cmd_rec, sop_char, eop_char, little_endian);
+        client->no_ack    = !cmd_rec.Error;
+    }
+    else if (cmd_rec.Subscribe)
+    {
+        // Subscribe to, or unsubscribe from, interrupt notifications for the client's node
+        client->done[seq] = GenRespPkt(cmd_rec, sop_char, eop_char, little_endian);
+        client->notify    = !cmd_rec.Error && cmd_rec.Param != 0;
+    }
+    else if (node < 0 || node >= VP_MAX_NODES)
+    {
+        cmd_rec.Error     = OSVVM_COSIM_ERR;
+        client->done[seq] = GenRespPkt(cmd_rec, sop_char, eop_char, little_endian);
+    }
+    else
+    {
+        request_t req;
+
+        req.client = id;
+        req.seq    = seq;
+        req.cmd    = cmd_rec;
+
+        std::unique_lock<std::mutex> lock(node_queues[node].mx);
+
+        if (node_queues[node].serviced && !stopped)
+        {
+            node_queues[node].queue.push_back(req);
+            node_queues[node].cv.notify_one();
+        }
+        else
+        {
+            lock.unlock();
+
+            cmd_rec.Error     = OSVVM_COSIM_ERR;
+            client->done[seq] = GenRespPkt(cmd_rec, sop_char, eop_char, little_endian);
+        }
+    }
+}
+
+// -------------------------------------------------------------------------
+// complete()
+//
+// Called from a node's thread when a request has been processed, to
+// return its response to the client, in the order of the client's
+// requests.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktServer::complete (const uint64_t id, const uint64_t seq, const std::string &resp)
+{
+    std::lock_guard<std::mutex> lock(client_mx);
+
+    std::map<uint64_t, client_t*>::iterator it = clients.find(id);
+
+    // Discard if the client has gone
+    if (it != clients.end())
+    {
+        it->second->done[seq] = resp;
+        release(it->second, id);
+    }
+}
+
+// -------------------------------------------------------------------------
+// release()
+//
+// Move a client's completed responses, that are next in order, to its
+// transmit buffer and send what the socket will take, unless held back
+// whilst coalescing pipelined responses. The client is closed if the
+// send failed, or if detached and all responses are sent.
+// Called with client_mx held.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktServer::release (client_t* client, const uint64_t id)
+{
+    std::map<uint64_t, std::string>::iterator it;
+
+    while ((it = client->done.find(client->next_out)) != client->done.end())
+    {
+        client->txbuf.append(it->second);
+        client->done.erase(it);
+        client->next_out++;
+    }
+
+    // Pipelined responses are held back, whilst more of the client's requests are
+    // outstanding, to be sent together, unless already waiting to send
+    if (coalesce && (client->no_ack || client->binary) && client->next_out != client->next_seq &&
+        !client->want_out && client->txbuf.size() < TX_COALESCE_SIZE)
+    {
+        return;
+    }
+
+    if (!flush_client(client, id) ||
+        (client->closing && client->next_out == client->next_seq && client->txbuf.empty()))
+    {
+        close_client(id);
+    }
+}
+
+// -------------------------------------------------------------------------
+// flush_client()
+//
+// Send as much of a client's transmit buffer as the socket will take,
+// waiting for the socket to be writable if any remains. Returns false
+// if the send failed. Called with client_mx held.
+//
+// -------------------------------------------------------------------------
+
+bool OsvvmCosimSktServer::flush_client (client_t* client, const uint64_t id)
+{
+#if !(defined (_WIN32) || defined (_WIN64))
+    size_t sent = 0;
+
+    while (sent < client->txbuf.size())
+    {
+        int len = send(client->fd, client->txbuf.data() + sent, client->txbuf.size() - sent, MSG_NOSIGNAL);
+
+        if (len < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                break;
+            }
+
+            if (errno != EINTR)
+            {
+                VPrint("OSVVM_COSIM_SKT: ERROR writing to host client %d.\n", (int)(id - SKT_SERVER_FIRST_ID));
+                return false;
+            }
+        }
+        else
+        {
+            sent += len;
+        }
+    }
+
+    client->txbuf.erase(0, sent);
+
+    // Only wait on the socket being writable whilst there is something left to send
+    bool want_out = !client->txbuf.empty();
+
+    if (want_out != client->want_out)
+    {
+        struct epoll_event ev;
+
+        ev.events        = EPOLLIN | (want_out ? (uint32_t)EPOLLOUT : 0u);
+        ev.data.u64      = id;
+        client->want_out = want_out;
+
+        epoll_ctl(epoll_fd, EPOLL_CTL_MOD, client->fd, &ev);
+    }
+#endif
+
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// close_client()
+//
+// Close a client's connection and remove it. Unless persistent, the
+// server is stopped when the last client has gone. Called with client_mx
+// held.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktServer::close_client (const uint64_t id)
+{
+#if !(defined (_WIN32) || defined (_WIN64))
+    std::map<uint64_t, client_t*>::iterator it = clients.find(id);
+
+    if (it == clients.end())
+    {
+        return;
+    }
+
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, it->second->fd, NULL);
+    close(it->second->fd);
+
+    VPrint("OSVVM_COSIM_SKT: host client %d %s.\n", (int)(id - SKT_SERVER_FIRST_ID), it->second->closing ? "detached" : "disconnected");
+
+    delete it->second;
+    clients.erase(it);
+
+    if (clients.empty() && attached && !persistent && !stopped)
+    {
+        Stop();
+    }
+#endif
+}
+
+// -------------------------------------------------------------------------
+// notify_tap()
+//
+// Interrupt tap, called on a node's thread whenever its interrupt vector
+// changes, with the server as the handle
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktServer::notify_tap (const int vec, const uint32_t nodenum, void* hdl)
+{
+    ((OsvvmCosimSktServer*)hdl)->notify_clients(vec, nodenum);
+}
+
+// -------------------------------------------------------------------------
+// notify_clients()
+//
+// Send an interrupt notification to each client subscribed on node
+// nodenum, in the client's protocol, ahead of any responses not yet
+// released
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktServer::notify_clients (const int vec, const int nodenum)
+{
+    std::lock_guard<std::mutex> lock(client_mx);
+
+    std::map<uint64_t, client_t*>::iterator it = clients.begin();
+
+    while (it != clients.end())
+    {
+        client_t* client = it->second;
+        uint64_t  id     = it->first;
+
+        // Advance first, as the client may be closed when released
+        it++;
+
+        if (client->notify && client->node == nodenum && !client->closing)
+        {
+            client->txbuf.append(gen_int_pkt(vec, nodenum, client->binary));
+            release(client, id);
+        }
+    }
+}
+
+// -------------------------------------------------------------------------
+// wake()
+//
+// Wake the I/O thread from waiting on events
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimSktServer::wake (void)
+{
+#if !(defined (_WIN32) || defined (_WIN64))
+    uint64_t count = 1;
+
+    if (wake_fd >= 0 && write(wake_fd, &count, sizeof(count)) < 0)
+    {
+        // Already pending
+    }
+#endif
+}
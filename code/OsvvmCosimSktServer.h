@@ -0,0 +1,193 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimSktServer.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Class definition for an event driven, multi-client, co-simulation
+//      TCP/IP socket server. A single I/O thread accepts any number of
+//      clients and reads their packets, queuing each request on the
+//      co-simulation node the client (or the packet's node prefix)
+//      selects. Each node's user thread services its own queue, in
+//      order, and responses are returned to each client in the order
+//      of its requests. Requests for a node with no ProcessNode() loop
+//      running are answered at once with an error. Clients may each negotiate the binary protocol,
+//      or no-ack mode, and may pipeline requests, with responses to
+//      each client coalesced into as few sends as possible. Clients
+//      may also subscribe to interrupt notifications for the node they
+//      are assigned, sent whenever the node's interrupt vector changes
+//      whilst ProcessNode() is servicing it.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_COSIM_SKT_SERVER_H_
+#define _OSVVM_COSIM_SKT_SERVER_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+
+#include "OsvvmCosimSkt.h"
+#include "OsvvmVProc.h"
+
+// -------------------------------------------------------------------------
+// CLASS DEFINITION
+// -------------------------------------------------------------------------
+
+class OsvvmCosimSktServer : public OsvvmCosimSkt
+{
+    ////////////////////////////////
+    // PUBLIC
+    ////////////////////////////////
+
+public:
+           // Character introducing a packet's node prefix, as in $@<hex node>:<command>#<checksum>
+           static const char NODE_PREFIX_CHAR    = '@';
+
+    // Constructor/destructor
+                             OsvvmCosimSktServer   (const int  PortNumber   = DEFAULT_TCP_PORTNUM,
+                                                    const int  DefaultNode  = 0,
+                                                    const bool LittleEndian = false,
+                                                    const char Eop          = '#',
+                                                    const char Sop          = '$',
+                                                    const int  SuffixBytes  = 2);
+                            ~OsvvmCosimSktServer   (void);
+
+    // Configuration methods, called before Start()
+           void              SetClientNodes  (const int FirstNode, const int NumNodes);
+           void              SetPersistent   (const bool Persistent) {persistent = Persistent;}
+
+    // User entry point methods
+           int               Start           (void);
+           int               ProcessNode     (const int NodeNum);
+           void              Stop            (void);
+
+           int               PortNumber      (void) {return bound_port;}
+           int               NumClients      (void);
+           bool              NodeServiced    (const int NodeNum);
+
+    ////////////////////////////////
+    // PRIVATE
+    ////////////////////////////////
+
+private:
+           static const int  MAX_EVENTS          = 64;
+           static const int  RX_CHUNK_SIZE       = 4096;
+
+           // A request queued on a node, with its client and order
+           typedef struct
+           {
+               uint64_t      client;
+               uint64_t      seq;
+               CmdAttrType   cmd;
+           } request_t;
+
+           // Per node request queue, with whether ProcessNode() is servicing it
+           typedef struct
+           {
+               std::mutex              mx;
+               std::condition_variable cv;
+               std::deque<request_t>   queue;
+               bool                    serviced;
+           } node_queue_t;
+
+           // Client connection state
+           typedef struct
+           {
+               osvvm_cosim_skt_t       fd;
+               int                     node;
+               std::string             rxbuf;
+               std::string             txbuf;
+               uint64_t                next_seq;
+               uint64_t                next_out;
+               std::map<uint64_t, std::string> done;
+               bool                    closing;
+               bool                    want_out;
+               bool                    binary;
+               bool                    no_ack;
+               bool                    notify;
+           } client_t;
+
+    // Private methods
+           void              io_loop         (void);
+           void              accept_clients  (void);
+           bool              read_client     (client_t* client, const uint64_t id);
+           void              queue_packet    (client_t* client, const uint64_t id, std::string &cmdstr);
+           void              complete        (const uint64_t id, const uint64_t seq, const std::string &resp);
+           bool              flush_client    (client_t* client, const uint64_t id);
+           void              release         (client_t* client, const uint64_t id);
+           void              close_client    (const uint64_t id);
+           void              wake            (void);
+
+           // Interrupt tap, registered on each node whilst serviced by ProcessNode(),
+           // notifying the node's subscribed clients of interrupt vector changes
+    static void              notify_tap      (const int vec, const uint32_t nodenum, void* hdl);
+           void              notify_clients  (const int vec, const int nodenum);
+
+    // Private member variables
+           int               port_num;
+           int               default_node;
+           int               first_node;
+           int               num_nodes;
+           int               next_node;
+           bool              persistent;
+
+           int               bound_port;
+           osvvm_cosim_skt_t listen_fd;
+           int               epoll_fd;
+           int               wake_fd;
+
+           volatile bool     running;
+
+           // Set under every node's queue mutex, so waiters see it, but also
+           // read by close_client() under client_mx only
+           std::atomic<bool> stopped;
+
+           bool              attached;
+           std::thread       io_thread;
+
+           // Clients, by unique ID (not reused), guarded by client_mx
+           std::mutex        client_mx;
+           std::map<uint64_t, client_t*> clients;
+           uint64_t          next_client;
+
+           node_queue_t      node_queues[VP_MAX_NODES];
+};
+
+#endif
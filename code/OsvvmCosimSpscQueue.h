@@ -0,0 +1,248 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimSpscQueue.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Simulator co-simulation C++ template class for a bounded, lock-free,
+//      single producer, single consumer queue, for passing items between
+//      two threads. Items are pushed and popped without locks, with a
+//      thread only sleeping (on a condition variable) when the queue is
+//      full or empty, and only woken by the other side when sleeping.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdint.h>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <utility>
+
+#ifndef __OSVVM_COSIM_SPSC_QUEUE_H_
+#define __OSVVM_COSIM_SPSC_QUEUE_H_
+
+template <typename T> class OsvvmCosimSpscQueue
+{
+public:
+      // Default number of queue entries
+      static const uint32_t default_queue_size = 256;
+
+      // Number of polls of the queue before sleeping
+      static const int      spin_count         = 4000;
+
+                OsvvmCosimSpscQueue (const uint32_t size = default_queue_size) :
+                    queue(pow2(size)), wr_idx(0), rd_idx(0), sleepers(0), closed(false)
+                {
+                };
+
+      // -------------------------------------------------------------------------
+      // tryPush()
+      //
+      // Move an item to the back of the queue, if not full, returning false
+      // if full or closed. Called from the producer thread only.
+      //
+      // -------------------------------------------------------------------------
+
+      bool tryPush (T &item)
+      {
+          return pushItem(item) && wake();
+      }
+
+      // -------------------------------------------------------------------------
+      // tryPop()
+      //
+      // Move the item at the front of the queue to item, if not empty,
+      // returning false if empty. Called from the consumer thread only.
+      //
+      // -------------------------------------------------------------------------
+
+      bool tryPop (T &item)
+      {
+          return popItem(item) && wake();
+      }
+
+      // -------------------------------------------------------------------------
+      // push()
+      //
+      // Move an item to the back of the queue, waiting whilst the queue is
+      // full. Returns false if the queue is closed.
+      //
+      // -------------------------------------------------------------------------
+
+      bool push (T &item)
+      {
+          return waitFor([&]{return pushItem(item);});
+      }
+
+      // -------------------------------------------------------------------------
+      // pop()
+      //
+      // Move the item at the front of the queue to item, waiting whilst the
+      // queue is empty. Returns false if the queue is empty and closed.
+      //
+      // -------------------------------------------------------------------------
+
+      bool pop (T &item)
+      {
+          return waitFor([&]{return popItem(item);}) || tryPop(item);
+      }
+
+      // -------------------------------------------------------------------------
+      // close()
+      //
+      // Close the queue, from either side, waking the other side. Items
+      // already queued may still be popped.
+      //
+      // -------------------------------------------------------------------------
+
+      void close (void)
+      {
+          std::lock_guard<std::mutex> lck(mx);
+
+          closed.store(true);
+          cv.notify_all();
+      }
+
+      bool     empty       (void)         {return wr_idx.load() == rd_idx.load();}
+      bool     isClosed    (void)         {return closed.load();}
+
+private:
+
+      // Round a size up to a power of 2
+      static uint32_t pow2 (const uint32_t size)
+      {
+          uint32_t val = 1;
+          while (val < size) val <<= 1;
+          return val;
+      }
+
+      // Move an item to the back of the queue, if not full or closed
+      bool pushItem (T &item)
+      {
+          uint32_t wr = wr_idx.load(std::memory_order_relaxed);
+
+          if (closed.load() || wr - rd_idx.load() == queue.size())
+          {
+              return false;
+          }
+
+          queue[wr & (queue.size()-1)] = std::move(item);
+
+          wr_idx.store(wr + 1);
+
+          return true;
+      }
+
+      // Move the item at the front of the queue to item, if not empty
+      bool popItem (T &item)
+      {
+          uint32_t rd = rd_idx.load(std::memory_order_relaxed);
+
+          if (wr_idx.load() == rd)
+          {
+              return false;
+          }
+
+          item = std::move(queue[rd & (queue.size()-1)]);
+
+          rd_idx.store(rd + 1);
+
+          return true;
+      }
+
+      // Wake the other side, only if it is sleeping. The index updates and
+      // the sleeper count are sequentially consistent, so either this side
+      // sees the sleeper, or the sleeper sees the update before sleeping.
+      bool wake (void)
+      {
+          if (sleepers.load() != 0)
+          {
+              std::lock_guard<std::mutex> lck(mx);
+              cv.notify_all();
+          }
+
+          return true;
+      }
+
+      // Try an operation until it succeeds, or the queue is closed, polling
+      // for a while before sleeping (only when there is more than one
+      // processor, as the other side cannot otherwise make progress). The
+      // sleeper is counted before the final try, so a wake between the try
+      // and sleeping is never lost.
+      template <typename F> bool waitFor (F tryop)
+      {
+          static const int spins = (std::thread::hardware_concurrency() > 1) ? spin_count : 0;
+
+          for (int count = 0; count < spins && !closed.load(); count++)
+          {
+              if (tryop())
+              {
+                  return wake();
+              }
+          }
+
+          std::unique_lock<std::mutex> lck(mx);
+
+          sleepers.fetch_add(1);
+
+          bool done;
+
+          while (!(done = tryop()) && !closed.load())
+          {
+              cv.wait(lck);
+          }
+
+          sleepers.fetch_sub(1);
+
+          // Wake the other side directly, as the lock is already held
+          if (done)
+          {
+              cv.notify_all();
+          }
+
+          return done;
+      }
+
+      std::vector<T>          queue;
+
+      // Free running write and read indexes, on separate cache lines
+      alignas(64) std::atomic<uint32_t> wr_idx;
+      alignas(64) std::atomic<uint32_t> rd_idx;
+
+      alignas(64) std::atomic<int>      sleepers;
+      std::atomic<bool>                 closed;
+
+      std::mutex              mx;
+      std::condition_variable cv;
+};
+
+#endif
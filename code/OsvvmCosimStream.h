@@ -15,6 +15,8 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Adding packet receive with prefetch ring, duplex
+//                         receive slot and credit based burst send queue
 //    05/2023   2023.05    Adding additional methods mapping to OSVVM procedures
 //    02/2023   2023.02    Initial revision
 //
@@ -39,7 +41,9 @@
 
 #include <stdint.h>
 #include <string>
+#include <mutex>
 #include "OsvvmVUser.h"
+#include "OsvvmCosimPktRing.h"
 
 #ifndef __OSVVM_COSIM_STREAM_H_
 #define __OSVVM_COSIM_STREAM_H_
@@ -59,6 +63,42 @@ public:
 
       void     tick            (const int ticks, const bool done = false, const bool error = false)
       {
+          rx_pkt_t&   rxpkt = rxPkt(node);
+          tx_queue_t& txq   = txQueue(node);
+
+          // Any queued bursts are all sent before flagging done
+          if (done && !error)
+          {
+              streamTxQueueFlush();
+          }
+
+          // When sending queued bursts, use each idle tick to send as credits allow,
+          // unless another thread is using the queue
+          if (!done && !error)
+          {
+              std::unique_lock<std::mutex> txlock(txq.mx, std::try_to_lock);
+
+              if (txlock.owns_lock() && txq.ring != NULL && !txq.ring->empty())
+              {
+                  queueTicks(txq, rxpkt, ticks);
+                  return;
+              }
+          }
+
+          // When prefetching, use each idle tick to try and get a packet into the ring
+          // (one exchange per tick, whilst the ring has room), unless another thread
+          // is receiving on the node
+          if (!done && !error)
+          {
+              std::unique_lock<std::mutex> rxlock(rxpkt.mx, std::try_to_lock);
+
+              if (rxlock.owns_lock() && rxpkt.prefetch)
+              {
+                  prefetchTicks(rxpkt.ring, ticks);
+                  return;
+              }
+          }
+
 #ifndef DISABLE_VUSERMAIN_THREAD
           VTick(ticks, done, error, node);
 #else
@@ -66,15 +106,15 @@ public:
 #endif
       }
 
-      uint8_t  streamSend                     (const uint8_t  data, const int param=0)                     {return VStreamUserCommon                 (SEND, data, param, node);}
-      uint16_t streamSend                     (const uint16_t data, const int param=0)                     {return VStreamUserCommon                 (SEND, data, param, node);}
-      uint32_t streamSend                     (const uint32_t data, const int param=0)                     {return VStreamUserCommon                 (SEND, data, param, node);}
-      uint64_t streamSend                     (const uint64_t data, const int param=0)                     {return VStreamUserCommon                 (SEND, data, param, node);}
+      uint8_t  streamSend                     (const uint8_t  data, const int param=0)                     {streamTxQueueFlush(); return VStreamUserCommon                 (SEND, data, param, node);}
+      uint16_t streamSend                     (const uint16_t data, const int param=0)                     {streamTxQueueFlush(); return VStreamUserCommon                 (SEND, data, param, node);}
+      uint32_t streamSend                     (const uint32_t data, const int param=0)                     {streamTxQueueFlush(); return VStreamUserCommon                 (SEND, data, param, node);}
+      uint64_t streamSend                     (const uint64_t data, const int param=0)                     {streamTxQueueFlush(); return VStreamUserCommon                 (SEND, data, param, node);}
 
-      uint8_t  streamSendAsync                (const uint8_t  data, const int param=0)                     {return VStreamUserCommon                 (SEND_ASYNC, data, param, node);}
-      uint16_t streamSendAsync                (const uint16_t data, const int param=0)                     {return VStreamUserCommon                 (SEND_ASYNC, data, param, node);}
-      uint32_t streamSendAsync                (const uint32_t data, const int param=0)                     {return VStreamUserCommon                 (SEND_ASYNC, data, param, node);}
-      uint64_t streamSendAsync                (const uint64_t data, const int param=0)                     {return VStreamUserCommon                 (SEND_ASYNC, data, param, node);}
+      uint8_t  streamSendAsync                (const uint8_t  data, const int param=0)                     {streamTxQueueFlush(); return VStreamUserCommon                 (SEND_ASYNC, data, param, node);}
+      uint16_t streamSendAsync                (const uint16_t data, const int param=0)                     {streamTxQueueFlush(); return VStreamUserCommon                 (SEND_ASYNC, data, param, node);}
+      uint32_t streamSendAsync                (const uint32_t data, const int param=0)                     {streamTxQueueFlush(); return VStreamUserCommon                 (SEND_ASYNC, data, param, node);}
+      uint64_t streamSendAsync                (const uint64_t data, const int param=0)                     {streamTxQueueFlush(); return VStreamUserCommon                 (SEND_ASYNC, data, param, node);}
 
       void     streamGet                      (uint8_t  *data)                                             {int status; VStreamUserGetCommon         (GET, data, &status, 0, 0, node);}
       void     streamGet                      (uint16_t *data)                                             {int status; VStreamUserGetCommon         (GET, data, &status, 0, 0, node);}
@@ -106,10 +146,10 @@ public:
       void     streamCheck                    (const uint32_t data, const int param=0)                     {VStreamUserCommon                        (CHECK, data, param, node);}
       void     streamCheck                    (const uint64_t data, const int param=0)                     {VStreamUserCommon                        (CHECK, data, param, node);}
 
-      void     streamBurstSend                (uint8_t  *data,      const int bytesize, const int param=1) {VStreamUserBurstSendCommon               (SEND_BURST, BURST_NORM, data, bytesize, param, node);}
-      void     streamBurstSend                (const int bytesize,  const int param=1)                     {VStreamUserBurstSendCommon               (SEND_BURST, BURST_TRANS, NULL, bytesize, param, node);}
-      void     streamBurstSendAsync           (uint8_t  *data,      const int bytesize, const int param=1) {VStreamUserBurstSendCommon               (SEND_BURST_ASYNC, BURST_NORM, data, bytesize, param, node);}
-      void     streamBurstSendAsync           (const int bytesize,  const int param=1)                     {VStreamUserBurstSendCommon               (SEND_BURST_ASYNC, BURST_TRANS, NULL, bytesize, param, node);}
+      void     streamBurstSend                (uint8_t  *data,      const int bytesize, const int param=1) {streamTxQueueFlush(); VStreamUserBurstSendCommon               (SEND_BURST, BURST_NORM, data, bytesize, param, node);}
+      void     streamBurstSend                (const int bytesize,  const int param=1)                     {streamTxQueueFlush(); VStreamUserBurstSendCommon               (SEND_BURST, BURST_TRANS, NULL, bytesize, param, node);}
+      void     streamBurstSendAsync           (uint8_t  *data,      const int bytesize, const int param=1) {streamTxQueueFlush(); VStreamUserBurstSendCommon               (SEND_BURST_ASYNC, BURST_NORM, data, bytesize, param, node);}
+      void     streamBurstSendAsync           (const int bytesize,  const int param=1)                     {streamTxQueueFlush(); VStreamUserBurstSendCommon               (SEND_BURST_ASYNC, BURST_TRANS, NULL, bytesize, param, node);}
 
       void     streamBurstGet                 (uint8_t  *data,      const int  bytesize)                   {int status; VStreamUserBurstGetCommon    (GET_BURST, BURST_NORM,  data, bytesize, &status, node);}
       void     streamBurstGet                 (uint8_t  *data,      const int  bytesize, int *status)      {VStreamUserBurstGetCommon                (GET_BURST, BURST_NORM,  data, bytesize, status, node);}
@@ -121,17 +161,17 @@ public:
       void     streamBurstCheckIncrement      (uint8_t   data,      const int bytesize, const int param=1) {VStreamUserBurstSendCommon               (CHECK_BURST, BURST_INCR_CHECK, &data, bytesize, param, node);}
       void     streamBurstCheckRandom         (uint8_t   data,      const int bytesize, const int param=1) {VStreamUserBurstSendCommon               (CHECK_BURST, BURST_RAND_CHECK, &data, bytesize, param, node);}
 
-      void     streamBurstSendIncrement       (uint8_t   data,      const int bytesize, const int param=1) {VStreamUserBurstSendCommon               (SEND_BURST, BURST_INCR, &data, bytesize, param, node);}
-      void     streamBurstSendIncrementAsync  (uint8_t   data,      const int bytesize, const int param=1) {VStreamUserBurstSendCommon               (SEND_BURST_ASYNC, BURST_INCR, &data, bytesize, param, node);}
-      void     streamBurstSendRandom          (uint8_t   data,      const int bytesize, const int param=1) {VStreamUserBurstSendCommon               (SEND_BURST, BURST_RAND, &data, bytesize, param, node);}
-      void     streamBurstSendRandomAsync     (uint8_t   data,      const int bytesize, const int param=1) {VStreamUserBurstSendCommon               (SEND_BURST_ASYNC, BURST_RAND, &data, bytesize, param, node);}
+      void     streamBurstSendIncrement       (uint8_t   data,      const int bytesize, const int param=1) {streamTxQueueFlush(); VStreamUserBurstSendCommon               (SEND_BURST, BURST_INCR, &data, bytesize, param, node);}
+      void     streamBurstSendIncrementAsync  (uint8_t   data,      const int bytesize, const int param=1) {streamTxQueueFlush(); VStreamUserBurstSendCommon               (SEND_BURST_ASYNC, BURST_INCR, &data, bytesize, param, node);}
+      void     streamBurstSendRandom          (uint8_t   data,      const int bytesize, const int param=1) {streamTxQueueFlush(); VStreamUserBurstSendCommon               (SEND_BURST, BURST_RAND, &data, bytesize, param, node);}
+      void     streamBurstSendRandomAsync     (uint8_t   data,      const int bytesize, const int param=1) {streamTxQueueFlush(); VStreamUserBurstSendCommon               (SEND_BURST_ASYNC, BURST_RAND, &data, bytesize, param, node);}
 
       void     streamBurstPopData             (uint8_t  *data,      const int bytesize)                    {int status; VStreamUserBurstGetCommon    (GET_BURST,   BURST_DATA,       data, bytesize, &status, node);}
-      void     streamBurstPushData            (uint8_t  *data,      const int bytesize)                    {VStreamUserBurstSendCommon               (SEND_BURST,  BURST_DATA,       data, bytesize, 0, node);}
+      void     streamBurstPushData            (uint8_t  *data,      const int bytesize)                    {streamTxQueueFlush(); VStreamUserBurstSendCommon               (SEND_BURST,  BURST_DATA,       data, bytesize, 0, node);}
       void     streamBurstPushCheckData       (uint8_t  *data,      const int bytesize)                    {VStreamUserBurstSendCommon               (CHECK_BURST, BURST_DATA,       data, bytesize, 0, node);}
-      void     streamBurstPushIncrement       (uint8_t   data,      const int bytesize)                    {VStreamUserBurstSendCommon               (SEND_BURST,  BURST_INCR_PUSH, &data, bytesize, 0, node);}
+      void     streamBurstPushIncrement       (uint8_t   data,      const int bytesize)                    {streamTxQueueFlush(); VStreamUserBurstSendCommon               (SEND_BURST,  BURST_INCR_PUSH, &data, bytesize, 0, node);}
       void     streamBurstPushCheckIncrement  (uint8_t   data,      const int bytesize)                    {VStreamUserBurstSendCommon               (CHECK_BURST, BURST_INCR_PUSH, &data, bytesize, 0, node);}
-      void     streamBurstPushRandom          (uint8_t   data,      const int bytesize)                    {VStreamUserBurstSendCommon               (SEND_BURST,  BURST_RAND_PUSH, &data, bytesize, 0, node);}
+      void     streamBurstPushRandom          (uint8_t   data,      const int bytesize)                    {streamTxQueueFlush(); VStreamUserBurstSendCommon               (SEND_BURST,  BURST_RAND_PUSH, &data, bytesize, 0, node);}
       void     streamBurstPushCheckRandom     (uint8_t   data,      const int bytesize)                    {VStreamUserBurstSendCommon               (CHECK_BURST, BURST_RAND_PUSH, &data, bytesize, 0, node);}
 
       bool     streamBurstTryGet              (const int bytesize,  const int param=1)                     {int status; return VStreamUserBurstGetCommon(TRY_GET_BURST,   BURST_TRANS,        NULL, bytesize, &status, node);}
@@ -146,12 +186,322 @@ public:
       void     streamWaitForRxTransaction     (void)                                                       {VStreamWaitGetCount                         (WAIT_FOR_TRANSACTION,  RX_REC, node);}
       void     streamWaitForTxTransaction     (void)                                                       {VStreamWaitGetCount                         (WAIT_FOR_TRANSACTION,  TX_REC, node);}
 
+      // -------------------------------------------------------------------------
+      // streamSetDuplex()
+      //
+      // Enable or disable the node's duplex receive slot, so a receiving
+      // thread can get (or check) whilst a sending thread on the same node
+      // has a send outstanding. Requires the simulation to call CoSimStreamRx
+      // for the node in its own process. The receiving thread must disable
+      // the slot when finished, before done is flagged. The node's packet
+      // receive ring is locked, so the receiving thread may use recvPacket()
+      // and peekPacket() whilst the sending thread's tick() prefetches,
+      // with prefetching skipped for ticks whilst a receive is blocked.
+      //
+      // -------------------------------------------------------------------------
+
+      void     streamSetDuplex                (const bool enable)                                          {VStreamUserSetDuplex(enable, node);}
+
+      // -------------------------------------------------------------------------
+      // streamSetRxPrefetch()
+      //
+      // Enable or disable prefetching of received packets into the node's
+      // packet ring whilst idle in tick(). Whilst enabled, other get methods
+      // should not be mixed with recvPacket/peekPacket. Note that, whilst
+      // the ring has room, a tick(N) is then N single cycle exchanges with
+      // the simulation, rather than one exchange of N cycles. The ring is
+      // locked, so a sending thread's tick() may prefetch whilst a receiving
+      // thread uses it, with ticks that find it in use not prefetching.
+      //
+      // -------------------------------------------------------------------------
+
+      void streamSetRxPrefetch (const bool enable, const uint32_t ringsize = OsvvmCosimPktRing::default_ring_size)
+      {
+          rx_pkt_t&                   rxpkt = rxPkt(node);
+          std::lock_guard<std::mutex> rxlock(rxpkt.mx);
+
+          if (enable && rxpkt.ring == NULL)
+          {
+              rxpkt.ring = new OsvvmCosimPktRing(ringsize);
+          }
+
+          rxpkt.prefetch = enable;
+      }
+
+      // -------------------------------------------------------------------------
+      // recvPacket()
+      //
+      // Receive the next packet, from the node's ring if any are waiting, or
+      // else with a blocking get burst. Up to maxlen bytes are copied to buf,
+      // and the number copied returned. Any remaining bytes are discarded.
+      // The ring stays locked whilst blocked, so that packets prefetched by
+      // another thread are not overtaken.
+      //
+      // -------------------------------------------------------------------------
+
+      int recvPacket (uint8_t* buf, const int maxlen, int* status = NULL)
+      {
+          rx_pkt_t&                   rxpkt = rxPkt(node);
+          std::lock_guard<std::mutex> rxlock(rxpkt.mx);
+          int                         rxstatus, rxbytes;
+
+          if (rxpkt.ring != NULL && !rxpkt.ring->empty())
+          {
+              return rxpkt.ring->pop(buf, maxlen, status);
+          }
+
+          VStreamUserBurstGetPktCommon(GET_BURST, buf, maxlen, &rxbytes, &rxstatus, 0, node);
+
+          if (status != NULL)
+          {
+              *status = rxstatus;
+          }
+
+          return (rxbytes < maxlen) ? rxbytes : maxlen;
+      }
+
+      // -------------------------------------------------------------------------
+      // peekPacket()
+      //
+      // Return the length of the next packet, without removing it, or -1 if
+      // none has been received. If the node's ring is empty, a single try
+      // get burst is done and any packet received placed in the ring. Up to
+      // maxlen bytes of the packet are copied to buf, if not NULL.
+      //
+      // -------------------------------------------------------------------------
+
+      int peekPacket (uint8_t* buf = NULL, const int maxlen = 0, int* status = NULL)
+      {
+          rx_pkt_t&                   rxpkt = rxPkt(node);
+          std::lock_guard<std::mutex> rxlock(rxpkt.mx);
+
+          if (rxpkt.ring == NULL)
+          {
+              rxpkt.ring = new OsvvmCosimPktRing();
+          }
+
+          if (rxpkt.ring->empty())
+          {
+              prefetchTicks(rxpkt.ring, 0);
+          }
+
+          return rxpkt.ring->peek(buf, maxlen, status);
+      }
+
+      int      streamRxPacketsWaiting         (void)                                                       {rx_pkt_t& rxpkt = rxPkt(node); std::lock_guard<std::mutex> rxlock(rxpkt.mx); return rxpkt.ring ? rxpkt.ring->numPackets() : 0;}
+
+      // -------------------------------------------------------------------------
+      // streamSetTxQueue()
+      //
+      // Configure the node's burst send queue, with the TX burst FIFO depth,
+      // in bytes, used for flow control credits and the size of the queue.
+      //
+      // -------------------------------------------------------------------------
+
+      void streamSetTxQueue (const int fifobytes, const uint32_t queuesize = OsvvmCosimPktRing::default_ring_size)
+      {
+          tx_queue_t&                 txq = txQueue(node);
+          std::lock_guard<std::mutex> txlock(txq.mx);
+
+          setTxQueue(txq, fifobytes, queuesize);
+      }
+
+      // -------------------------------------------------------------------------
+      // streamBurstSendQueued()
+      //
+      // Add a burst to the node's send queue, without any exchange with the
+      // simulation. Queued bursts are sent asynchronously, in order, during
+      // tick() whenever the TX burst FIFO has room for them. Returns false
+      // if the queue is full or the burst is too large. Direct sends on the
+      // node first send any queued bursts, to keep the stream in order.
+      //
+      // -------------------------------------------------------------------------
+
+      bool streamBurstSendQueued (uint8_t* data, const int bytesize, const int param = 1)
+      {
+          tx_queue_t&                 txq = txQueue(node);
+          std::lock_guard<std::mutex> txlock(txq.mx);
+
+          if (txq.ring == NULL)
+          {
+              setTxQueue(txq, default_tx_fifo_bytes, OsvvmCosimPktRing::default_ring_size);
+          }
+
+          if (bytesize < 0 || bytesize >= DATABUF_SIZE)
+          {
+              return false;
+          }
+
+          return txq.ring->push(data, bytesize, param);
+      }
+
+      // -------------------------------------------------------------------------
+      // streamTxQueueFlush()
+      //
+      // Tick until all the node's queued bursts have been sent. Called by
+      // the direct send methods before sending, and by tick() when flagging
+      // done, so that queued bursts are never overtaken or left unsent.
+      //
+      // -------------------------------------------------------------------------
+
+      void streamTxQueueFlush (void)
+      {
+          tx_queue_t&                 txq = txQueue(node);
+          std::lock_guard<std::mutex> txlock(txq.mx);
+
+          while (txq.ring != NULL && !txq.ring->empty())
+          {
+              queueTicks(txq, rxPkt(node), 1);
+          }
+      }
+
+      int      streamTxQueued                 (void)                                                       {tx_queue_t& txq = txQueue(node); std::lock_guard<std::mutex> txlock(txq.mx); return txq.ring ? txq.ring->numPackets() : 0;}
+      int      streamTxFifoLevel              (void)                                                       {tx_queue_t& txq = txQueue(node); std::lock_guard<std::mutex> txlock(txq.mx); return txq.level;}
+
       void     waitForSim                     (void)                                                       {VWaitForSim(node);}
 
       int      getNodeNumber                  (void)                                                       {return node;}
 
 private:
 
+      // Per-node packet receive state, shared by all stream objects for a node,
+      // and so by all threads using the node, and locked by its mutex
+      typedef struct
+      {
+          std::mutex         mx;
+          OsvvmCosimPktRing* ring;
+          bool               prefetch;
+      } rx_pkt_t;
+
+      static rx_pkt_t& rxPkt (const int node)                                                              {static rx_pkt_t rxpkt[VP_MAX_NODES]; return rxpkt[node];}
+
+      // Default TX burst FIFO depth, in bytes, when a queue is not configured
+      static const int default_tx_fifo_bytes = 4 * DATABUF_SIZE;
+
+      // Per-node burst send queue state, shared by all stream objects for a node,
+      // and locked by its mutex. The level is the TX burst FIFO fill level from
+      // the last queue exchange.
+      typedef struct
+      {
+          std::mutex         mx;
+          OsvvmCosimPktRing* ring;
+          int                fifobytes;
+          int                level;
+      } tx_queue_t;
+
+      static tx_queue_t& txQueue (const int node)                                                          {static tx_queue_t txq[VP_MAX_NODES]; return txq[node];}
+
+      // -------------------------------------------------------------------------
+      // setTxQueue()
+      //
+      // (Re)configure a node's burst send queue, with its state locked,
+      // replacing the queue only if it is empty
+      //
+      // -------------------------------------------------------------------------
+
+      static void setTxQueue (tx_queue_t& txq, const int fifobytes, const uint32_t queuesize)
+      {
+          if (txq.ring != NULL && txq.ring->empty())
+          {
+              delete txq.ring;
+              txq.ring = NULL;
+          }
+
+          if (txq.ring == NULL)
+          {
+              txq.ring = new OsvvmCosimPktRing(queuesize);
+          }
+
+          txq.fifobytes = fifobytes;
+      }
+
+      // -------------------------------------------------------------------------
+      // queueTicks()
+      //
+      // Tick for the given number of cycles, sending the burst at the front of
+      // the queue in the same exchange as a tick when the TX burst FIFO has room
+      // for it (or is empty), else refreshing the FIFO level. Each cycle is a
+      // separate single cycle exchange with the simulation. Once the queue is
+      // empty, any remaining ticks are used for prefetching, if enabled. Called
+      // with the node's burst send queue locked.
+      //
+      // -------------------------------------------------------------------------
+
+      void queueTicks (tx_queue_t& txq, rx_pkt_t& rxpkt, const int ticks)
+      {
+          uint8_t burstbuf[DATABUF_SIZE];
+          int     param;
+          int     loops = ticks ? ticks : 1;
+
+          for (int idx = 0; idx < loops; idx++)
+          {
+              int len = txq.ring->peek(NULL, 0);
+
+              if (len < 0)
+              {
+                  std::unique_lock<std::mutex> rxlock(rxpkt.mx, std::try_to_lock);
+
+                  if (rxlock.owns_lock() && rxpkt.prefetch)
+                  {
+                      prefetchTicks(rxpkt.ring, ticks ? 1 : 0);
+                  }
+                  else
+                  {
+                      VTick(ticks ? 1 : 0, false, false, node);
+                  }
+              }
+              else if (txq.level == 0 || len <= txq.fifobytes - txq.level)
+              {
+                  txq.ring->pop(burstbuf, DATABUF_SIZE, &param);
+                  txq.level = VStreamUserBurstSendQueued(burstbuf, len, param, ticks ? 1 : 0, node);
+              }
+              else
+              {
+                  txq.level = VStreamUserTxFifoLevel(ticks ? 1 : 0, node);
+              }
+          }
+      }
+
+      // -------------------------------------------------------------------------
+      // prefetchTicks()
+      //
+      // Tick for the given number of cycles, trying to get a packet into the
+      // ring in the same exchange as each tick, whilst there is room in the ring
+      // for a maximum sized burst. Each cycle is then a separate exchange with
+      // the simulation, so prefetching costs an exchange per tick in return for
+      // packets being collected as they arrive. Once the ring is full, the
+      // remaining cycles are ticked in a single exchange. A ticks value of 0
+      // does a single try get without advancing time. Called with the node's
+      // packet receive state locked.
+      //
+      // -------------------------------------------------------------------------
+
+      void prefetchTicks (OsvvmCosimPktRing* ring, const int ticks)
+      {
+          uint8_t pktbuf[DATABUF_SIZE];
+          int     rxbytes, status;
+          int     loops = ticks ? ticks : 1;
+
+          for (int idx = 0; idx < loops; idx++)
+          {
+              if (ring->space() >= DATABUF_SIZE + OsvvmCosimPktRing::hdr_size)
+              {
+                  if (VStreamUserBurstGetPktCommon(TRY_GET_BURST, pktbuf, DATABUF_SIZE, &rxbytes, &status, ticks ? 1 : 0, node))
+                  {
+                      ring->push(pktbuf, rxbytes, status);
+                  }
+              }
+              else
+              {
+                  if (ticks)
+                  {
+                      VTick(ticks - idx, false, false, node);
+                  }
+                  break;
+              }
+          }
+      }
+
       int      node;
 };
 
@@ -0,0 +1,343 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimStreamDemux.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Simulator co-simulation C++ class for demultiplexing a stream
+//      node's received bursts (or beats) into per-channel packet rings,
+//      keyed on the AXI4-Stream TID, TDEST and/or TUSER fields decoded
+//      from the returned status. Consumer threads, one per channel, can
+//      block on their own channel without taking other channels' data.
+//      Nothing is received from the node whilst any channel's ring lacks
+//      room for a maximum sized packet, so a slow consumer back pressures
+//      the stream rather than losing packets.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#include <stdint.h>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+
+#include "OsvvmCosimStream.h"
+#include "OsvvmCosimPktRing.h"
+
+#ifndef __OSVVM_COSIM_STREAM_DEMUX_H_
+#define __OSVVM_COSIM_STREAM_DEMUX_H_
+
+class OsvvmCosimStreamDemux
+{
+public:
+
+      // Selection of the parameter fields that make up a channel key
+      static const uint32_t DEMUX_TID   = 1;
+      static const uint32_t DEMUX_TDEST = 2;
+      static const uint32_t DEMUX_TUSER = 4;
+
+      // Default per-channel ring size, enough for four maximum sized bursts
+      static const uint32_t default_chan_ring_size = 4 * 4096;
+
+      // -------------------------------------------------------------------------
+      // Constructor
+      //
+      // The channel key is made from the selected fields, of the AXI4-Stream
+      // parameter layout TID[16:9], TDEST[8:5], TUSER[4:1], TLAST[0]. A
+      // non-zero beatbytes receives (and routes) single beats of that many
+      // bytes, rather than whole bursts. The ring size is raised, if needed,
+      // to hold at least one maximum sized packet.
+      //
+      // -------------------------------------------------------------------------
+
+                OsvvmCosimStreamDemux (const int      nodeIn    = 0,
+                                       const uint32_t fields    = DEMUX_TID | DEMUX_TDEST,
+                                       const int      beatbytes = 0,
+                                       const uint32_t ringsize  = default_chan_ring_size) :
+                    strm(nodeIn), node(nodeIn), keymask(fieldMask(fields)), beat_bytes(beatbytes),
+                    pkt_room(maxPktBytes(beatbytes) + OsvvmCosimPktRing::hdr_size),
+                    chan_ring_size((ringsize < pkt_room) ? pkt_room : ringsize), pumping(false) {};
+
+               ~OsvvmCosimStreamDemux (void)
+                {
+                    for (std::map<uint32_t, chan_t*>::iterator it = chans.begin(); it != chans.end(); ++it)
+                    {
+                        delete it->second;
+                    }
+                }
+
+      // AXI4-Stream parameter field encode and decode
+      static int      makeParam (const int tid, const int tdest, const int tuser, const int tlast)
+                                                      {return ((tid & 0xff) << 9) | ((tdest & 0xf) << 5) | ((tuser & 0xf) << 1) | (tlast & 0x1);}
+      static int      paramTid   (const int param)    {return (param >> 9) & 0xff;}
+      static int      paramTdest (const int param)    {return (param >> 5) & 0xf;}
+      static int      paramTuser (const int param)    {return (param >> 1) & 0xf;}
+      static int      paramTlast (const int param)    {return param & 0x1;}
+
+      // Return the channel key for the given field values, with unselected fields ignored
+      uint32_t        key        (const int tid, const int tdest = 0, const int tuser = 0)
+                                                      {return makeParam(tid, tdest, tuser, 0) & keymask;}
+
+      // -------------------------------------------------------------------------
+      // recv()
+      //
+      // Receive the next packet (or beat) for the channel with the given
+      // key, blocking until one arrives. Whilst blocked, the calling thread
+      // may receive on behalf of all channels, routing other channels' data
+      // to their rings. If a channel's ring is too full to take another
+      // packet, it waits for that channel's consumer to make room instead,
+      // leaving data in the model. Up to maxlen bytes are copied to buf, and
+      // the number copied returned. The full status, if wanted, is returned
+      // in status.
+      //
+      // -------------------------------------------------------------------------
+
+      int recv (const uint32_t chankey, uint8_t* buf, const int maxlen, int* status = NULL)
+      {
+          std::unique_lock<std::mutex> lk(mx);
+
+          chan_t* chan = getChan(chankey);
+
+          while (chan->ring.empty())
+          {
+              if (!pumping && !roomForPacket())
+              {
+                  space_cv.wait(lk);
+              }
+              else if (!pumping)
+              {
+                  pumping = true;
+
+                  lk.unlock();
+                  pump();
+                  lk.lock();
+
+                  pumping = false;
+
+                  // Let a waiting consumer take over receiving, if still required
+                  notifyAll();
+              }
+              else
+              {
+                  chan->cv.wait(lk);
+              }
+          }
+
+          return popChan(chan, buf, maxlen, status);
+      }
+
+      // -------------------------------------------------------------------------
+      // tryRecv()
+      //
+      // As for recv(), but returns -1 without blocking if the channel has
+      // nothing waiting. If no other thread is receiving, and all the rings
+      // have room, a single try get is done first, routing any received data.
+      //
+      // -------------------------------------------------------------------------
+
+      int tryRecv (const uint32_t chankey, uint8_t* buf, const int maxlen, int* status = NULL)
+      {
+          std::unique_lock<std::mutex> lk(mx);
+
+          chan_t* chan = getChan(chankey);
+
+          if (chan->ring.empty() && !pumping && roomForPacket())
+          {
+              pumping = true;
+
+              lk.unlock();
+              pump(true);
+              lk.lock();
+
+              pumping = false;
+              notifyAll();
+          }
+
+          return popChan(chan, buf, maxlen, status);
+      }
+
+      // Number of packets (or beats) waiting for a channel
+      int      waiting        (const uint32_t chankey)   {std::lock_guard<std::mutex> lk(mx); return getChan(chankey)->ring.numPackets();}
+
+private:
+
+      // Per-channel state: a packet ring and the condition its consumer waits on
+      typedef struct chan_s
+      {
+          chan_s (const uint32_t size) : ring(size) {};
+
+          OsvvmCosimPktRing       ring;
+          std::condition_variable cv;
+      } chan_t;
+
+      // Largest packet a single receive can return
+      static uint32_t maxPktBytes (const int beatbytes)
+      {
+          return beatbytes ? ((beatbytes < (int)sizeof(uint64_t)) ? beatbytes : sizeof(uint64_t)) : DATABUF_SIZE;
+      }
+
+      static uint32_t fieldMask (const uint32_t fields)
+      {
+          return ((fields & DEMUX_TID)   ? makeParam(0xff, 0, 0, 0) : 0) |
+                 ((fields & DEMUX_TDEST) ? makeParam(0, 0xf, 0, 0)  : 0) |
+                 ((fields & DEMUX_TUSER) ? makeParam(0, 0, 0xf, 0)  : 0);
+      }
+
+      // Get a channel's state, creating it if this is the first use of the
+      // key (by a consumer or received data). Called with mx held.
+      chan_t* getChan (const uint32_t chankey)
+      {
+          std::map<uint32_t, chan_t*>::iterator it = chans.find(chankey);
+
+          if (it == chans.end())
+          {
+              it = chans.insert(std::make_pair(chankey, new chan_t(chan_ring_size))).first;
+          }
+
+          return it->second;
+      }
+
+      // Whether every channel's ring has room for another packet, whichever
+      // channel it turns out to be for. Called with mx held.
+      bool roomForPacket (void)
+      {
+          for (std::map<uint32_t, chan_t*>::iterator it = chans.begin(); it != chans.end(); ++it)
+          {
+              if (it->second->ring.space() < pkt_room)
+              {
+                  return false;
+              }
+          }
+
+          return true;
+      }
+
+      // Take a packet from a channel's ring, waking any thread waiting
+      // for room to receive. Called with mx held.
+      int popChan (chan_t* chan, uint8_t* buf, const int maxlen, int* status)
+      {
+          int len = chan->ring.pop(buf, maxlen, status);
+
+          if (len >= 0)
+          {
+              space_cv.notify_all();
+          }
+
+          return len;
+      }
+
+      // Wake all the channels' consumers. Called with mx held.
+      void notifyAll (void)
+      {
+          for (std::map<uint32_t, chan_t*>::iterator it = chans.begin(); it != chans.end(); ++it)
+          {
+              it->second->cv.notify_all();
+          }
+      }
+
+      // -------------------------------------------------------------------------
+      // pump()
+      //
+      // Receive one packet (or beat) from the node, with a blocking get or,
+      // if trying, a try get, and route it to its channel's ring, waking the
+      // channel's consumer. Called by the single receiving thread, without
+      // mx held, so other channels' consumers can take from their rings,
+      // and only when all the rings have room, so the push cannot fail.
+      //
+      // -------------------------------------------------------------------------
+
+      void pump (const bool trying = false)
+      {
+          int  status = 0;
+          int  len;
+          bool avail  = true;
+
+          if (beat_bytes)
+          {
+              uint64_t beat = 0;
+
+              if (trying)
+              {
+                  avail = VStreamUserGetCommon(TRY_GET, &beat, &status, 0, 0, node);
+              }
+              else
+              {
+                  strm.streamGet(&beat, &status);
+              }
+
+              // Beats stored little endian
+              for (int idx = 0; idx < beat_bytes && idx < (int)sizeof(uint64_t); idx++)
+              {
+                  rxbuf[idx] = (beat >> (8*idx)) & 0xff;
+              }
+
+              len = (beat_bytes < (int)sizeof(uint64_t)) ? beat_bytes : sizeof(uint64_t);
+          }
+          else if (trying)
+          {
+              len   = strm.peekPacket();
+              avail = len >= 0;
+
+              if (avail)
+              {
+                  len = strm.recvPacket(rxbuf, DATABUF_SIZE, &status);
+              }
+          }
+          else
+          {
+              len = strm.recvPacket(rxbuf, DATABUF_SIZE, &status);
+          }
+
+          if (avail)
+          {
+              std::lock_guard<std::mutex> lk(mx);
+
+              chan_t* chan = getChan(status & keymask);
+
+              chan->ring.push(rxbuf, len, status);
+              chan->cv.notify_one();
+          }
+      }
+
+      OsvvmCosimStream            strm;
+      const int                   node;
+      const uint32_t              keymask;
+      const int                   beat_bytes;
+      const uint32_t              pkt_room;
+      const uint32_t              chan_ring_size;
+
+      std::mutex                  mx;
+      std::condition_variable     space_cv;
+      bool                        pumping;
+      std::map<uint32_t, chan_t*> chans;
+
+      uint8_t                     rxbuf[DATABUF_SIZE];
+};
+
+#endif
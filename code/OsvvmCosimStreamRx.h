@@ -15,6 +15,7 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Hide queued burst send methods
 //    06/2023   2023.05    Initial revision
 //
 //
@@ -69,6 +70,11 @@ private:
       using OsvvmCosimStream::streamBurstPushRandom;
       using OsvvmCosimStream::streamGetTxTransactionCount;
       using OsvvmCosimStream::streamWaitForTxTransaction;
+      using OsvvmCosimStream::streamSetTxQueue;
+      using OsvvmCosimStream::streamBurstSendQueued;
+      using OsvvmCosimStream::streamTxQueueFlush;
+      using OsvvmCosimStream::streamTxQueued;
+      using OsvvmCosimStream::streamTxFifoLevel;
       
       int node;
 };
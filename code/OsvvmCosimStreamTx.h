@@ -15,6 +15,7 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Hide packet receive methods
 //    06/2023   2023.05    Initial revision
 //
 //
@@ -74,6 +75,10 @@ private:
       using OsvvmCosimStream::streamBurstTryCheckRandom;
       using OsvvmCosimStream::streamGetRxTransactionCount;
       using OsvvmCosimStream::streamWaitForRxTransaction;
+      using OsvvmCosimStream::streamSetRxPrefetch;
+      using OsvvmCosimStream::recvPacket;
+      using OsvvmCosimStream::peekPacket;
+      using OsvvmCosimStream::streamRxPacketsWaiting;
 
       int node;
 };
@@ -0,0 +1,352 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimUartBridge.cpp
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Methods for bridging a UART stream node to a host pseudo-terminal
+//      or stdin/stdout, with batched transfers in both directions.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <string.h>
+#include <errno.h>
+
+#if !(defined (_WIN32) || defined (_WIN64))
+# include <stdlib.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <poll.h>
+#endif
+
+#include "OsvvmCosimUartBridge.h"
+
+// -------------------------------------------------------------------------
+// DEFINES
+// -------------------------------------------------------------------------
+
+// UART VC parameter for sending with no injected errors
+#define UART_BRIDGE_NO_ERROR   0
+
+// Time, in milliseconds, to wait for the host to accept output before retrying
+#define UART_BRIDGE_WR_POLL_MS 10
+
+// -------------------------------------------------------------------------
+// Constructor
+// -------------------------------------------------------------------------
+
+OsvvmCosimUartBridge::OsvvmCosimUartBridge (const int NodeNum) :
+    uart(NodeNum), node(NodeNum), in_fd(-1), out_fd(-1), host_closed(false),
+    pty_up(false), stop_req(false), tx_bytes(0), rx_bytes(0), rx_errors(0)
+{
+    pty_name[0] = 0;
+
+#if !(defined (_WIN32) || defined (_WIN64))
+    tio_saved   = false;
+    saved_flags = -1;
+#endif
+}
+
+// -------------------------------------------------------------------------
+// Destructor
+// -------------------------------------------------------------------------
+
+OsvvmCosimUartBridge::~OsvvmCosimUartBridge (void)
+{
+    Close();
+}
+
+// -------------------------------------------------------------------------
+// Open()
+//
+// Open the host side of the bridge. In pseudo-terminal mode a new pty is
+// created, in raw mode, and its slave device name is available from
+// PtyName() for a terminal program to connect to. In stdio mode, stdin
+// is made non-blocking and, if a terminal, non-canonical without echo,
+// so keystrokes are passed on as they are typed.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimUartBridge::Open (const uart_bridge_mode_t Mode)
+{
+#if defined (_WIN32) || defined (_WIN64)
+
+    VPrint("***ERROR: OsvvmCosimUartBridge::Open() not supported on Windows\n");
+    return OSVVM_COSIM_ERR;
+
+#else
+
+    struct termios tio;
+
+    Close();
+
+    host_closed = false;
+    pty_up      = false;
+    stop_req    = false;
+
+    if (Mode == UART_BRIDGE_PTY)
+    {
+        int fd = posix_openpt(O_RDWR | O_NOCTTY);
+
+        if (fd < 0 || grantpt(fd) < 0 || unlockpt(fd) < 0)
+        {
+            VPrint("***ERROR: OsvvmCosimUartBridge::Open() failed to create pseudo-terminal (%s)\n", strerror(errno));
+
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+            return OSVVM_COSIM_ERR;
+        }
+
+        strncpy(pty_name, ptsname(fd), sizeof(pty_name)-1);
+        pty_name[sizeof(pty_name)-1] = 0;
+
+        // Raw mode, so characters pass through unaltered, and without echo back to the UART
+        tcgetattr(fd, &tio);
+        cfmakeraw(&tio);
+        tcsetattr(fd, TCSANOW, &tio);
+
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+        in_fd  = fd;
+        out_fd = fd;
+
+        VPrint("OsvvmCosimUartBridge: node %d UART connected to %s\n", node, pty_name);
+    }
+    else
+    {
+        in_fd  = STDIN_FILENO;
+        out_fd = STDOUT_FILENO;
+
+        if (isatty(in_fd) && tcgetattr(in_fd, &saved_tio) == 0)
+        {
+            tio              = saved_tio;
+            tio.c_lflag     &= ~(ICANON | ECHO);
+            tio.c_cc[VMIN]   = 1;
+            tio.c_cc[VTIME]  = 0;
+
+            tcsetattr(in_fd, TCSANOW, &tio);
+            tio_saved = true;
+        }
+
+        saved_flags = fcntl(in_fd, F_GETFL);
+        fcntl(in_fd, F_SETFL, saved_flags | O_NONBLOCK);
+    }
+
+    return OSVVM_COSIM_OK;
+#endif
+}
+
+// -------------------------------------------------------------------------
+// Service()
+//
+// Do one poll of the bridge. Any host input waiting is sent to the UART
+// as a single asynchronous burst. A try get burst then drains whatever
+// the UART has received, followed by IdleTicks of clock in the same
+// exchange, and any received characters are written to the host. Returns
+// the number of bytes transferred, or -1 if the host input has closed (end
+// of file on stdin, or hang-up of the pty's terminal) or Stop() has been
+// called.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimUartBridge::Service (const int IdleTicks)
+{
+#if defined (_WIN32) || defined (_WIN64)
+
+    return -1;
+
+#else
+
+    int moved = 0;
+    int rxbytes, status;
+
+    if (in_fd < 0 || host_closed || stop_req)
+    {
+        return -1;
+    }
+
+    // Collect host input, up to a maximum burst, and send as a single burst
+    ssize_t txlen = read(in_fd, txbuf, DATABUF_SIZE-1);
+
+    if (txlen > 0)
+    {
+        uart.streamBurstSendAsync(txbuf, (int)txlen, UART_BRIDGE_NO_ERROR);
+
+        tx_bytes += txlen;
+        moved    += txlen;
+    }
+    else if (txlen == 0 && in_fd == STDIN_FILENO)
+    {
+        host_closed = true;
+    }
+    else if (in_fd != STDIN_FILENO && host_hung_up())
+    {
+        host_closed = true;
+    }
+
+    // Drain received characters, and then idle, in one exchange
+    if (VStreamUserBurstGetPktCommon(TRY_GET_BURST, rxbuf, DATABUF_SIZE, &rxbytes, &status, IdleTicks, node) && rxbytes > 0)
+    {
+        if (status != UART_BRIDGE_NO_ERROR)
+        {
+            rx_errors++;
+        }
+
+        rx_bytes += rxbytes;
+        moved    += rxbytes;
+
+        for (int idx = 0; idx < rxbytes; )
+        {
+            ssize_t wlen = write(out_fd, &rxbuf[idx], rxbytes - idx);
+
+            if (wlen > 0)
+            {
+                idx += wlen;
+            }
+            else if (wlen < 0 && (errno == EAGAIN || errno == EINTR))
+            {
+                struct pollfd pfd = {out_fd, POLLOUT, 0};
+                poll(&pfd, 1, UART_BRIDGE_WR_POLL_MS);
+            }
+            else
+            {
+                // Host side output unavailable (e.g. no terminal on pty), so discard
+                break;
+            }
+        }
+    }
+
+    return host_closed ? -1 : moved;
+#endif
+}
+
+// -------------------------------------------------------------------------
+// host_hung_up()
+//
+// Return whether the pty's terminal has hung up. A pty master polls with
+// POLLHUP whilst no terminal has the slave open, which (depending on the
+// kernel) may include before the first terminal connects, so a hang-up is
+// only flagged once a terminal has been seen connected.
+//
+// -------------------------------------------------------------------------
+
+bool OsvvmCosimUartBridge::host_hung_up (void)
+{
+#if defined (_WIN32) || defined (_WIN64)
+
+    return false;
+
+#else
+
+    struct pollfd pfd = {in_fd, POLLIN, 0};
+
+    if (poll(&pfd, 1, 0) < 0)
+    {
+        return false;
+    }
+
+    if (!(pfd.revents & POLLHUP))
+    {
+        pty_up = true;
+        return false;
+    }
+
+    return pty_up;
+#endif
+}
+
+// -------------------------------------------------------------------------
+// Run()
+//
+// Service the bridge until the host input closes (end of file on stdin,
+// or the pty's terminal hanging up after connecting), Stop() is called
+// or, if MaxTicks is non-zero, at least MaxTicks clock ticks have elapsed.
+// With a pty and no MaxTicks, Run() only returns once a terminal has
+// connected and disconnected, or on Stop(). Returns the total number of
+// bytes transferred.
+//
+// -------------------------------------------------------------------------
+
+int OsvvmCosimUartBridge::Run (const uint64_t MaxTicks, const int IdleTicks)
+{
+    int      total = 0;
+    int      moved;
+    uint64_t ticks = 0;
+
+    while ((MaxTicks == 0 || ticks < MaxTicks) && (moved = Service(IdleTicks)) >= 0)
+    {
+        total += moved;
+        ticks += IdleTicks ? IdleTicks : 1;
+    }
+
+    return total;
+}
+
+// -------------------------------------------------------------------------
+// Close()
+//
+// Close the host side of the bridge, restoring stdin's settings in
+// stdio mode.
+//
+// -------------------------------------------------------------------------
+
+void OsvvmCosimUartBridge::Close (void)
+{
+#if !(defined (_WIN32) || defined (_WIN64))
+    if (in_fd == STDIN_FILENO)
+    {
+        if (tio_saved)
+        {
+            tcsetattr(in_fd, TCSANOW, &saved_tio);
+            tio_saved = false;
+        }
+
+        if (saved_flags >= 0)
+        {
+            fcntl(in_fd, F_SETFL, saved_flags);
+            saved_flags = -1;
+        }
+    }
+    else if (in_fd >= 0)
+    {
+        close(in_fd);
+    }
+#endif
+
+    in_fd       = -1;
+    out_fd      = -1;
+    pty_name[0] = 0;
+}
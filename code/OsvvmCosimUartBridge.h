@@ -0,0 +1,133 @@
+// =========================================================================
+//
+//  File Name:         OsvvmCosimUartBridge.h
+//  Design Unit Name:
+//  Revision:          OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:        Simon Southwell email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell      simon.southwell@gmail.com
+//
+//
+//  Description:
+//      Class definition for bridging a UART stream node to a host console,
+//      either a pseudo-terminal or the program's stdin/stdout. Host input
+//      is accumulated and sent as bursts, and received characters drained
+//      as bursts after idle ticks, rather than an exchange per character.
+//      The bridge runs until stdin closes, the pty's terminal hangs up, or
+//      Stop() is called from another thread.
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// =========================================================================
+
+#ifndef _OSVVM_COSIM_UART_BRIDGE_H_
+#define _OSVVM_COSIM_UART_BRIDGE_H_
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <atomic>
+
+#if !(defined (_WIN32) || defined (_WIN64))
+# include <termios.h>
+#endif
+
+#include "OsvvmCosimStream.h"
+
+// -------------------------------------------------------------------------
+// CLASS DEFINITION
+// -------------------------------------------------------------------------
+
+class OsvvmCosimUartBridge
+{
+    ////////////////////////////////
+    // PUBLIC
+    ////////////////////////////////
+
+public:
+           static const int  OSVVM_COSIM_OK      = 0;
+           static const int  OSVVM_COSIM_ERR     = -1;
+
+           // Host side of the bridge
+           typedef enum uart_bridge_mode_e
+           {
+               UART_BRIDGE_PTY,
+               UART_BRIDGE_STDIO
+           } uart_bridge_mode_t;
+
+           // Default number of clock ticks between each poll of the host and UART
+           static const int  DEFAULT_IDLE_TICKS  = 100;
+
+    // Constructor/destructor
+                             OsvvmCosimUartBridge  (const int NodeNum = 0);
+                            ~OsvvmCosimUartBridge  (void);
+
+    // User entry point methods
+           int               Open            (const uart_bridge_mode_t Mode = UART_BRIDGE_PTY);
+           const char*       PtyName         (void)  {return pty_name;}
+           int               Service         (const int IdleTicks = DEFAULT_IDLE_TICKS);
+           int               Run             (const uint64_t MaxTicks,
+                                              const int      IdleTicks = DEFAULT_IDLE_TICKS);
+           void              Stop            (void)  {stop_req = true;}
+           void              Close           (void);
+
+           uint64_t          TxBytes         (void)  {return tx_bytes;}
+           uint64_t          RxBytes         (void)  {return rx_bytes;}
+           uint32_t          RxErrors        (void)  {return rx_errors;}
+
+    ////////////////////////////////
+    // PRIVATE
+    ////////////////////////////////
+
+private:
+    // Private methods
+           bool              host_hung_up    (void);
+
+    // Private member variables
+           OsvvmCosimStream  uart;
+           int               node;
+
+           int               in_fd;
+           int               out_fd;
+           bool              host_closed;
+           bool              pty_up;
+           std::atomic<bool> stop_req;
+           char              pty_name[128];
+
+           uint8_t           txbuf[DATABUF_SIZE];
+           uint8_t           rxbuf[DATABUF_SIZE];
+
+           uint64_t          tx_bytes;
+           uint64_t          rx_bytes;
+           uint32_t          rx_errors;
+
+#if !(defined (_WIN32) || defined (_WIN64))
+           struct termios    saved_tio;
+           bool              tio_saved;
+           int               saved_flags;
+#endif
+};
+
+#endif
@@ -15,6 +15,10 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Adding responder wait for any transaction, stream tap,
+//                         duplex stream receive slot, transaction hook and
+//                         local burst checking with affirmation results,
+//                         and interrupt tap
 //    05/2023   2023.05    Adding asynchronous transaction support
 //    03/2023   2023.04    Adding basic stream support
 //    01/2023   2023.01    Initial revision
@@ -88,6 +92,10 @@
 #define DEFAULT_STR_BUF_SIZE    32
 #define DATABUF_SIZE            4096
 
+// Offset added to a node number by the simulator to select the node's
+// duplex stream receive slot
+#define VP_RX_SLOT_OFFSET       1024
+
 // -------------------------------------------------------------------------
 // TYPEDEFS
 // -------------------------------------------------------------------------
@@ -166,9 +174,18 @@ typedef enum addr_bus_trans_op_e
     READ_BURST,
     MULTIPLE_DRIVER_DETECT,
 
-    SET_TEST_NAME = 1024
+    SET_TEST_NAME = 1024,
+    WAIT_FOR_ANY_TRANSACTION,
+    AFFIRM_RESULT
 } addr_bus_trans_op_t;
 
+typedef enum resp_channel_e
+{
+    NO_CHANNEL = 0,
+    WRITE_CHANNEL,
+    READ_CHANNEL
+} resp_channel_t;
+
 typedef enum stream_operation_e
 {
     //NOT_DRIVEN = 0,
@@ -253,6 +270,15 @@ typedef void * handle_t;
 // Interrupt function pointer type
 typedef int  (*pVUserInt_t)      (int);
 
+// Interrupt tap function pointer type (interrupt vector, node, user handle)
+typedef void (*pVUserIntTap_t)   (const int, const uint32_t, void*);
+
+// Stream burst tap function pointer type (direction, data, length, user handle)
+typedef void (*pVUserStreamTap_t)(const int, const uint8_t*, const int, void*);
+
+// Address bus transaction hook function pointer type (operation, address, bytes, user handle)
+typedef void (*pVUserTransHook_t)(const int, const uint64_t, const int, void*);
+
 typedef struct
 {
     sem_t               snd;
@@ -261,6 +287,25 @@ typedef struct
     rcv_buf_t           rcv_buf;
     pVUserInt_t         VIntVecCB;
     unsigned int        last_int;
+    pVUserIntTap_t      VIntTapCB;
+    void*               VIntTapHdl;
+    pVUserStreamTap_t   VStreamTapCB;
+    void*               VStreamTapHdl;
+    pVUserTransHook_t   VTransHookCB;
+    void*               VTransHookHdl;
+
+    // Local burst check state
+    bool                burst_check_local;
+    int                 burst_check_errors;
+    int                 burst_check_first;
+
+    // Duplex stream receive slot state
+    sem_t               rx_snd;
+    sem_t               rx_rcv;
+    send_buf_t          rx_send_buf;
+    rcv_buf_t           rx_rcv_buf;
+    volatile int        rx_duplex;
+    int                 rx_started;
 } SchedState_t, *pSchedState_t;
 
 extern pSchedState_t ns[VP_MAX_NODES];
@@ -15,6 +15,7 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Adding duplex stream receive slot
 //    05/2023   2023.05    Adding support for asynchronous transactions
 //                         and address bus responder transactions
 //    03/2023   2023.04    Adding basic stream support
@@ -190,6 +191,15 @@ VPROC_RTN_TYPE VInit (VINIT_PARAMS)
         VPrint("***Error: VInit() failed to initialise semaphore\n");
         exit(1);
     }
+    if (sem_init(&(ns[node]->rx_snd), 0, 0) == -1 || sem_init(&(ns[node]->rx_rcv), 0, 0) == -1)
+    {
+        VPrint("***Error: VInit() failed to initialise semaphore\n");
+        exit(1);
+    }
+
+    // Duplex stream receive slot is disabled until enabled by the user code
+    ns[node]->rx_duplex  = 0;
+    ns[node]->rx_started = 0;
 
     DebugVPrint("VInit(): initialising semaphores for node %d---Done\n", node);
 
@@ -197,6 +207,38 @@ VPROC_RTN_TYPE VInit (VINIT_PARAMS)
     VUser(node);
 }
 
+// -------------------------------------------------------------------------
+// VSelectSlot()
+//
+// Decode a node number passed from the simulator, selecting the node's
+// duplex stream receive slot buffers and semaphores when offset by
+// VP_RX_SLOT_OFFSET, else the node's main buffers and semaphores
+//
+// -------------------------------------------------------------------------
+
+static bool VSelectSlot (int &node, psend_buf_t &psbuf, prcv_buf_t &prbuf, sem_t* &psnd, sem_t* &prcv)
+{
+    bool rxslot = node >= VP_RX_SLOT_OFFSET;
+
+    if (rxslot)
+    {
+        node  -= VP_RX_SLOT_OFFSET;
+        psbuf  = &(ns[node]->rx_send_buf);
+        prbuf  = &(ns[node]->rx_rcv_buf);
+        psnd   = &(ns[node]->rx_snd);
+        prcv   = &(ns[node]->rx_rcv);
+    }
+    else
+    {
+        psbuf  = &(ns[node]->send_buf);
+        prbuf  = &(ns[node]->rcv_buf);
+        psnd   = &(ns[node]->snd);
+        prcv   = &(ns[node]->rcv);
+    }
+
+    return rxslot;
+}
+
 // -------------------------------------------------------------------------
 // VTrans
 // Main routine called whenever VTrans procedure invoked on
@@ -212,6 +254,13 @@ VPROC_RTN_TYPE VTrans (VTRANS_PARAMS)
     int VPDataWidth_int, VPAddrWidth_int;
     int VPError_int,     VPParam_int;
 
+    psend_buf_t psbuf;
+    prcv_buf_t  prbuf;
+    sem_t      *psnd, *prcv;
+
+    // Idle operation returned from a duplex stream receive slot when not enabled
+    static send_buf_t rx_idle_buf = {WAIT_FOR_CLOCK, trans_idle, 0, 0, {0}, 0, {0}, 0, 1, 0, 0};
+
 #if defined(ALDEC)
     int  args[VTRANS_NUM_ARGS];
     int  node;
@@ -224,6 +273,9 @@ VPROC_RTN_TYPE VTrans (VTRANS_PARAMS)
 
     int argIdx           = 0;
     node                 = args[argIdx++];
+
+    bool rxslot          = VSelectSlot(node, psbuf, prbuf, psnd, prcv);
+
     Interrupt            = args[argIdx++];
     VPStatus             = args[argIdx++];
     VPCount              = args[argIdx++];
@@ -241,63 +293,74 @@ VPROC_RTN_TYPE VTrans (VTRANS_PARAMS)
     VPParam_int          = 0;
 
     // Sample data inputs and update node receive state
-    ns[node]->rcv_buf.data_in        = args[argIdx++];
-    ns[node]->rcv_buf.data_in_hi     = args[argIdx++];
+    prbuf->data_in       = args[argIdx++];
+    prbuf->data_in_hi    = args[argIdx++];
 
     // Skip over data width output
     argIdx               += 1;
 
     // Sample address and update node receive state
-    ns[node]->rcv_buf.addr_in        = args[argIdx++];
-    ns[node]->rcv_buf.addr_in_hi     = args[argIdx++];
+    prbuf->addr_in       = args[argIdx++];
+    prbuf->addr_in_hi    = args[argIdx++];
 
 #else
+    bool rxslot = VSelectSlot(node, psbuf, prbuf, psnd, prcv);
+
     // Sample data inputs and update node receive state
-    if (ns[node]->send_buf.type != trans32_burst)
+    if (psbuf->type != trans32_burst)
     {
-        ns[node]->rcv_buf.data_in    = *VPData;
-        ns[node]->rcv_buf.data_in_hi = *VPDataHi;
+        prbuf->data_in    = *VPData;
+        prbuf->data_in_hi = *VPDataHi;
     }
 
     // Sample Address and update node receive state
-    ns[node]->rcv_buf.addr_in        = *VPAddr;
-    ns[node]->rcv_buf.addr_in_hi     = *VPAddrHi;
+    prbuf->addr_in       = *VPAddr;
+    prbuf->addr_in_hi    = *VPAddrHi;
 #endif
 
-    if (ns[node]->send_buf.type == trans32_burst)
+    if (psbuf->type == trans32_burst)
     {
-        ns[node]->rcv_buf.num_burst_bytes = ns[node]->send_buf.num_burst_bytes;
+        prbuf->num_burst_bytes = psbuf->num_burst_bytes;
     }
 
     // Sample other inputs and update node receive state
-    ns[node]->rcv_buf.interrupt  = Interrupt;
-    ns[node]->rcv_buf.status     = VPStatus;
-    ns[node]->rcv_buf.count      = VPCount;
-    ns[node]->rcv_buf.countsec   = VPCountSec;
-
-    // Send message to VUser with input values
-    DebugVPrint("VTrans(): setting rcv[%d] semaphore\n", node);
-    sem_post(&(ns[node]->rcv));
+    prbuf->interrupt  = Interrupt;
+    prbuf->status     = VPStatus;
+    prbuf->count      = VPCount;
+    prbuf->countsec   = VPCountSec;
+
+    // A duplex stream receive slot that is not enabled just idles for a cycle,
+    // without exchanging with the user code
+    if (rxslot && !ns[node]->rx_duplex)
+    {
+        psbuf = &rx_idle_buf;
+    }
+    else
+    {
+        // Send message to VUser with input values
+        DebugVPrint("VTrans(): setting rcv[%d] semaphore\n", node);
+        sem_post(prcv);
 
-    // Wait for a message from VUser process with output data
-    DebugVPrint("VTrans(): waiting for snd[%d] semaphore\n", node);
-    sem_wait(&(ns[node]->snd));
+        // Wait for a message from VUser process with output data
+        DebugVPrint("VTrans(): waiting for snd[%d] semaphore\n", node);
+        sem_wait(psnd);
+    }
 
     // Update outputs of VTrans procedure
-    if (ns[node]->send_buf.ticks >= DELTA_CYCLE)
+    if (psbuf->ticks >= DELTA_CYCLE)
     {
-        VPDataOut_int   = ((uint32_t*)ns[node]->send_buf.data)[0];
-        VPDataOutHi_int = ((uint32_t*)ns[node]->send_buf.data)[4];
-        VPAddr_int      = (uint32_t)((ns[node]->send_buf.addr)       & 0xffffffffULL);
-        VPAddrHi_int    = (uint32_t)((ns[node]->send_buf.addr >> 32) & 0xffffffffULL);
-        VPOp_int        = ns[node]->send_buf.op;
-        VPBurstSize_int = ns[node]->send_buf.num_burst_bytes;
-        VPTicks_int     = ns[node]->send_buf.ticks;
-        VPDone_int      = ns[node]->send_buf.done;
-        VPError_int     = ns[node]->send_buf.error;
-        VPParam_int     = ns[node]->send_buf.param;
-
-        switch(ns[node]->send_buf.type)
+        VPDataOut_int   = ((uint32_t*)psbuf->data)[0];
+        VPDataOutHi_int = ((uint32_t*)psbuf->data)[4];
+        VPAddr_int      = (uint32_t)((psbuf->addr)       & 0xffffffffULL);
+        VPAddrHi_int    = (uint32_t)((psbuf->addr >> 32) & 0xffffffffULL);
+        VPOp_int        = psbuf->op;
+        VPBurstSize_int = psbuf->num_burst_bytes;
+        VPTicks_int     = psbuf->ticks;
+        VPDone_int      = psbuf->done;
+        VPError_int     = psbuf->error;
+        VPParam_int     = psbuf->param;
+
+        switch(psbuf->type)
         {
             case trans32_byte:
                 VPAddrWidth_int = 32;
@@ -406,7 +469,15 @@ VPROC_RTN_TYPE VSetBurstRdByte(VSETBURSTRDBYTE_PARAMS)
     int data             = args[argIdx++];
 #endif
 
-    ns[node]->rcv_buf.databuf[idx % DATABUF_SIZE] = data;
+    // Select the node's duplex stream receive slot buffer when offset
+    if (node >= VP_RX_SLOT_OFFSET)
+    {
+        ns[node - VP_RX_SLOT_OFFSET]->rx_rcv_buf.databuf[idx % DATABUF_SIZE] = data;
+    }
+    else
+    {
+        ns[node]->rcv_buf.databuf[idx % DATABUF_SIZE] = data;
+    }
 }
 
 // -------------------------------------------------------------------------
@@ -426,10 +497,12 @@ VPROC_RTN_TYPE VGetBurstWrByte(VGETBURSTWRBYTE_PARAMS)
     int idx              = args[argIdx++];
 
     argIdx            = VGETBURSTWRBYTE_START_OF_OUTPUTS;
-    args[argIdx++]    = ns[node]->send_buf.databuf[idx % DATABUF_SIZE];;
+    args[argIdx++]    = (node >= VP_RX_SLOT_OFFSET) ? ns[node - VP_RX_SLOT_OFFSET]->rx_send_buf.databuf[idx % DATABUF_SIZE] :
+                                                  ns[node]->send_buf.databuf[idx % DATABUF_SIZE];
     setVhpiParams(cb, args, VGETBURSTWRBYTE_START_OF_OUTPUTS, VGETBURSTWRBYTE_NUM_ARGS);
 #else
-    *data = ns[node]->send_buf.databuf[idx % DATABUF_SIZE];
+    *data = (node >= VP_RX_SLOT_OFFSET) ? ns[node - VP_RX_SLOT_OFFSET]->rx_send_buf.databuf[idx % DATABUF_SIZE] :
+                                          ns[node]->send_buf.databuf[idx % DATABUF_SIZE];
 #endif
 }
 
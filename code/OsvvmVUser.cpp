@@ -17,6 +17,11 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Adding responder wait for any transaction and response latency support
+//                         and stream packet get, tap, duplex receive slot and
+//                         queued burst send, address bus transaction hook and
+//                         local burst checking, including random bursts,
+//                         and interrupt tap
 //    05/2023   2023.05    Adding support for Async, Check and Try functionality
 //    04/2023   2023.04    Adding basic stream support
 //    01/2023   2023.01    Initial revision
@@ -45,12 +50,15 @@
 // -------------------------------------------------------------------------
 
 #include <stdint.h>
+#include <string.h>
 #include <errno.h>
 #include <unistd.h>
 #include <mutex>
 
 #include "OsvvmVProc.h"
 #include "OsvvmVUser.h"
+#include "OsvvmCosimBurstCheck.h"
+#include "OsvvmCosimBurstGen.h"
 
 #if defined(ALDEC) and defined (_WIN32)
 
@@ -88,10 +96,46 @@ static std::mutex  acc_mx[VP_MAX_NODES];
 static std::mutex *acc_mx[VP_MAX_NODES];
 #endif
 
+// Mutexes for the nodes' duplex stream receive slots. These are never destroyed,
+// as a receiving thread may still be waiting in the slot when done is flagged.
+static std::mutex  rx_acc_mx[VP_MAX_NODES];
+
 // -------------------------------------------------------------------------
 // FUNCTION DEFINITIONS
 // -------------------------------------------------------------------------
 
+// -------------------------------------------------------------------------
+// VStreamTap()
+//
+// Call any registered stream tap with burst data
+//
+// -------------------------------------------------------------------------
+static void VStreamTap(const bool txnrx, const uint8_t* data, const int len, const uint32_t node)
+{
+    if (ns[node]->VStreamTapCB != NULL)
+    {
+        (*(ns[node]->VStreamTapCB))(txnrx, data, len, ns[node]->VStreamTapHdl);
+    }
+}
+
+// -------------------------------------------------------------------------
+// VTransHook()
+//
+// Call any registered transaction hook with an address bus access's
+// operation, address and size in bytes
+//
+// -------------------------------------------------------------------------
+static inline void VTransHook(const psend_buf_t psbuf, const uint32_t node)
+{
+    if (ns[node]->VTransHookCB != NULL && psbuf->type <= trans64_burst)
+    {
+        int width = psbuf->type % (trans32_burst + 1);
+        int bytes = (width == trans32_burst) ? psbuf->num_burst_bytes : (1 << width);
+
+        (*(ns[node]->VTransHookCB))(psbuf->op, psbuf->addr, bytes, ns[node]->VTransHookHdl);
+    }
+}
+
 // -------------------------------------------------------------------------
 // VInitSendBuf()
 //
@@ -215,6 +259,21 @@ int VUser (const int node)
     // Interrupt callback initialisation
     ns[node]->VIntVecCB  = NULL;
     ns[node]->last_int   = 0;
+    ns[node]->VIntTapCB  = NULL;
+    ns[node]->VIntTapHdl = NULL;
+
+    // Stream tap callback initialisation
+    ns[node]->VStreamTapCB  = NULL;
+    ns[node]->VStreamTapHdl = NULL;
+
+    // Transaction hook callback initialisation
+    ns[node]->VTransHookCB  = NULL;
+    ns[node]->VTransHookHdl = NULL;
+
+    // Local burst check initialisation
+    ns[node]->burst_check_local  = false;
+    ns[node]->burst_check_errors = 0;
+    ns[node]->burst_check_first  = -1;
 
     DebugVPrint("VUser(): initialised interrupt table node %d\n", node);
 
@@ -242,6 +301,61 @@ int VUser (const int node)
     return 0;
 }
 
+// -------------------------------------------------------------------------
+// VIsRxStreamOp()
+//
+// Returns true if a send buffer holds a stream receive side operation
+//
+// -------------------------------------------------------------------------
+
+static bool VIsRxStreamOp (const psend_buf_t psbuf)
+{
+    int op = (int)psbuf->op;
+
+    return (op >= GET && op <= TRY_CHECK_BURST) ||
+           ((op == WAIT_FOR_TRANSACTION || op == STR_GET_TRANSACTION_COUNT) && ((uint32_t*)psbuf->data)[0] == 0);
+}
+
+// -------------------------------------------------------------------------
+// VExchRx()
+//
+// Message exchange routine for a node's duplex stream receive slot. The
+// first exchange after enabling the slot waits for the simulator to
+// reach the slot, equivalent to the first message of the main exchange.
+//
+// -------------------------------------------------------------------------
+
+static void VExchRx (psend_buf_t psbuf, prcv_buf_t prbuf, const uint32_t node)
+{
+    int status;
+
+    rx_acc_mx[node].lock();
+
+    if (!ns[node]->rx_started)
+    {
+        sem_wait(&(ns[node]->rx_rcv));
+        ns[node]->rx_started = 1;
+    }
+
+    // Send message to simulator's receive slot
+    ns[node]->rx_send_buf = *psbuf;
+    DebugVPrint("VExchRx(): setting rx_snd[%d] semaphore\n", node);
+
+    if ((status = sem_post(&(ns[node]->rx_snd))) == -1)
+    {
+        printf("***Error: bad sem_post status (%d) on node %d (VExchRx)\n", status, node);
+        exit(1);
+    }
+
+    // Wait for response message from simulator
+    DebugVPrint("VExchRx(): waiting for rx_rcv[%d] semaphore\n", node);
+    sem_wait(&(ns[node]->rx_rcv));
+
+    *prbuf = ns[node]->rx_rcv_buf;
+
+    rx_acc_mx[node].unlock();
+}
+
 // -------------------------------------------------------------------------
 // VExch()
 //
@@ -254,6 +368,16 @@ int VUser (const int node)
 
 static void VExch (psend_buf_t psbuf, prcv_buf_t prbuf, const uint32_t node)
 {
+    VTransHook(psbuf, node);
+
+    // In duplex mode, stream receive operations are exchanged via the node's
+    // receive slot, independently of the main exchange
+    if (ns[node]->rx_duplex && VIsRxStreamOp(psbuf))
+    {
+        VExchRx(psbuf, prbuf, node);
+        return;
+    }
+
     // Lock mutex as code is critical if accessed from multiple threads
     // for the same node.
 #if defined (GHDL)
@@ -292,10 +416,18 @@ static void VExch (psend_buf_t psbuf, prcv_buf_t prbuf, const uint32_t node)
     // Get the pointer to the receive response buffer
     *prbuf = ns[node]->rcv_buf;
 
-    // Call user registered interrupt vector callback if the interrupt vector changes
-    if ((prbuf->interrupt != ns[node]->last_int) && ns[node]->VIntVecCB != NULL)
+    // Call user registered interrupt vector callback, and any interrupt tap, if the interrupt vector changes
+    if (prbuf->interrupt != ns[node]->last_int)
     {
-        psbuf->ticks = (*(ns[node]->VIntVecCB))(prbuf->interrupt);
+        if (ns[node]->VIntVecCB != NULL)
+        {
+            psbuf->ticks = (*(ns[node]->VIntVecCB))(prbuf->interrupt);
+        }
+
+        if (ns[node]->VIntTapCB != NULL)
+        {
+            (*(ns[node]->VIntTapCB))(prbuf->interrupt, node, ns[node]->VIntTapHdl);
+        }
     }
 
     ns[node]->last_int = prbuf->interrupt;
@@ -357,7 +489,7 @@ void VWaitForSim(const uint32_t node)
 //
 // -------------------------------------------------------------------------
 
-uint8_t VTransUserCommon (const int op, uint32_t *addr, const uint8_t data, int* status, const int prot, const uint32_t node)
+uint8_t VTransUserCommon (const int op, uint32_t *addr, const uint8_t data, int* status, const int prot, const uint32_t node, const int ticks)
 {
     rcv_buf_t  rbuf;
     send_buf_t sbuf;
@@ -367,6 +499,7 @@ uint8_t VTransUserCommon (const int op, uint32_t *addr, const uint8_t data, int*
     sbuf.type            = trans32_byte;
     sbuf.addr            = *addr;
     sbuf.prot            = prot;
+    sbuf.ticks           = ticks;
     sbuf.op              = (addr_bus_trans_op_t)op;
 
     *((uint8_t*)sbuf.data) = data & 0xffU;
@@ -386,7 +519,7 @@ uint8_t VTransUserCommon (const int op, uint32_t *addr, const uint8_t data, int*
 //
 // -------------------------------------------------------------------------
 
-uint16_t VTransUserCommon (const int op, uint32_t *addr, const uint16_t data,  int* status, int const prot, const uint32_t node)
+uint16_t VTransUserCommon (const int op, uint32_t *addr, const uint16_t data,  int* status, int const prot, const uint32_t node, const int ticks)
 {
     rcv_buf_t  rbuf;
     send_buf_t sbuf;
@@ -396,6 +529,7 @@ uint16_t VTransUserCommon (const int op, uint32_t *addr, const uint16_t data,  i
     sbuf.type            = trans32_hword;
     sbuf.addr            = *addr;
     sbuf.prot            = prot;
+    sbuf.ticks           = ticks;
     sbuf.op              = (addr_bus_trans_op_t)op;
 
     *((uint16_t*)sbuf.data) = data & 0xffffU;
@@ -415,7 +549,7 @@ uint16_t VTransUserCommon (const int op, uint32_t *addr, const uint16_t data,  i
 //
 // -------------------------------------------------------------------------
 
-uint32_t VTransUserCommon (const int op, uint32_t *addr, const uint32_t data, int* status,  const int prot, const uint32_t node)
+uint32_t VTransUserCommon (const int op, uint32_t *addr, const uint32_t data, int* status,  const int prot, const uint32_t node, const int ticks)
 {
     rcv_buf_t  rbuf;
     send_buf_t sbuf;
@@ -425,6 +559,7 @@ uint32_t VTransUserCommon (const int op, uint32_t *addr, const uint32_t data, in
     sbuf.type            = trans32_word;
     sbuf.addr            = *addr;
     sbuf.prot            = prot;
+    sbuf.ticks           = ticks;
     sbuf.op              = (addr_bus_trans_op_t)op;
 
     *((uint32_t*)sbuf.data) = data;
@@ -444,7 +579,7 @@ uint32_t VTransUserCommon (const int op, uint32_t *addr, const uint32_t data, in
 //
 // -------------------------------------------------------------------------
 
-uint8_t VTransUserCommon (const int op, uint64_t *addr, const uint8_t data, int* status, const int prot, const uint32_t node)
+uint8_t VTransUserCommon (const int op, uint64_t *addr, const uint8_t data, int* status, const int prot, const uint32_t node, const int ticks)
 {
     rcv_buf_t  rbuf;
     send_buf_t sbuf;
@@ -454,6 +589,7 @@ uint8_t VTransUserCommon (const int op, uint64_t *addr, const uint8_t data, int*
     sbuf.type            = trans64_byte;
     sbuf.addr            = *addr;
     sbuf.prot            = prot;
+    sbuf.ticks           = ticks;
     sbuf.op              = (addr_bus_trans_op_t)op;
 
     *((uint8_t*)sbuf.data) = data & 0xffU;
@@ -473,7 +609,7 @@ uint8_t VTransUserCommon (const int op, uint64_t *addr, const uint8_t data, int*
 //
 // -------------------------------------------------------------------------
 
-uint16_t VTransUserCommon (const int op, uint64_t *addr, const uint16_t data, int* status, const int prot, const uint32_t node)
+uint16_t VTransUserCommon (const int op, uint64_t *addr, const uint16_t data, int* status, const int prot, const uint32_t node, const int ticks)
 {
     rcv_buf_t  rbuf;
     send_buf_t sbuf;
@@ -483,6 +619,7 @@ uint16_t VTransUserCommon (const int op, uint64_t *addr, const uint16_t data, in
     sbuf.type            = trans64_hword;
     sbuf.addr            = *addr;
     sbuf.prot            = prot;
+    sbuf.ticks           = ticks;
     sbuf.op              = (addr_bus_trans_op_t)op;
 
     *((uint16_t*)sbuf.data) = data & 0xffffU;
@@ -502,7 +639,7 @@ uint16_t VTransUserCommon (const int op, uint64_t *addr, const uint16_t data, in
 //
 // -------------------------------------------------------------------------
 
-uint32_t VTransUserCommon (const int op, uint64_t *addr, const uint32_t data, int* status, const int prot, const uint32_t node)
+uint32_t VTransUserCommon (const int op, uint64_t *addr, const uint32_t data, int* status, const int prot, const uint32_t node, const int ticks)
 {
     rcv_buf_t  rbuf;
     send_buf_t sbuf;
@@ -512,6 +649,7 @@ uint32_t VTransUserCommon (const int op, uint64_t *addr, const uint32_t data, in
     sbuf.type            = trans64_word;
     sbuf.addr            = *addr;
     sbuf.prot            = prot;
+    sbuf.ticks           = ticks;
     sbuf.op              = (addr_bus_trans_op_t)op;
 
     *((uint32_t*)sbuf.data) = data;
@@ -531,7 +669,7 @@ uint32_t VTransUserCommon (const int op, uint64_t *addr, const uint32_t data, in
 //
 // -------------------------------------------------------------------------
 
-uint64_t VTransUserCommon (const int op, uint64_t *addr, const uint64_t data, int* status, const int prot, const uint32_t node)
+uint64_t VTransUserCommon (const int op, uint64_t *addr, const uint64_t data, int* status, const int prot, const uint32_t node, const int ticks)
 {
     rcv_buf_t  rbuf;
     send_buf_t sbuf;
@@ -541,6 +679,7 @@ uint64_t VTransUserCommon (const int op, uint64_t *addr, const uint64_t data, in
     sbuf.type            = trans64_dword;
     sbuf.addr            = *addr;
     sbuf.prot            = prot;
+    sbuf.ticks           = ticks;
     sbuf.op              = (addr_bus_trans_op_t)op;
 
     *((uint64_t*)sbuf.data) = data;
@@ -553,6 +692,244 @@ uint64_t VTransUserCommon (const int op, uint64_t *addr, const uint64_t data, in
     return (uint64_t)rbuf.data_in | ((uint64_t)rbuf.data_in_hi << 32);
 }
 
+// -------------------------------------------------------------------------
+// VTransWaitAnyCommon()
+//
+// Common responder exchange to wait for a transaction on either the write
+// or read channel. The address and data are returned, along with the
+// channel on which the transaction arrived (passed back in the first byte
+// of the burst receive buffer).
+//
+// -------------------------------------------------------------------------
+
+static int VTransWaitAnyCommon (const trans_type_e type, uint64_t *addr, uint64_t *data, const uint32_t node, const int ticks)
+{
+    rcv_buf_t  rbuf;
+    send_buf_t sbuf;
+
+    VInitSendBuf(sbuf);
+
+    sbuf.type            = type;
+    sbuf.ticks           = ticks;
+    sbuf.op              = WAIT_FOR_ANY_TRANSACTION;
+
+    VExch(&sbuf, &rbuf, node);
+
+    *addr   = ((uint64_t)rbuf.addr_in_hi << 32) | ((uint64_t)rbuf.addr_in);
+    *data   = ((uint64_t)rbuf.data_in_hi << 32) | ((uint64_t)rbuf.data_in);
+
+    return rbuf.databuf[0];
+}
+
+// -------------------------------------------------------------------------
+// VTransUserWaitAny()
+//
+// 8-bit byte responder wait for any transaction function (32-bit address)
+//
+// -------------------------------------------------------------------------
+
+int VTransUserWaitAny (uint32_t *addr, uint8_t *data, const uint32_t node, const int ticks)
+{
+    uint64_t addr64;
+    uint64_t data64;
+
+    int channel = VTransWaitAnyCommon(trans32_byte, &addr64, &data64, node, ticks);
+
+    *addr = (uint32_t)addr64;
+    *data = (uint8_t)data64;
+
+    return channel;
+}
+
+// -------------------------------------------------------------------------
+// VTransUserWaitAny()
+//
+// 16-bit word responder wait for any transaction function (32-bit address)
+//
+// -------------------------------------------------------------------------
+
+int VTransUserWaitAny (uint32_t *addr, uint16_t *data, const uint32_t node, const int ticks)
+{
+    uint64_t addr64;
+    uint64_t data64;
+
+    int channel = VTransWaitAnyCommon(trans32_hword, &addr64, &data64, node, ticks);
+
+    *addr = (uint32_t)addr64;
+    *data = (uint16_t)data64;
+
+    return channel;
+}
+
+// -------------------------------------------------------------------------
+// VTransUserWaitAny()
+//
+// 32-bit word responder wait for any transaction function (32-bit address)
+//
+// -------------------------------------------------------------------------
+
+int VTransUserWaitAny (uint32_t *addr, uint32_t *data, const uint32_t node, const int ticks)
+{
+    uint64_t addr64;
+    uint64_t data64;
+
+    int channel = VTransWaitAnyCommon(trans32_word, &addr64, &data64, node, ticks);
+
+    *addr = (uint32_t)addr64;
+    *data = (uint32_t)data64;
+
+    return channel;
+}
+
+// -------------------------------------------------------------------------
+// VTransUserWaitAny()
+//
+// 8-bit byte responder wait for any transaction function (64-bit address)
+//
+// -------------------------------------------------------------------------
+
+int VTransUserWaitAny (uint64_t *addr, uint8_t *data, const uint32_t node, const int ticks)
+{
+    uint64_t addr64;
+    uint64_t data64;
+
+    int channel = VTransWaitAnyCommon(trans64_byte, &addr64, &data64, node, ticks);
+
+    *addr = (uint64_t)addr64;
+    *data = (uint8_t)data64;
+
+    return channel;
+}
+
+// -------------------------------------------------------------------------
+// VTransUserWaitAny()
+//
+// 16-bit word responder wait for any transaction function (64-bit address)
+//
+// -------------------------------------------------------------------------
+
+int VTransUserWaitAny (uint64_t *addr, uint16_t *data, const uint32_t node, const int ticks)
+{
+    uint64_t addr64;
+    uint64_t data64;
+
+    int channel = VTransWaitAnyCommon(trans64_hword, &addr64, &data64, node, ticks);
+
+    *addr = (uint64_t)addr64;
+    *data = (uint16_t)data64;
+
+    return channel;
+}
+
+// -------------------------------------------------------------------------
+// VTransUserWaitAny()
+//
+// 32-bit word responder wait for any transaction function (64-bit address)
+//
+// -------------------------------------------------------------------------
+
+int VTransUserWaitAny (uint64_t *addr, uint32_t *data, const uint32_t node, const int ticks)
+{
+    uint64_t addr64;
+    uint64_t data64;
+
+    int channel = VTransWaitAnyCommon(trans64_word, &addr64, &data64, node, ticks);
+
+    *addr = (uint64_t)addr64;
+    *data = (uint32_t)data64;
+
+    return channel;
+}
+
+// -------------------------------------------------------------------------
+// VTransUserWaitAny()
+//
+// 64-bit word responder wait for any transaction function (64-bit address)
+//
+// -------------------------------------------------------------------------
+
+int VTransUserWaitAny (uint64_t *addr, uint64_t *data, const uint32_t node, const int ticks)
+{
+    uint64_t addr64;
+    uint64_t data64;
+
+    int channel = VTransWaitAnyCommon(trans64_dword, &addr64, &data64, node, ticks);
+
+    *addr = (uint64_t)addr64;
+    *data = (uint64_t)data64;
+
+    return channel;
+}
+
+// -------------------------------------------------------------------------
+// VTransBurstCheckLocal()
+//
+// When local burst checking is enabled on the node, performs a read burst
+// check operation by reading the data back in bulk (or popping it from
+// the read burst FIFO, for the FIFO check variants) and comparing it
+// with the expected increment, random or data pattern here, rather than
+// in the simulation. The result is saved for VTransGetBurstCheckResult()
+// and is affirmed in the OSVVM alert log. Returns true if the operation
+// was handled, or false if it must be sent to the simulation as normal.
+//
+// -------------------------------------------------------------------------
+
+static bool VTransBurstCheckLocal (const int param, const uint64_t addr, const bool addr64, const uint8_t* data, const int bytesize, const int prot, const uint32_t node)
+{
+    uint8_t rdata[DATABUF_SIZE];
+    uint8_t expdata[DATABUF_SIZE];
+    char    msg[256];
+    int     len = bytesize % DATABUF_SIZE;
+    int     first;
+    int     errors;
+
+    bool is_incr = param == BURST_INCR || param == BURST_INCR_CHECK;
+    bool is_rand = param == BURST_RAND || param == BURST_RAND_CHECK;
+    bool is_fifo = param == BURST_INCR_CHECK || param == BURST_RAND_CHECK || param == BURST_FIFO_CHECK;
+
+    if (!ns[node]->burst_check_local || !(is_incr || is_rand || param == BURST_DATA_CHECK || param == BURST_FIFO_CHECK))
+    {
+        return false;
+    }
+
+    // Read the burst data, or pop it when already read into the FIFO
+    if (addr64)
+    {
+        VTransBurstCommon(READ_BURST, is_fifo ? BURST_DATA : BURST_NORM, addr, rdata, len, prot, node);
+    }
+    else
+    {
+        VTransBurstCommon(READ_BURST, is_fifo ? BURST_DATA : BURST_NORM, (uint32_t)addr, rdata, len, prot, node);
+    }
+
+    // Generate the expected random sequence, as the simulation would for the first byte
+    if (is_rand)
+    {
+        OsvvmCosimBurstGen::fillRandom(expdata, data[0], len);
+        data = expdata;
+    }
+
+    errors = is_incr ? OsvvmCosimBurstCheck::checkIncrement(rdata, data[0], len, &first) :
+                       OsvvmCosimBurstCheck::checkData(rdata, data, len, &first);
+
+    ns[node]->burst_check_errors = errors;
+    ns[node]->burst_check_first  = first;
+
+    if (errors == 0)
+    {
+        snprintf(msg, sizeof(msg), "CoSim burst check of %d bytes", len);
+    }
+    else
+    {
+        snprintf(msg, sizeof(msg), "CoSim burst check of %d bytes, %d mismatched, first at index %d. Exp 0x%02x Got 0x%02x",
+                 len, errors, first, is_incr ? (uint8_t)(data[0] + first) : data[first], rdata[first]);
+    }
+
+    VAffirm(errors == 0, msg, node);
+
+    return true;
+}
+
 // -------------------------------------------------------------------------
 // VTransBurstCommon()
 //
@@ -567,6 +944,11 @@ void VTransBurstCommon (const int op, const int param, const uint32_t addr, uint
 
     VInitSendBuf(sbuf);
 
+    if (op == READ_BURST && VTransBurstCheckLocal(param, addr, false, data, bytesize, prot, node))
+    {
+        return;
+    }
+
     sbuf.type            = trans32_burst;
     sbuf.addr            = addr;
     sbuf.prot            = prot;
@@ -614,6 +996,11 @@ void VTransBurstCommon (const int op, const int param, const uint64_t addr, uint
 
     VInitSendBuf(sbuf);
 
+    if (op == READ_BURST && VTransBurstCheckLocal(param, addr, true, data, bytesize, prot, node))
+    {
+        return;
+    }
+
     sbuf.type            = trans64_burst;
     sbuf.addr            = addr;
     sbuf.prot            = prot;
@@ -949,6 +1336,11 @@ bool VStreamUserBurstSendCommon (const int op, const int burst_type, uint8_t* da
 
     VExch(&sbuf, &rbuf, node);
 
+    // Pass any sent burst data to a registered tap
+    if ((op == SEND_BURST || op == SEND_BURST_ASYNC) && (burst_type == BURST_NORM || burst_type == BURST_DATA))
+    {
+        VStreamTap(true, sbuf.databuf, sbuf.num_burst_bytes, node);
+    }
 
     // Return available status (sent back in unused interrupt field)
     return rbuf.interrupt;
@@ -983,12 +1375,124 @@ bool VStreamUserBurstGetCommon (const int op, const int param, uint8_t* data, co
         {
             data[idx] = rbuf.databuf[idx];
         }
+
+        // Pass received burst data to a registered tap
+        VStreamTap(false, rbuf.databuf, sbuf.num_burst_bytes, node);
     }
 
     // Return available status (sent back in unused interrupt field)
     return rbuf.interrupt;
 }
 
+// -------------------------------------------------------------------------
+// VStreamUserBurstGetPktCommon()
+//
+// Common function for getting a whole received packet, of a length
+// determined by the receiver. The number of received bytes (returned in
+// the RX record's IntFromModel) is returned in rxbytes, with at most
+// maxbytes copied to data. A non-zero ticks value waits that many clock
+// cycles after the transaction, in the same exchange.
+//
+// -------------------------------------------------------------------------
+
+bool VStreamUserBurstGetPktCommon (const int op, uint8_t* data, const int maxbytes, int* rxbytes, int* status, const int ticks, const uint32_t node)
+{
+    rcv_buf_t    rbuf;
+    send_buf_t   sbuf;
+
+    VInitSendBuf(sbuf);
+
+    sbuf.type            = stream_get_burst;
+    sbuf.op              = (addr_bus_trans_op_t)op;
+    sbuf.num_burst_bytes = maxbytes % DATABUF_SIZE;
+    sbuf.param           = BURST_NORM;
+    sbuf.ticks           = ticks;
+
+    VExch(&sbuf, &rbuf, node);
+
+    *status  = rbuf.status;
+    *rxbytes = 0;
+
+    // Return data, unless a try with none available
+    if (!((stream_operation_t)sbuf.op == TRY_GET_BURST && !rbuf.interrupt))
+    {
+        *rxbytes = (rbuf.count < 0) ? 0 : (rbuf.count > DATABUF_SIZE) ? DATABUF_SIZE : rbuf.count;
+
+        for (int idx = 0; idx < *rxbytes && idx < maxbytes; idx++)
+        {
+            data[idx] = rbuf.databuf[idx];
+        }
+
+        // Pass received packet to a registered tap
+        VStreamTap(false, rbuf.databuf, *rxbytes, node);
+    }
+
+    // Return available status (sent back in unused interrupt field)
+    return rbuf.interrupt;
+}
+
+// -------------------------------------------------------------------------
+// VStreamUserBurstSendQueued()
+//
+// Send a burst asynchronously, from a credit controlled send queue. A
+// non-zero ticks value waits that many clock cycles after the
+// transaction, in the same exchange. Returns the TX burst FIFO fill
+// level, in bytes, as reported in the response.
+//
+// -------------------------------------------------------------------------
+
+int VStreamUserBurstSendQueued (uint8_t* data, const int bytesize, const int param, const int ticks, const uint32_t node)
+{
+    rcv_buf_t  rbuf;
+    send_buf_t sbuf;
+
+    VInitSendBuf(sbuf);
+
+    sbuf.type               = stream_snd_burst;
+    sbuf.op                 = (addr_bus_trans_op_t)SEND_BURST_ASYNC;
+    sbuf.num_burst_bytes    = bytesize % DATABUF_SIZE;
+    sbuf.param              = param;
+    sbuf.ticks              = ticks;
+    *((uint32_t*)sbuf.data) = BURST_NORM;
+
+    for (int idx = 0; idx < sbuf.num_burst_bytes; idx++)
+    {
+        sbuf.databuf[idx] = data[idx];
+    }
+
+    VExch(&sbuf, &rbuf, node);
+
+    // Pass sent burst data to a registered tap
+    VStreamTap(true, sbuf.databuf, sbuf.num_burst_bytes, node);
+
+    // TX burst FIFO level is sent back in the unused address field
+    return (int)rbuf.addr_in;
+}
+
+// -------------------------------------------------------------------------
+// VStreamUserTxFifoLevel()
+//
+// Wait for the given number of clock cycles (0 for none), returning the
+// TX burst FIFO fill level, in bytes, as reported in the response.
+//
+// -------------------------------------------------------------------------
+
+int VStreamUserTxFifoLevel (const int ticks, const uint32_t node)
+{
+    rcv_buf_t  rbuf;
+    send_buf_t sbuf;
+
+    VInitSendBuf(sbuf);
+
+    sbuf.op              = WAIT_FOR_CLOCK;
+    sbuf.ticks           = ticks;
+
+    VExch(&sbuf, &rbuf, node);
+
+    // TX burst FIFO level is sent back in the unused address field
+    return (int)rbuf.addr_in;
+}
+
 // -------------------------------------------------------------------------
 // VStreamWaitGetCount()
 //
@@ -1062,6 +1566,110 @@ void VRegInterrupt (const pVUserInt_t func, const uint32_t node)
     ns[node]->VIntVecCB = func;
 }
 
+// -------------------------------------------------------------------------
+// VRegInterruptTap()
+//
+// Registers a user function, and handle, to be called with the new
+// interrupt vector whenever it changes, as detected for the interrupt
+// callback, independently of any interrupt callback. A NULL function
+// removes any registered tap.
+//
+// -------------------------------------------------------------------------
+
+void VRegInterruptTap (const pVUserIntTap_t func, void* hdl, const uint32_t node)
+{
+    DebugVPrint("VRegInterruptTap(): at node %d, registering interrupt tap callback\n", node);
+
+    ns[node]->VIntTapHdl = hdl;
+    ns[node]->VIntTapCB  = func;
+}
+
+// -------------------------------------------------------------------------
+// VRegStreamTap()
+//
+// Registers a user function, and handle, to be called with the data of
+// every stream burst sent and received on the node. A NULL function
+// removes any registered tap.
+//
+// -------------------------------------------------------------------------
+
+void VRegStreamTap (const pVUserStreamTap_t func, void* hdl, const uint32_t node)
+{
+    DebugVPrint("VRegStreamTap(): at node %d, registering stream tap callback\n", node);
+
+    ns[node]->VStreamTapHdl = hdl;
+    ns[node]->VStreamTapCB  = func;
+}
+
+// -------------------------------------------------------------------------
+// VRegTransHook()
+//
+// Registers a user function, and handle, to be called with the operation,
+// address and size, in bytes, of every address bus transaction on the
+// node, before it is exchanged. A NULL function removes any registered
+// hook.
+//
+// -------------------------------------------------------------------------
+
+void VRegTransHook (const pVUserTransHook_t func, void* hdl, const uint32_t node)
+{
+    DebugVPrint("VRegTransHook(): at node %d, registering transaction hook callback\n", node);
+
+    ns[node]->VTransHookHdl = hdl;
+    ns[node]->VTransHookCB  = func;
+}
+
+// -------------------------------------------------------------------------
+// VStreamUserSetDuplex()
+//
+// Enable or disable a stream node's duplex receive slot. When enabled,
+// receive operations are exchanged via the slot, so that a receiving
+// thread can have an operation outstanding at the same time as a sending
+// thread. The simulation must call CoSimStreamRx for the node, and the
+// slot must be disabled by the receiving thread when it has finished,
+// before done is flagged.
+//
+// -------------------------------------------------------------------------
+
+void VStreamUserSetDuplex (const bool enable, const uint32_t node)
+{
+    int status;
+
+    DebugVPrint("VStreamUserSetDuplex(): at node %d, %s duplex receive slot\n", node, enable ? "enabling" : "disabling");
+
+    rx_acc_mx[node].lock();
+
+    if (enable)
+    {
+        ns[node]->rx_duplex = 1;
+    }
+    else if (ns[node]->rx_duplex)
+    {
+        // Wait for the simulator to reach the slot, if not yet exchanged with
+        if (!ns[node]->rx_started)
+        {
+            sem_wait(&(ns[node]->rx_rcv));
+        }
+
+        ns[node]->rx_duplex  = 0;
+        ns[node]->rx_started = 0;
+
+        // Release the simulator from the slot with a single idle cycle. Subsequent
+        // visits to the slot by the simulator do not exchange with the user code.
+        VInitSendBuf(ns[node]->rx_send_buf);
+        ns[node]->rx_send_buf.op    = WAIT_FOR_CLOCK;
+        ns[node]->rx_send_buf.ticks = 1;
+
+        if ((status = sem_post(&(ns[node]->rx_snd))) == -1)
+        {
+            printf("***Error: bad sem_post status (%d) on node %d (VStreamUserSetDuplex)\n", status, node);
+            exit(1);
+        }
+    }
+
+    rx_acc_mx[node].unlock();
+}
+
 // -------------------------------------------------------------------------
 // VSetTestName()
 //
@@ -1089,5 +1697,66 @@ void VSetTestName (const char* data, const int bytesize, const uint32_t node)
     return;
 }
 
+// -------------------------------------------------------------------------
+// VAffirm()
+//
+// Report a pass (non-zero) or fail result of a check done in the user
+// code to the OSVVM alert log as an affirmation, with the message in msg
+// -------------------------------------------------------------------------
+
+void VAffirm (const int pass, const char* msg, const uint32_t node)
+{
+    rcv_buf_t  rbuf;
+    send_buf_t sbuf;
+
+    VInitSendBuf(sbuf);
+
+    sbuf.type            = trans_idle;
+    sbuf.op              = AFFIRM_RESULT;
+    sbuf.num_burst_bytes = strlen(msg) % DATABUF_SIZE;
+
+    *((uint32_t*)sbuf.data) = pass ? 1 : 0;
+
+    for (int idx = 0; idx < sbuf.num_burst_bytes; idx++)
+    {
+        sbuf.databuf[idx] = msg[idx];
+    }
+
+    VExch(&sbuf, &rbuf, node);
+
+    return;
+}
+
+// -------------------------------------------------------------------------
+// VTransSetLocalBurstCheck()
+//
+// Enable or disable local checking of the node's read burst increment
+// and data check operations
+// -------------------------------------------------------------------------
+
+void VTransSetLocalBurstCheck (const bool enable, const uint32_t node)
+{
+    DebugVPrint("VTransSetLocalBurstCheck(): at node %d, %s local burst checking\n", node, enable ? "enabling" : "disabling");
+
+    ns[node]->burst_check_local  = enable;
+    ns[node]->burst_check_errors = 0;
+    ns[node]->burst_check_first  = -1;
+}
+
+// -------------------------------------------------------------------------
+// VTransGetBurstCheckResult()
+//
+// Return the number of mismatched bytes of the node's last locally
+// checked burst, with the index of the first in first (if not NULL),
+// or -1 if none
+// -------------------------------------------------------------------------
 
+int VTransGetBurstCheckResult (int* first, const uint32_t node)
+{
+    if (first != NULL)
+    {
+        *first = ns[node]->burst_check_first;
+    }
 
+    return ns[node]->burst_check_errors;
+}
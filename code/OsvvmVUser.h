@@ -15,6 +15,10 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Adding responder wait for any transaction and response latency,
+//                         and stream packet get, tap, duplex receive slot,
+//                         queued burst send, address bus transaction hook
+//                         and local burst checking, and interrupt tap
 //    05/2023   2023.05    Adding support for Async, Try and Check transactions
 //                         and address bus repsonder
 //    01/2023   2023.01    Initial revision
@@ -126,19 +130,35 @@ extern void      VWaitForSim                    (const uint32_t node = 0);
 // OSVVM support function to set the test name
 extern void      VSetTestName                   (const char*    data, const int bytesize, const uint32_t node);
 
+// OSVVM support function to affirm a user code check result in the alert log
+extern void      VAffirm                        (const int      pass, const char* msg,    const uint32_t node = 0);
+
 // Overloaded transaction functions for 32 and 64 bit architecture for byte, half-word, word and double-word
-extern uint8_t   VTransUserCommon               (const int op, uint32_t *addr, const uint8_t  data, int* status, const int prot = 0, const uint32_t node = 0);
-extern uint16_t  VTransUserCommon               (const int op, uint32_t *addr, const uint16_t data, int* status, const int prot = 0, const uint32_t node = 0);
-extern uint32_t  VTransUserCommon               (const int op, uint32_t *addr, const uint32_t data, int* status, const int prot = 0, const uint32_t node = 0);
-extern uint8_t   VTransUserCommon               (const int op, uint64_t *addr, const uint8_t  data, int* status, const int prot = 0, const uint32_t node = 0);
-extern uint16_t  VTransUserCommon               (const int op, uint64_t *addr, const uint16_t data, int* status, const int prot = 0, const uint32_t node = 0);
-extern uint32_t  VTransUserCommon               (const int op, uint64_t *addr, const uint32_t data, int* status, const int prot = 0, const uint32_t node = 0);
-extern uint64_t  VTransUserCommon               (const int op, uint64_t *addr, const uint64_t data, int* status, const int prot = 0, const uint32_t node = 0);
+extern uint8_t   VTransUserCommon               (const int op, uint32_t *addr, const uint8_t  data, int* status, const int prot = 0, const uint32_t node = 0, const int ticks = 0);
+extern uint16_t  VTransUserCommon               (const int op, uint32_t *addr, const uint16_t data, int* status, const int prot = 0, const uint32_t node = 0, const int ticks = 0);
+extern uint32_t  VTransUserCommon               (const int op, uint32_t *addr, const uint32_t data, int* status, const int prot = 0, const uint32_t node = 0, const int ticks = 0);
+extern uint8_t   VTransUserCommon               (const int op, uint64_t *addr, const uint8_t  data, int* status, const int prot = 0, const uint32_t node = 0, const int ticks = 0);
+extern uint16_t  VTransUserCommon               (const int op, uint64_t *addr, const uint16_t data, int* status, const int prot = 0, const uint32_t node = 0, const int ticks = 0);
+extern uint32_t  VTransUserCommon               (const int op, uint64_t *addr, const uint32_t data, int* status, const int prot = 0, const uint32_t node = 0, const int ticks = 0);
+extern uint64_t  VTransUserCommon               (const int op, uint64_t *addr, const uint64_t data, int* status, const int prot = 0, const uint32_t node = 0, const int ticks = 0);
+
+// Overloaded responder functions to wait for a transaction on any channel, returning the channel
+extern int       VTransUserWaitAny              (uint32_t *addr, uint8_t  *data, const uint32_t node = 0, const int ticks = 0);
+extern int       VTransUserWaitAny              (uint32_t *addr, uint16_t *data, const uint32_t node = 0, const int ticks = 0);
+extern int       VTransUserWaitAny              (uint32_t *addr, uint32_t *data, const uint32_t node = 0, const int ticks = 0);
+extern int       VTransUserWaitAny              (uint64_t *addr, uint8_t  *data, const uint32_t node = 0, const int ticks = 0);
+extern int       VTransUserWaitAny              (uint64_t *addr, uint16_t *data, const uint32_t node = 0, const int ticks = 0);
+extern int       VTransUserWaitAny              (uint64_t *addr, uint32_t *data, const uint32_t node = 0, const int ticks = 0);
+extern int       VTransUserWaitAny              (uint64_t *addr, uint64_t *data, const uint32_t node = 0, const int ticks = 0);
 
 // Overloaded stream transaction functions for 32 and 64 bit architecture
 extern void      VTransBurstCommon              (const int op, const int param, const uint32_t addr, uint8_t* data, const int bytesize, const int prot = 0, const uint32_t node = 0);
 extern void      VTransBurstCommon              (const int op, const int param, const uint64_t addr, uint8_t* data, const int bytesize, const int prot = 0, const uint32_t node = 0);
 
+// Local read burst check enable and result functions
+extern void      VTransSetLocalBurstCheck       (const bool enable, const uint32_t node = 0);
+extern int       VTransGetBurstCheckResult      (int* first = NULL, const uint32_t node = 0);
+
 extern int       VTransGetCount                 (const int op, const uint32_t node = 0);
 extern void      VTransTransactionWait          (const int op, const uint32_t node = 0);
 
@@ -157,13 +177,28 @@ extern bool      VStreamUserGetCommon           (const int op, uint64_t *rdata,
 // Stream burst send and get common transaction functions
 extern bool      VStreamUserBurstSendCommon     (const int op, const int burst_type, uint8_t* data, const int bytesize, const int param = 0, const uint32_t node = 0);
 extern bool      VStreamUserBurstGetCommon      (const int op, const int param,      uint8_t* data, const int bytesize, int* status,         const uint32_t node = 0);
+extern bool      VStreamUserBurstGetPktCommon   (const int op, uint8_t* data, const int maxbytes, int* rxbytes, int* status, const int ticks = 0, const uint32_t node = 0);
+extern int       VStreamUserBurstSendQueued     (uint8_t* data, const int bytesize, const int param = 0, const int ticks = 0, const uint32_t node = 0);
+extern int       VStreamUserTxFifoLevel         (const int ticks = 0, const uint32_t node = 0);
 
 extern int       VStreamWaitGetCount            (const int op, const bool txnrx, const uint32_t node = 0);
 
+// Stream duplex receive slot enable/disable function
+extern void      VStreamUserSetDuplex           (const bool enable, const uint32_t node = 0);
+
 // User function called from VInit to instigate new user thread
 extern int       VUser                          (const int node);
 
 // User interrupt callback registering function
 extern void      VRegInterrupt                  (const pVUserInt_t func, const uint32_t node);
 
+// User interrupt tap callback registering function
+extern void      VRegInterruptTap               (const pVUserIntTap_t func, void* hdl, const uint32_t node);
+
+// User stream burst tap callback registering function
+extern void      VRegStreamTap                  (const pVUserStreamTap_t func, void* hdl, const uint32_t node);
+
+// User address bus transaction hook registering function
+extern void      VRegTransHook                  (const pVUserTransHook_t func, void* hdl, const uint32_t node);
+
 #endif
@@ -14,6 +14,11 @@
 --
 --  Revision History:
 --    Date      Version    Description
+--    10/2026   2026.10    Added responder wait for any transaction operation
+--                         and response latency on VPTicks. Added duplex
+--                         stream receive slot procedure CoSimStreamRx and
+--                         TX burst FIFO level reporting. Added affirmation of
+--                         check results from the software
 --    05/2023   2023.05    Adding asynchronous, check and try transaction support,
 --                         and added address bus responder functionality.
 --    04/2023   2023.04    Adding basic stream support
@@ -58,7 +63,11 @@ library osvvm_cosim ;
 package OsvvmTestCoSimPkg is
 
   -- CoSim specific enumerations
-  type CoSimOperationType is (SET_TEST_NAME) ;                            -- For non-standard VPOperation values on VPOp from VTrans
+  type CoSimOperationType is (SET_TEST_NAME,                              -- For non-standard VPOperation values on VPOp from VTrans
+                              WAIT_FOR_ANY_TRANSACTION,
+                              AFFIRM_RESULT) ;
+
+  type RespChannelType    is (NO_CHANNEL, WRITE_CHANNEL, READ_CHANNEL) ;  -- Responder channel returned in burst read byte 0 for WAIT_FOR_ANY_TRANSACTION
 
   type BurstType          is (BURST_NORM,       BURST_INCR,               -- Burst sub-operation selection in VPParam from VTrans
                               BURST_RAND,       BURST_INCR_PUSH,
@@ -69,6 +78,8 @@ package OsvvmTestCoSimPkg is
 
   type DirType            is (RX_REC, TX_REC);                            -- Stream bus direction in (overloaded) VPData from VTrans
 
+  constant COSIM_RX_SLOT_OFFSET : integer := 1024 ;                       -- Node number offset selecting a node's duplex stream receive slot
+
   ------------------------------------------------------------
   -- function to construct slv_vector from CoSim burst data
   ------------------------------------------------------------
@@ -122,6 +133,16 @@ procedure CoSimResp (
     variable NodeNum         : in     integer := 0
   ) ;
 
+  ------------------------------------------------------------
+  -- Co-simulation procedure to generate stream receive
+  -- transactions from a node's duplex receive slot. Called
+  -- in its own process, after CoSimInit for the node.
+  ------------------------------------------------------------
+  procedure CoSimStreamRx (
+    signal   RxRec           : inout  StreamRecType ;
+    variable NodeNum         : in     integer := 0
+  ) ;
+
 
   ------------------------------------------------------------
   -- Co-simulation stand-alone IRQ procedure
@@ -192,6 +213,24 @@ procedure CoSimResp (
     constant NodeNum         : in     integer
   ) ;
 
+  ------------------------------------------------------------
+  -- Co-simulation procedure to dispatch one stream receive
+  -- transaction from a node's duplex receive slot
+  ------------------------------------------------------------
+
+  procedure CoSimDispatchOneStreamRx (
+    -- Transaction  interface
+    signal   RxRec           : inout  StreamRecType ;
+    constant VPOperation     : in     integer ;
+    constant VPDataOut       : in     integer ;
+    constant VPDataOutHi     : in     integer ;
+    constant VPDataWidth     : in     integer ;
+    variable VPBurstSize     : inout  integer ;
+    constant VPTicks         : in     integer ;
+    constant VPParam         : in     integer ;
+    constant SlotNum         : in     integer
+  ) ;
+
 end package OsvvmTestCoSimPkg ;
 
 -- /////////////////////////////////////////////////////////////////////////////////////////
@@ -368,6 +407,7 @@ package body OsvvmTestCoSimPkg is
     variable RdDataInt       : integer ;
     variable WrDataInt       : integer ;
     variable TestName        : string(1 to VPBurstSize) ;
+    variable Message         : string(1 to VPBurstSize) ;
     variable Available       : boolean ;
 
   begin
@@ -588,6 +628,16 @@ package body OsvvmTestCoSimPkg is
 
           SetTestName(TestName(1 to VPBurstSize)) ;
 
+        when AFFIRM_RESULT =>
+
+          -- Affirm the result of a check done in the software, with the message in the burst data
+          for bidx in 0 to VPBurstSize-1 loop
+            VGetBurstWrByte(NodeNum, bidx, WrDataInt) ;
+            Message(bidx+1) := character'val(WrDataInt mod 256);
+          end loop ;
+
+          AffirmIf(VPDataOut /= 0, Message(1 to VPBurstSize)) ;
+
         when others =>
           Alert("CoSim/src/OsvvmTestCoSimPkg: CoSimDispatchOneTransaction received unimplemented transaction") ;
       end case ;
@@ -698,6 +748,9 @@ package body OsvvmTestCoSimPkg is
     variable WrData          : std_logic_vector (DATA_WIDTH_MAX-1 downto 0) ;
     variable Address         : std_logic_vector (ADDR_WIDTH_MAX-1 downto 0) ;
     variable RdDataInt       : integer ;
+    variable WrDataInt       : integer ;
+    variable TestName        : string(1 to VPBurstSize) ;
+    variable Message         : string(1 to VPBurstSize) ;
     variable Available       : boolean ;
 
   begin
@@ -709,6 +762,12 @@ package body OsvvmTestCoSimPkg is
     WrData(31 downto 0 )  := std_logic_vector(to_signed(VPDataOut,   32)) ;
     WrData(63 downto 32)  := std_logic_vector(to_signed(VPDataOutHi, 32)) ;
 
+    -- If VPTicks non-zero for response operations, wait for clock before the operation
+    -- to insert any response latency without further exchanges with the software
+    if VPOperation /= AddressBusOperationType'pos(WAIT_FOR_CLOCK) and VPTicks > 0 then
+      WaitForClock(SubordinateRec, VPTicks) ;
+    end if ;
+
     if VPOperation < 1024 then
       case AddressBusOperationType'val(VPOperation) is
 
@@ -773,6 +832,62 @@ package body OsvvmTestCoSimPkg is
           Alert("CoSim/src/OsvvmTestCoSimPkg: CoSimDispatchOneResponse received unimplemented transaction") ;
 
       end case ;
+
+    else
+
+      case CoSimOperationType'val(VPOperation - 1024) is
+
+        when SET_TEST_NAME =>
+
+          for bidx in 0 to VPBurstSize-1 loop
+            VGetBurstWrByte(NodeNum, bidx, WrDataInt) ;
+            if (WrDataInt < 0 or WrDataInt > 255) then
+              Alert("CoSim/src/OsvvmTestCoSimPkg: CoSimDispatchOneResponse SetTestName - bad character value") ;
+              return ;
+            end if ;
+            TestName(bidx+1) := character'val(WrDataInt);
+          end loop ;
+
+          SetTestName(TestName(1 to VPBurstSize)) ;
+
+        when WAIT_FOR_ANY_TRANSACTION =>
+
+          -- Poll both channels, a clock at a time, until one of them has a transaction,
+          -- so that the software side only sees a single exchange. A write is only
+          -- returned once both its address and data have arrived.
+          loop
+            TryGetWrite(SubordinateRec, Address(VPAddrWidth-1 downto 0), RdData(VPDataWidth-1 downto 0), Available) ;
+
+            if Available then
+              VSetBurstRdByte(NodeNum, 0, RespChannelType'pos(WRITE_CHANNEL)) ;
+              exit ;
+            end if ;
+
+            TryGetReadAddress(SubordinateRec, Address(VPAddrWidth-1 downto 0), Available) ;
+
+            if Available then
+              VSetBurstRdByte(NodeNum, 0, RespChannelType'pos(READ_CHANNEL)) ;
+              exit ;
+            end if ;
+
+            WaitForClock(SubordinateRec, 1) ;
+          end loop ;
+
+        when AFFIRM_RESULT =>
+
+          -- Affirm the result of a check done in the software, with the message in the burst data
+          for bidx in 0 to VPBurstSize-1 loop
+            VGetBurstWrByte(NodeNum, bidx, WrDataInt) ;
+            Message(bidx+1) := character'val(WrDataInt mod 256);
+          end loop ;
+
+          AffirmIf(VPDataOut /= 0, Message(1 to VPBurstSize)) ;
+
+        when others =>
+          Alert("CoSim/src/OsvvmTestCoSimPkg: CoSimDispatchOneResponse received unimplemented transaction") ;
+
+      end case ;
+
     end if ;
   end procedure CoSimDispatchOneResponse ;
 
@@ -802,7 +917,7 @@ package body OsvvmTestCoSimPkg is
     variable VPCountTx         : integer ;
     variable VPCountRx         : integer ;
 
-    variable UnusedVPAddrLo    : integer ;
+    variable VPTxLevel         : integer ;
     variable UnusedVPAddrHi    : integer ;
     variable UnusedVPAddrWidth : integer ;
     variable Available         : integer  := 0;
@@ -819,6 +934,9 @@ package body OsvvmTestCoSimPkg is
 
     Available  := 1 when RxRec.BoolFromModel else 0 ;
 
+    -- Report the TX burst FIFO fill level, in bytes, in the otherwise unused address
+    VPTxLevel  := GetFifoCount(TxRec.BurstFifo) ;
+
     RdData     := osvvm.TbUtilPkg.MetaTo01(SafeResize(RxRec.DataFromModel, RdData'length)) ;
     -- Sample the read data from last access, saved in RdData inout port
     if RdData'length > 32 then
@@ -833,7 +951,7 @@ package body OsvvmTestCoSimPkg is
     -- Call VTrans to generate a new TX access
     VTrans(NodeNum,        Available,      VPStatus, VPCountRx, VPCountTx,
            VPData,         VPDataHi,       VPDataWidth,
-           UnusedVPAddrLo, UnusedVPAddrHi, UnusedVPAddrWidth,
+           VPTxLevel,      UnusedVPAddrHi, UnusedVPAddrWidth,
            VPOp,           VPBurstSize,    VPTicks,
            VPDone,         VPError,        VPParam) ;
 
@@ -848,6 +966,74 @@ package body OsvvmTestCoSimPkg is
 
   end procedure CoSimStream ;
 
+  ------------------------------------------------------------
+  -- Co-simulation wrapper procedure to receive stream
+  -- transactions from a node's duplex receive slot
+  ------------------------------------------------------------
+  procedure CoSimStreamRx (
+    -- Transaction  interface
+    signal   RxRec           : inout  StreamRecType ;
+    variable NodeNum         : in     integer := 0
+    ) is
+
+    variable VPData            : integer ;
+    variable VPDataHi          : integer ;
+    variable VPDataWidth       : integer ;
+    variable VPOp              : integer ;
+    variable VPBurstSize       : integer ;
+    variable VPTicks           : integer ;
+    variable VPDone            : integer ;
+    variable VPError           : integer ;
+    variable VPParam           : integer ;
+    variable VPStatus          : integer ;
+    variable VPCountRx         : integer ;
+    variable SlotNum           : integer ;
+
+    variable UnusedVPAddrLo    : integer ;
+    variable UnusedVPAddrHi    : integer ;
+    variable UnusedVPAddrWidth : integer ;
+    variable UnusedCount       : integer  := 0;
+    variable Available         : integer  := 0;
+
+    variable RdData            : std_logic_vector (DATA_WIDTH_MAX-1 downto 0) ;
+    variable Status            : std_logic_vector (31 downto 0) ;
+
+  begin
+
+    SlotNum    := NodeNum + COSIM_RX_SLOT_OFFSET ;
+
+    Status     := osvvm.TbUtilPkg.MetaTo01(SafeResize(RxRec.ParamFromModel, Status'length)) ;
+    VPStatus   := to_integer(signed(Status)) ;
+    VPCountRx  := RxRec.IntFromModel;
+
+    Available  := 1 when RxRec.BoolFromModel else 0 ;
+
+    RdData     := osvvm.TbUtilPkg.MetaTo01(SafeResize(RxRec.DataFromModel, RdData'length)) ;
+    -- Sample the read data from last access, saved in RdData inout port
+    if RdData'length > 32 then
+      VPData     := to_integer(signed(RdData(31 downto  0))) ;
+      VPDataHi   := to_integer(signed(RdData(RdData'length-1 downto 32))) ;
+    else
+      VPData     := to_integer(signed(RdData(31 downto 0))) ;
+      VPDataHi   := 0 ;
+    end if;
+
+    -- Call VTrans to generate a new RX access. When the node's duplex receive
+    -- slot is not enabled by the software, this returns a single clock wait.
+    VTrans(SlotNum,        Available,      VPStatus, VPCountRx, UnusedCount,
+           VPData,         VPDataHi,       VPDataWidth,
+           UnusedVPAddrLo, UnusedVPAddrHi, UnusedVPAddrWidth,
+           VPOp,           VPBurstSize,    VPTicks,
+           VPDone,         VPError,        VPParam) ;
+
+    CoSimDispatchOneStreamRx (RxRec,
+                              VPOp,
+                              VPData,      VPDataHi,    VPDataWidth,
+                              VPBurstSize, VPTicks,     VPParam,
+                              SlotNum) ;
+
+  end procedure CoSimStreamRx ;
+
   ------------------------------------------------------------
   -- Co-simulation procedure to dispatch one stream transaction
   ------------------------------------------------------------
@@ -872,6 +1058,7 @@ package body OsvvmTestCoSimPkg is
     variable RdDataInt       : integer ;
     variable WrDataInt       : integer ;
     variable TestName        : string(1 to VPBurstSize) ;
+    variable Message         : string(1 to VPBurstSize) ;
     variable Available       : boolean ;
 
     variable Fifo            : ScoreboardIdType;
@@ -1075,6 +1262,16 @@ package body OsvvmTestCoSimPkg is
 
           SetTestName(TestName(1 to VPBurstSize)) ;
 
+        when AFFIRM_RESULT =>
+
+          -- Affirm the result of a check done in the software, with the message in the burst data
+          for bidx in 0 to VPBurstSize-1 loop
+            VGetBurstWrByte(NodeNum, bidx, WrDataInt) ;
+            Message(bidx+1) := character'val(WrDataInt mod 256);
+          end loop ;
+
+          AffirmIf(VPDataOut /= 0, Message(1 to VPBurstSize)) ;
+
         when others =>
           Alert("CoSim/src/OsvvmTestCoSimPkg: CoSimDispatchOneStream received unimplemented transaction") ;
 
@@ -1084,4 +1281,151 @@ package body OsvvmTestCoSimPkg is
 
   end procedure CoSimDispatchOneStream ;
 
+  ------------------------------------------------------------
+  -- Co-simulation procedure to dispatch one stream receive
+  -- transaction from a node's duplex receive slot
+  ------------------------------------------------------------
+  procedure CoSimDispatchOneStreamRx (
+    -- Transaction  interface
+    signal   RxRec           : inout  StreamRecType ;
+    constant VPOperation     : in     integer ;
+    constant VPDataOut       : in     integer ;
+    constant VPDataOutHi     : in     integer ;
+    constant VPDataWidth     : in     integer ;
+    variable VPBurstSize     : inout  integer ;
+    constant VPTicks         : in     integer ;
+    constant VPParam         : in     integer ;
+    constant SlotNum         : in     integer
+  ) is
+
+    variable RdData          : std_logic_vector (DATA_WIDTH_MAX-1 downto 0) ;
+    variable WrData          : std_logic_vector (DATA_WIDTH_MAX-1 downto 0) ;
+    variable Param           : std_logic_vector (31 downto 0) ;
+    variable WrByteData      : signed (DATA_WIDTH_MAX-1 downto 0) ;
+    variable RdDataInt       : integer ;
+    variable WrDataInt       : integer ;
+    variable Available       : boolean ;
+
+  begin
+
+    -- Convert check data to std_logic_vectors
+    WrData(31 downto 0 )  := std_logic_vector(to_signed(VPDataOut,   32)) ;
+    WrData(63 downto 32)  := std_logic_vector(to_signed(VPDataOutHi, 32)) ;
+    Param(31 downto 0)    := std_logic_vector(to_signed(VPParam,     32)) ;
+
+    case StreamOperationType'val(VPOperation) is
+
+      when WAIT_FOR_CLOCK =>
+        WaitForClock(RxRec, VPTicks) ;
+
+      when GET =>
+        Param := (others => '0') ;
+        Get  (RxRec, RdData(VPDataWidth-1 downto 0), Param(RxRec.ParamFromModel'length -1 downto 0)) ;
+
+      when TRY_GET =>
+        TryGet(RxRec, RdData(VPDataWidth-1 downto 0), Param(RxRec.ParamFromModel'length -1 downto 0), Available) ;
+
+      when CHECK =>
+        Check (RxRec, WrData(VPDataWidth-1 downto 0), Param(RxRec.ParamFromModel'length -1 downto 0)) ;
+
+      when TRY_CHECK =>
+        TryCheck(RxRec, WrData(VPDataWidth-1 downto 0), Param(RxRec.ParamFromModel'length -1 downto 0), Available) ;
+
+      when GET_BURST | TRY_GET_BURST =>
+
+        if StreamOperationType'val(VPOperation) = TRY_GET_BURST then
+          TryGetBurst(RxRec, VPBurstSize, Param(RxRec.ParamToModel'length-1 downto 0), Available);
+        elsif BurstType'val(VPParam) /= BURST_DATA then
+          GetBurst(RxRec, VPBurstSize, Param(RxRec.ParamToModel'length -1 downto 0)) ;
+          Available := true ;
+        else
+          Available := true ;
+        end if ;
+
+        -- If not a pure get operation, pop the bytes from the read fifo and write them to the co-sim receive buffer
+        if BurstType'val(VPParam) /= BURST_TRANS and Available then
+          RdData := (others => '0');
+
+          for bidx in 0 to VPBurstSize-1 loop
+            Pop(RxRec.BurstFifo, RdData(7 downto 0)) ;
+            RdDataInt := to_integer(unsigned(RdData(7 downto 0))) ;
+
+            VSetBurstRdByte(SlotNum, bidx, RdDataInt) ;
+          end loop ;
+        end if ;
+
+      when CHECK_BURST | TRY_CHECK_BURST =>
+
+        -- If a try-check, flag when something available to process, else always flag true
+        if StreamOperationType'val(VPOperation) = TRY_CHECK_BURST then
+          GotBurst (RxRec, VPBurstSize, Available);
+        else
+          Available := true ;
+        end if ;
+
+        if Available then
+
+          -- Select the burst operations based on the burst type passed from the software
+          case BurstType'val(VPDataOut) is
+
+            when BURST_NORM | BURST_DATA | BURST_TRANS  =>
+
+              -- Fetch the bytes from the co-sim send buffer and push to the receive fifo
+              if BurstType'val(VPDataOut) /= BURST_TRANS then
+                for bidx in 0 to VPBurstSize-1 loop
+                  VGetBurstWrByte(SlotNum, bidx, WrDataInt) ;
+                  WrByteData := to_signed(WrDataInt, WrByteData'length) ;
+                  Push(RxRec.BurstFifo, std_logic_vector(WrByteData(7 downto 0))) ;
+                end loop ;
+              end if ;
+
+              if BurstType'val(VPDataOut) /= BURST_DATA then
+                CheckBurst(RxRec, VPBurstSize, Param(RxRec.ParamToModel'length -1 downto 0)) ;
+              end if ;
+
+            when BURST_INCR_PUSH =>
+              VGetBurstWrByte(SlotNum, 0, WrDataInt) ;
+              WrByteData := to_signed(WrDataInt, WrByteData'length) ;
+              PushBurstIncrement(RxRec.BurstFifo, std_logic_vector(WrByteData(7 downto 0)), VPBurstSize) ;
+
+            when BURST_RAND_PUSH =>
+              VGetBurstWrByte(SlotNum, 0, WrDataInt) ;
+              WrByteData := to_signed(WrDataInt, WrByteData'length) ;
+              PushBurstRandom(RxRec.BurstFifo, std_logic_vector(WrByteData(7 downto 0)), VPBurstSize) ;
+
+            when BURST_INCR_CHECK =>
+              VGetBurstWrByte(SlotNum, 0, WrDataInt) ;
+              WrByteData := to_signed(WrDataInt, WrByteData'length) ;
+              CheckBurstIncrement(RxRec, std_logic_vector(WrByteData(7 downto 0)), VPBurstSize, Param(RxRec.ParamToModel'length -1 downto 0)) ;
+
+            when BURST_RAND_CHECK =>
+              VGetBurstWrByte(SlotNum, 0, WrDataInt) ;
+              WrByteData := to_signed(WrDataInt, WrByteData'length) ;
+              CheckBurstRandom(RxRec, std_logic_vector(WrByteData(7 downto 0)), VPBurstSize, Param(RxRec.ParamToModel'length -1 downto 0)) ;
+
+            when others =>
+              Alert("CoSim/src/OsvvmTestCoSimPkg: CoSimDispatchOneStreamRx received unimplemented burst type") ;
+
+          end case ;
+        end if ;
+
+      when WAIT_FOR_TRANSACTION =>
+        WaitForTransaction(RxRec) ;
+
+      when GET_TRANSACTION_COUNT =>
+        GetTransactionCount(RxRec, RdDataInt) ;
+
+      when others =>
+        Alert("CoSim/src/OsvvmTestCoSimPkg: CoSimDispatchOneStreamRx received unimplemented transaction") ;
+
+    end case ;
+
+    -- If VPTicks non-zero for transaction operations do wait for clock after the transaction
+    -- executed
+    if StreamOperationType'val(VPOperation) /= WAIT_FOR_CLOCK and VPTicks /= 0 then
+      WaitForClock(RxRec, VPTicks) ;
+    end if ;
+
+  end procedure CoSimDispatchOneStreamRx ;
+
 end package body OsvvmTestCoSimPkg ;
@@ -48,4 +48,5 @@ if {$::osvvm::ToolName ne "GHDL"} {
 }
 
 analyze    ../TestCases/TbAb_CoSim.vhd
+analyze    ../TestCases/TbAb_SktServer.vhd
 
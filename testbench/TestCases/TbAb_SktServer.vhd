@@ -0,0 +1,160 @@
+--
+--  File Name:           TbAb_SktServer.vhd
+--  Design Unit Name:    Architecture of TestCtrl
+--  Revision:            OSVVM MODELS STANDARD VERSION
+--
+--  Maintainer:          Simon Southwell  email: simon.southwell@gmail.com
+--  Contributor(s):
+--     Simon Southwell  simon.southwell@gmail.com
+--
+--
+--  Description:
+--      Two node transaction source for the multi-client socket server,
+--      with node 0 on the manager and node 1 on the memory's transaction
+--      interface
+--
+--
+--  Developed by:
+--        SynthWorks Design Inc.
+--        VHDL Training Classes
+--        http://www.SynthWorks.com
+--
+--  Revision History:
+--    Date      Version    Description
+--    10/2026   2026.10    Initial revision
+--
+--
+--  This file is part of OSVVM.
+--
+--  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+--
+--  Licensed under the Apache License, Version 2.0 (the "License");
+--  you may not use this file except in compliance with the License.
+--  You may obtain a copy of the License at
+--
+--      https://www.apache.org/licenses/LICENSE-2.0
+--
+--  Unless required by applicable law or agreed to in writing, software
+--  distributed under the License is distributed on an "AS IS" BASIS,
+--  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+--  See the License for the specific language governing permissions and
+--  limitations under the License.
+--
+
+architecture SktServer of TestCtrl is
+
+  signal   TestDone       : integer_barrier := 1 ;
+
+begin
+
+  ------------------------------------------------------------
+  -- ControlProc
+  --   Set up AlertLog and wait for end of test
+  ------------------------------------------------------------
+  ControlProc : process
+  begin
+    -- Initialization of test
+    --!! NOTE:  SetTestName called by software
+    SetLogEnable(PASSED, TRUE) ;    -- Enable PASSED logs
+    SetLogEnable(INFO, TRUE) ;    -- Enable INFO logs
+
+    -- Wait for testbench initialization
+    wait for 0 ns ;  wait for 0 ns ;
+    TranscriptOpen(OSVVM_OUTPUT_DIRECTORY & GetTestName & ".txt") ;
+    SetTranscriptMirror(TRUE) ;
+
+    -- Wait for Design Reset
+    wait until nReset = '1' ;
+    ClearAlerts ;
+
+    -- Wait for test to finish
+    WaitForBarrier(TestDone, 10 ms) ;
+    AlertIf(now >= 10 ms, "Test finished due to timeout") ;
+    AlertIf(GetAffirmCount < 1, "Test is not Self-Checking");
+
+    TranscriptClose ;
+
+    EndOfTestReports ;
+    std.env.stop ;
+    wait ;
+  end process ControlProc ;
+
+  ------------------------------------------------------------
+  -- ManagerProc
+  --   Generate transactions for AxiManager from node 0
+  ------------------------------------------------------------
+  ManagerProc : process
+    variable Done           : integer := 0 ;
+    variable Error          : integer := 0 ;
+    variable IntReq         : integer := 0 ;
+    variable NodeNum        : integer := 0 ;
+  begin
+    -- Initialise VProc code
+    CoSimInit(NodeNum);
+    -- Fetch the SetTestName
+    CoSimTrans (ManagerRec, Done, Error, IntReq, NodeNum);
+
+    -- Find exit of reset
+    wait until nReset = '1' ;
+    WaitForClock(ManagerRec, 2) ;
+
+    OperationLoop : loop
+
+      -- Call CoSimTrans procedure to generate an access from the running VProc program
+      CoSimTrans (ManagerRec, Done, Error, IntReq, NodeNum);
+
+      AlertIf(Error /= 0, "CoSimTrans node 0 flagged an error") ;
+
+      exit when Done /= 0;
+
+    end loop OperationLoop ;
+
+    -- Wait for outputs to propagate and signal TestDone
+    WaitForClock(ManagerRec, 2) ;
+    WaitForBarrier(TestDone) ;
+    wait ;
+  end process ManagerProc ;
+
+  ------------------------------------------------------------
+  -- MemoryProc
+  --   Generate transactions on the memory's transaction
+  --   interface from node 1
+  ------------------------------------------------------------
+  MemoryProc : process
+    variable Done           : integer := 0 ;
+    variable Error          : integer := 0 ;
+    variable IntReq         : integer := 0 ;
+    variable NodeNum        : integer := 1 ;
+  begin
+    -- Initialise VProc code
+    CoSimInit(NodeNum);
+
+    -- Find exit of reset
+    wait until nReset = '1' ;
+    WaitForClock(SubordinateRec, 2) ;
+
+    OperationLoop : loop
+
+      CoSimTrans (SubordinateRec, Done, Error, IntReq, NodeNum);
+
+      AlertIf(Error /= 0, "CoSimTrans node 1 flagged an error") ;
+
+      exit when Done /= 0;
+
+    end loop OperationLoop ;
+
+    -- Wait for outputs to propagate and signal TestDone
+    WaitForClock(SubordinateRec, 2) ;
+    WaitForBarrier(TestDone) ;
+    wait ;
+  end process MemoryProc ;
+
+end SktServer ;
+
+Configuration TbAb_SktServer of TbAddressBusMemory is
+  for TestHarness
+    for TestCtrl_1 : TestCtrl
+      use entity work.TestCtrl(SktServer) ;
+    end for ;
+  end for ;
+end TbAb_SktServer ;
@@ -55,6 +55,11 @@ analyze TbAb_InterruptCoSim5.vhd
 MkVproc $::osvvm::OsvvmCoSimDirectory/tests/interruptClass
 simulate TbAb_InterruptCoSim5 [CoSim]
 
+# Use interrupt notifications to a socket client
+analyze TbAb_InterruptCoSim2.vhd
+MkVproc $::osvvm::OsvvmCoSimDirectory/tests/interruptSkt
+simulate TbAb_InterruptCoSim2 [CoSim]
+
 # Use Interrupt Handling in Vproc
 analyze TbAb_InterruptCoSim2.vhd
 MkVproc $::osvvm::OsvvmCoSimDirectory/tests/interruptCB
@@ -17,6 +17,7 @@
 #
 #  Revision History:
 #    Date      Version    Description
+#    10/2026   2026.10    Added full-duplex stream test
 #     3/2023   2023.04    Initial release
 #
 #
@@ -37,6 +38,7 @@
 #  limitations under the License.
 
 analyze Tb_xMii1.vhd
+analyze Tb_xMii2.vhd
 
 ChangeWorkingDirectory ../../tests
 MkVproc  stream_ethernet
@@ -58,3 +60,8 @@ simulate Tb_xMii1 [generic MII_INTERFACE RMII]  [generic MII_BPS BPS_100M] [CoSi
 
 TestName   CoSim_ethernet_streams
 simulate Tb_xMii1 [generic MII_INTERFACE RMII]  [generic MII_BPS BPS_10M]  [CoSim]
+
+MkVproc  stream_ethernet_duplex
+
+TestName   CoSim_ethernet_duplex
+simulate Tb_xMii2 [generic MII_INTERFACE GMII] [generic MII_BPS BPS_1G]    [CoSim]
@@ -16,6 +16,7 @@
 //
 //  Revision History:
 //    Date      Version    Description
+//    10/2026   2026.10    Added local burst check and burst generator tests
 //    05/2023   2023.05    Initial revision
 //
 //  This file is part of OSVVM.
@@ -39,12 +40,15 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstdint>
+#include <cstring>
 #include <cmath>
 #include <algorithm>
 #include <vector>
 
 // Import VProc user API
 #include "OsvvmCosimInt.h"
+#include "OsvvmCosimBurstCheck.h"
+#include "OsvvmCosimBurstGen.h"
 
 // I am node 0 context
 static int node  = 0;
@@ -525,6 +529,140 @@ extern "C" void VUserMain0()
     cosim.transBurstRead(addr, 64);        rdcount++;
     cosim.transBurstCheckData(wbuf, 64);
 
+    // -------------------------------
+    // Test local burst checking
+
+    int first;
+
+    cosim.transSetLocalBurstCheck();
+
+    addr   = 0x2800a310;
+    wdata8 = 0xf3;
+
+    cosim.transBurstWriteIncrement(addr, wdata8, 200); wrcount++;
+    cosim.transBurstReadCheckIncrement(addr, wdata8, 200); rdcount++;
+
+    if (cosim.transGetBurstCheckResult(&first))
+    {
+        VPrint("***ERROR: local increment burst check failed at index %d\n", first);
+        error = true;
+    }
+
+    cosim.transBurstRead(addr, 200);  rdcount++;
+    cosim.transBurstCheckIncrement(wdata8, 200);
+
+    if (cosim.transGetBurstCheckResult(&first))
+    {
+        VPrint("***ERROR: local increment FIFO burst check failed at index %d\n", first);
+        error = true;
+    }
+
+    addr = 0x3800c5a1;
+
+    for (i = 0; i < 128; i++)
+    {
+        wbuf[i] = (0x35 + i*7) ^ (i >> 2);
+    }
+
+    cosim.transBurstWrite(addr, wbuf, 128); wrcount++;
+    cosim.transBurstReadCheckData(addr, wbuf, 128); rdcount++;
+
+    if (cosim.transGetBurstCheckResult(&first))
+    {
+        VPrint("***ERROR: local data burst check failed at index %d\n", first);
+        error = true;
+    }
+
+    cosim.transBurstRead(addr, 128);  rdcount++;
+    cosim.transBurstCheckData(wbuf, 128);
+
+    if (cosim.transGetBurstCheckResult(&first))
+    {
+        VPrint("***ERROR: local data FIFO burst check failed at index %d\n", first);
+        error = true;
+    }
+
+    addr   = 0x4800e002;
+    wdata8 = 0x6c;
+
+    cosim.transBurstWriteRandom(addr, wdata8, 300); wrcount++;
+    cosim.transBurstReadCheckRandom(addr, wdata8, 300); rdcount++;
+
+    if (cosim.transGetBurstCheckResult(&first))
+    {
+        VPrint("***ERROR: local random burst check failed at index %d\n", first);
+        error = true;
+    }
+
+    cosim.transBurstRead(addr, 300);  rdcount++;
+    cosim.transBurstCheckRandom(wdata8, 300);
+
+    if (cosim.transGetBurstCheckResult(&first))
+    {
+        VPrint("***ERROR: local random FIFO burst check failed at index %d\n", first);
+        error = true;
+    }
+
+    // Check that locally generated random data matches that written by the simulation
+    OsvvmCosimBurstGen::fillRandom(wbuf, wdata8, 300);
+    cosim.transBurstRead(addr, rbuf, 300); rdcount++;
+
+    if (OsvvmCosimBurstCheck::checkData(rbuf, wbuf, 300, &first))
+    {
+        VPrint("***ERROR: generated random burst data mismatch at index %d. Exp 0x%02x Got 0x%02x\n", first, wbuf[first], rbuf[first]);
+        error = true;
+    }
+
+    // Check generated increment and random patterns against the simulation's
+    // fills for first bytes at the edges of the range, and lengths from a
+    // single byte up to a full burst buffer
+    const uint8_t genstart[] = {0x00, 0x01, 0x80, 0xfe, 0xff};
+    const int     genlen[]   = {1, 2, 15, 17, 1000, DATABUF_SIZE};
+
+    addr = 0x48100000;
+
+    for (int type = BURST_INCR; type <= BURST_RAND; type++)
+    {
+        for (int sidx = 0; sidx < (int)(sizeof(genstart)/sizeof(genstart[0])); sidx++)
+        {
+            for (int lidx = 0; lidx < (int)(sizeof(genlen)/sizeof(genlen[0])); lidx++)
+            {
+                int len = genlen[lidx];
+
+                if (type == BURST_INCR)
+                {
+                    cosim.transBurstWriteIncrement(addr, genstart[sidx], len); wrcount++;
+                }
+                else
+                {
+                    cosim.transBurstWriteRandom(addr, genstart[sidx], len); wrcount++;
+                }
+
+                OsvvmCosimBurstGen::fill(type, wbuf, genstart[sidx], len);
+                cosim.transBurstRead(addr, rbuf, len); rdcount++;
+
+                if (OsvvmCosimBurstCheck::checkData(rbuf, wbuf, len, &first))
+                {
+                    VPrint("***ERROR: generated %s burst (first 0x%02x, length %d) mismatch at index %d. Exp 0x%02x Got 0x%02x\n",
+                           type == BURST_INCR ? "increment" : "random", genstart[sidx], len, first, wbuf[first], rbuf[first]);
+                    error = true;
+                }
+            }
+        }
+    }
+
+    // Check that a corrupted byte is located by the bulk compare
+    memcpy(rbuf, wbuf, 128);
+    rbuf[77] ^= 0x10;
+
+    if (OsvvmCosimBurstCheck::checkData(rbuf, wbuf, 128, &first) != 1 || first != 77)
+    {
+        VPrint("***ERROR: bulk burst compare did not locate corrupted byte (got index %d)\n", first);
+        error = true;
+    }
+
+    cosim.transSetLocalBurstCheck(false);
+
     // -------------------------------
     // Check read and write transaction counts
 
@@ -23,6 +23,7 @@
 //  Revision History:
 //    Date      Version    Description
 //    09/2022   2023.01    Initial revision
+//    10/2026   2026.10    Memory accesses via an OsvvmCosimIssBridge address map
 //
 //  This file is part of OSVVM.
 //
@@ -47,23 +48,26 @@
 #include <cstdint>
 
 #include "OsvvmCosim.h"
+#include "OsvvmCosimIssBridge.h"
 #include "rv32.h"
 #include "rv32_cpu_gdb.h"
 
 static const int node = 0;
 
-// Type definition for write transaction, for use in TCP/IP socket script generation
-typedef struct {
-    uint32_t addr;
-    uint32_t wdata;
-    uint32_t size;
-} wtrans_t;
-
-// Local file pointer for optionally generating TCP/IP socket script file for each transaction
+// Local file pointer for optionally generating TCP/IP socket script file for each bus transaction
 static FILE *sktfp = NULL;
 
+// ISS memory bridge, used by the memory callback (which has no user handle)
+static OsvvmCosimIssBridge *pIss = NULL;
+
 static bool IntReq = false;
 
+// Test bench interrupt generation register address
+static const uint32_t INT_GEN_REG_ADDR      = 0xaffffffc;
+
+// Exchanges with the simulation after an interrupt generation register write
+static const int      INT_LATENCY_EXCHANGES = 2;
+
 // -------------------------------------------------------------------------
 // Dump registers using calls to rv32 object
 // -------------------------------------------------------------------------
@@ -117,32 +121,6 @@ static void mem_dump(uint32_t num, uint32_t start, rv32* pCpu, FILE* dfp)
     fprintf(dfp, "\n");
 }
 
-// ------------------------------------------------------------------------------
-// Generate a socket script based on transacion struct and rnw flag.
-// ------------------------------------------------------------------------------
-
-static void logGdbMsg(FILE *fp, wtrans_t &w, bool rnw)
-{
-    char msg[256];
-
-    if (rnw)
-    {
-        sprintf(msg, "m%08x,%d\n", w.addr, w.size/8);
-    }
-    else
-    {
-        int byteSize = w.size/8;
-        switch(w.size)
-        {
-        case 32: sprintf(msg, "M%08x,%d:%08x\n", w.addr, byteSize, w.wdata); break;
-        case 16: sprintf(msg, "M%08x,%d:%04x\n", w.addr, byteSize, w.wdata & 0xffff); break;
-        case  8: sprintf(msg, "M%08x,%d:%02x\n", w.addr, byteSize, w.wdata & 0xff); break;
-        }
-    }
-
-    fprintf(fp, "%s", msg);
-}
-
 // -------------------------------------------------------------------------
 // Checks register status for test code exit pass/fail
 // -------------------------------------------------------------------------
@@ -176,47 +154,40 @@ uint32_t riscv_interrupt_callback (const rv32i_time_t time, rv32i_time_t *wakeup
 }
 
 // -------------------------------------------------------------------------
-// ISS memory access callback function
+// Interrupt generation register MMIO callback. Writes go to the simulation,
+// which raises the interrupt, and the simulation is then given some
+// exchanges for the interrupt to come back before the program, running
+// from local memory, checks for it.
 // -------------------------------------------------------------------------
 
-static int memcosim (const uint32_t byte_addr, uint32_t &data, const int type, const rv32i_time_t time)
+static int int_gen_reg (const uint32_t addr, uint32_t &data, const int type, void* hdl)
 {
-    int        cycle_count = 5;
-    uint8_t    rdata8;
-    uint16_t   rdata16;
-    uint32_t   rdata32;
-    wtrans_t   trans;
-    OsvvmCosim cosim(node);
-
-    // Select the co-simulation call based on the access type
-    switch(type)
+    OsvvmCosim* pCosim = (OsvvmCosim*)hdl;
+
+    if ((type & OsvvmCosimIssBridge::ISS_ACCESS_MASK) < OsvvmCosimIssBridge::ISS_RD_BYTE)
     {
-        case MEM_WR_ACCESS_BYTE  : cosim.transWrite(byte_addr,  (uint8_t)data)           ; break;
-        case MEM_WR_ACCESS_HWORD : cosim.transWrite(byte_addr, (uint16_t)data)           ; break;
-        case MEM_WR_ACCESS_WORD  : cosim.transWrite(byte_addr, (uint32_t)data)           ; break;
-        case MEM_WR_ACCESS_INSTR : cosim.transWrite(byte_addr, (uint32_t)data)           ; break;
-        case MEM_RD_ACCESS_BYTE  : cosim.transRead(byte_addr,  &rdata8);  data = rdata8  ; break;
-        case MEM_RD_ACCESS_HWORD : cosim.transRead(byte_addr,  &rdata16); data = rdata16 ; break;
-        case MEM_RD_ACCESS_WORD  : cosim.transRead(byte_addr,  &rdata32); data = rdata32 ; break;
-        case MEM_RD_ACCESS_INSTR : cosim.transRead(byte_addr,  &rdata32); data = rdata32 ; break;
-        default: cycle_count = RV32I_EXT_MEM_NOT_PROCESSED; break;
-    }
+        pCosim->transWrite(addr, data);
 
-    // If the socket script file point is active, save off a TCP/IP transaction packet command
-    if (sktfp != NULL)
+        for (int idx = 0; idx < INT_LATENCY_EXCHANGES; idx++)
+        {
+            pCosim->tick(1);
+        }
+    }
+    else
     {
-        bool rnw = (type >= MEM_RD_ACCESS_BYTE);
-        
-        trans.addr = byte_addr;
-        trans.wdata = data;
-        trans.size  = (type == MEM_WR_ACCESS_BYTE  || type == MEM_RD_ACCESS_BYTE)  ?  8 :
-                      (type == MEM_WR_ACCESS_HWORD || type == MEM_RD_ACCESS_HWORD) ? 16 :
-                                                                                     32 ;
-
-        logGdbMsg(sktfp, trans, rnw);
+        pCosim->transRead(addr, &data);
     }
 
-    return cycle_count;
+    return 5;
+}
+
+// -------------------------------------------------------------------------
+// ISS memory access callback function
+// -------------------------------------------------------------------------
+
+static int memcosim (const uint32_t byte_addr, uint32_t &data, const int type, const rv32i_time_t time)
+{
+    return pIss->Access(byte_addr, data, type, time);
 }
 
 // =========================================================================
@@ -253,6 +224,19 @@ extern "C" void VUserMain0()
     // Open up a socket script file
     sktfp = fopen("sktscript.txt", "w");
 
+    // Create an ISS memory bridge, with the program's memory in local host RAM
+    // and only the interrupt generation register going to the simulation.
+    // Unmapped accesses go to the co-simulation bus.
+    OsvvmCosimIssBridge iss(node);
+    iss.AddRamRegion(0x00000000, 0x0000ffff);
+    iss.AddMmioRegion(INT_GEN_REG_ADDR, INT_GEN_REG_ADDR + 3, int_gen_reg, &cosim);
+    iss.SetScriptFile(sktfp);
+    pIss = &iss;
+
+    // Tick the simulation every 100 cycles of local accesses, so that it
+    // keeps advancing whilst the program runs from local memory
+    iss.SetSyncQuantum(100);
+
     // Create a new cpu object
     rv32* pCpu               = new rv32();
 
@@ -349,6 +333,8 @@ extern "C" void VUserMain0()
         fclose(cfg.dbg_fp);
     }
     delete pCpu;
+
+    iss.PrintStats();
     
     // Flag to the simulation we're finished, after 10 more iterations
     cosim.tick(10, true, error);
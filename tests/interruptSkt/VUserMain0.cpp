@@ -0,0 +1,170 @@
+// -------------------------------------------------------------------------
+// VUserMain0()
+//
+// Entry point for OSVVM co-simulation code for node 0
+//
+// This function runs the interruptCB test's transactions from a host
+// client thread, over a Unix domain socket, with the client subscribed
+// to the node's interrupts. The interrupt vector changes seen by the
+// node, with the same change detection as for a registered interrupt
+// callback, are notified to the client, whose interrupt callback counts
+// them, rather than the host polling for them.
+//
+// -------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <chrono>
+
+#include "OsvvmCosim.h"
+#include "OsvvmCosimSkt.h"
+#include "OsvvmCosimSktClient.h"
+
+static int node = 0;
+
+#ifdef TEST
+
+extern "C" int VTick(uint32_t, uint32_t)
+{
+    exit(0);
+}
+
+#endif
+
+#if !(defined (_WIN32) || defined (_WIN64))
+
+// -------------------------------------------------------------------------
+// Host client interrupt callback, counting the notifications
+// -------------------------------------------------------------------------
+
+static void HostInterruptCB(const int vec, void* hdl)
+{
+    VPrint("HostInterruptCB() called with vector %x\n", vec);
+
+    (*(int*)hdl)++;
+}
+
+// -------------------------------------------------------------------------
+// Host client thread. Connects, retrying until the simulation side is
+// ready, subscribes to interrupts, and writes and reads back words,
+// checking the read data and the number of interrupt notifications.
+// -------------------------------------------------------------------------
+
+static void HostClient(bool* error)
+{
+    const int           MAXRETRIES = 200;
+
+    OsvvmCosimSktClient client;
+    int                 interrupt_count = 0;
+    uint32_t            wdata = 0;
+
+    for (int retries = 0; client.Connect(OSVVM_COSIM_UNIX) != OsvvmCosimSktClient::OSVVM_COSIM_OK; retries++)
+    {
+        if (retries == MAXRETRIES)
+        {
+            VPrint("HostClient: ***Error failed to connect\n");
+            *error = true;
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    client.SetInterruptCB(HostInterruptCB, &interrupt_count);
+
+    if (client.SubscribeInterrupts() != OsvvmCosimSktClient::OSVVM_COSIM_OK)
+    {
+        VPrint("HostClient: ***Error interrupt subscription refused\n");
+        *error = true;
+    }
+
+    for (int loop = 0; loop < 4; loop++)
+    {
+        uint32_t addr  = 0x10000000;
+        uint64_t rdata;
+
+        for (int idx = 0; idx < 4; idx++)
+        {
+            client.Write(addr, wdata + idx);
+            addr  += 4;
+        }
+
+        addr = 0x10000000;
+
+        for (int idx = 0; idx < 4; idx++)
+        {
+            if (client.Read(addr, rdata) != OsvvmCosimSktClient::OSVVM_COSIM_OK || rdata != (wdata + idx))
+            {
+                VPrint("HostClient: ***ERROR*** read %08X from address %08X. Expected %08x\n", (uint32_t)rdata, addr, wdata + idx);
+                *error = true;
+                break;
+            }
+            addr += 4;
+        }
+
+        wdata += 0x10;
+    }
+
+    if (interrupt_count != 2)
+    {
+        VPrint("HostClient: ***ERROR*** Wrong interrupt notification count. Expected 2, got %d\n", interrupt_count);
+        *error = true;
+    }
+    else
+    {
+        VPrint("HostClient: saw %d interrupt notifications\n", interrupt_count);
+    }
+
+    client.Detach();
+    client.Close();
+}
+
+#endif
+
+// -------------------------------------------------------------------------
+// -------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    std::string test_name("TbAb_InterruptCoSim2");
+    OsvvmCosim  cosim(node, test_name);
+    bool error = false;
+
+#if !(defined (_WIN32) || defined (_WIN64))
+
+    bool        client_error = false;
+    std::thread client(HostClient, &client_error);
+
+    // Blocks until the client connects
+    OsvvmCosimSkt skt(node, 0xc000, false, '#', '$', 2, OSVVM_COSIM_UNIX);
+
+    if (skt.ProcessPkts() != OsvvmCosimSkt::OSVVM_COSIM_OK)
+    {
+        fprintf(stderr, "***ERROR: socket exited with bad status\n");
+        error = true;
+    }
+
+    client.join();
+
+    error |= client_error;
+
+#endif
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    cosim.tick(10, true, error);
+
+    SLEEPFOREVER;
+
+}
+
+#ifdef TEST
+int main (int argc, char* argv[])
+{
+    VUserMain0();
+
+    return 0;
+}
+
+#endif
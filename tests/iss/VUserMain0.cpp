@@ -7,7 +7,8 @@
 // and starts listening. When the process_pkts() method is called it will
 // process gdb remote serial interface commands for memory reads and writes
 // up to 64 bits, calling the co-sim API to instigate bus transactions on
-// OSVVM.
+// OSVVM. The socket script logged by the ISS bridge, of cache line fills
+// and write-combined bursts, is then replayed with OsvvmCosimReplay.
 //
 // -------------------------------------------------------------------------
 
@@ -17,21 +18,19 @@
 #include <string>
 
 #include "OsvvmCosim.h"
+#include "OsvvmCosimIssBridge.h"
+#include "OsvvmCosimReplay.h"
 #include "rv32.h"
 #include "rv32_cpu_gdb.h"
 
 static const int node = 0;
 
-// Type definition for write transaction, for use in TCP/IP socket script generation
-typedef struct {
-    uint32_t addr;
-    uint32_t wdata;
-    uint32_t size;
-} wtrans_t;
-
-// Local file pointer for optionally generating TCP/IP socket script file for each transaction
+// Local file pointer for optionally generating TCP/IP socket script file for each bus transaction
 static FILE *sktfp = NULL;
 
+// ISS memory bridge, used by the memory callback (which has no user handle)
+static OsvvmCosimIssBridge *pIss = NULL;
+
 // -------------------------------------------------------------------------
 // Dump registers using calls to rv32 object
 // -------------------------------------------------------------------------
@@ -85,32 +84,6 @@ static void mem_dump(uint32_t num, uint32_t start, rv32* pCpu, FILE* dfp)
     fprintf(dfp, "\n");
 }
 
-// ------------------------------------------------------------------------------
-// Generate a socket script based on transacion struct and rnw flag.
-// ------------------------------------------------------------------------------
-
-static void logGdbMsg(FILE *fp, wtrans_t &w, bool rnw)
-{
-    char msg[256];
-
-    if (rnw)
-    {
-        sprintf(msg, "m%08x,%d\n", w.addr, w.size/8);
-    }
-    else
-    {
-        int byteSize = w.size/8;
-        switch(w.size)
-        {
-        case 32: sprintf(msg, "M%08x,%d:%08x\n", w.addr, byteSize, w.wdata); break;
-        case 16: sprintf(msg, "M%08x,%d:%04x\n", w.addr, byteSize, w.wdata & 0xffff); break;
-        case  8: sprintf(msg, "M%08x,%d:%02x\n", w.addr, byteSize, w.wdata & 0xff); break;
-        }
-    }
-
-    fprintf(fp, "%s", msg);
-}
-
 // -------------------------------------------------------------------------
 // -------------------------------------------------------------------------
 
@@ -125,42 +98,7 @@ static bool check_exit_status(rv32* pCpu)
 
 static int memcosim (const uint32_t byte_addr, uint32_t &data, const int type, const rv32i_time_t time)
 {
-    int        cycle_count = 5;
-    uint8_t    rdata8;
-    uint16_t   rdata16;
-    uint32_t   rdata32;
-    wtrans_t   trans;
-    OsvvmCosim cosim(node);
-
-    // Select the co-simulation call based on the access type
-    switch(type)
-    {
-        case MEM_WR_ACCESS_BYTE  : cosim.transWrite(byte_addr,  (uint8_t)data)           ; break;
-        case MEM_WR_ACCESS_HWORD : cosim.transWrite(byte_addr, (uint16_t)data)           ; break;
-        case MEM_WR_ACCESS_WORD  : cosim.transWrite(byte_addr, (uint32_t)data)           ; break;
-        case MEM_WR_ACCESS_INSTR : cosim.transWrite(byte_addr, (uint32_t)data)           ; break;
-        case MEM_RD_ACCESS_BYTE  : cosim.transRead(byte_addr,  &rdata8);  data = rdata8  ; break;
-        case MEM_RD_ACCESS_HWORD : cosim.transRead(byte_addr,  &rdata16); data = rdata16 ; break;
-        case MEM_RD_ACCESS_WORD  : cosim.transRead(byte_addr,  &rdata32); data = rdata32 ; break;
-        case MEM_RD_ACCESS_INSTR : cosim.transRead(byte_addr,  &rdata32); data = rdata32 ; break;
-        default: cycle_count = RV32I_EXT_MEM_NOT_PROCESSED; break;
-    }
-
-    // If the socket script file point is active, save off a TCP/IP transaction packet command
-    if (sktfp != NULL)
-    {
-        bool rnw = (type >= MEM_RD_ACCESS_BYTE);
-
-        trans.addr = byte_addr;
-        trans.wdata = data;
-        trans.size  = (type == MEM_WR_ACCESS_BYTE  || type == MEM_RD_ACCESS_BYTE)  ?  8 :
-                      (type == MEM_WR_ACCESS_HWORD || type == MEM_RD_ACCESS_HWORD) ? 16 :
-                                                                                     32 ;
-
-        logGdbMsg(sktfp, trans, rnw);
-    }
-
-    return cycle_count;
+    return pIss->Access(byte_addr, data, type, time);
 }
 
 // =========================================================================
@@ -197,6 +135,16 @@ extern "C" void VUserMain0()
     // Open up a socket script file
     sktfp = fopen("sktscript.txt", "w");
 
+    // Create an ISS memory bridge, with the program's code and data on the
+    // co-simulation bus, fetched and loaded via caches as line bursts, with
+    // stores write-combined. Any other accesses go to the bus uncached.
+    OsvvmCosimIssBridge iss(node);
+    iss.EnableCache();
+    iss.AddBusRegion(0x00000000, 0x00000fff, 4, 0, OsvvmCosimIssBridge::ISS_CACHE_INSTR | OsvvmCosimIssBridge::ISS_CACHE_WC);
+    iss.AddBusRegion(0x00001000, 0x0000ffff, 4, 0, OsvvmCosimIssBridge::ISS_CACHE_DATA  | OsvvmCosimIssBridge::ISS_CACHE_WC);
+    iss.SetScriptFile(sktfp);
+    pIss = &iss;
+
     // Create a new cpu object
     rv32* pCpu               = new rv32();
 
@@ -287,6 +235,35 @@ extern "C" void VUserMain0()
     }
     delete pCpu;
 
+    // Write out any combined stores still buffered
+    iss.Flush();
+    iss.PrintStats();
+
+    // Replay the logged line fills and write-combined bursts, checking the
+    // script compiles to one operation per bus transaction, and that reads
+    // of bytes it wrote return them
+    fclose(sktfp);
+    sktfp = NULL;
+
+    OsvvmCosimReplay replay(node, OsvvmCosimReplay::REPLAY_CHECK_WRITTEN);
+
+    if (replay.Load("sktscript.txt") != OsvvmCosimReplay::OSVVM_COSIM_OK ||
+        (uint64_t)replay.NumOps() != iss.BusTransactions())
+    {
+        VPrint("***ERROR: socket script compiled to %d operations for %llu bus transactions\n",
+               replay.NumOps(), (unsigned long long)iss.BusTransactions());
+        error = true;
+    }
+    else if (replay.Run() != 0)
+    {
+        VPrint("***ERROR: socket script replay had %d read check errors\n", replay.NumErrors());
+        error = true;
+    }
+    else
+    {
+        VPrint("Replayed %d logged bus transactions, with %d read checks\n", replay.NumOps(), replay.NumChecks());
+    }
+
     // Flag to the simulation we're finished, after 10 more iterations
     cosim.tick(10, true, error);
 
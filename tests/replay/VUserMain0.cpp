@@ -0,0 +1,179 @@
+// -------------------------------------------------------------------------
+// VUserMain0()
+//
+// Entry point for OSVVM co-simulation code for node 0
+//
+// This function writes a socket script of random word writes and bursts
+// of various sizes, followed by reads of them back, some with expected
+// data given in the script and the rest checked against the script's
+// own writes. The script is then memory mapped, compiled and replayed
+// in-process with the OsvvmCosimReplay class, without any socket or
+// client program. A read with bad expected data is also replayed from a
+// script in memory, checking that it is flagged.
+//
+// -------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+
+#include "OsvvmCosim.h"
+#include "OsvvmCosimReplay.h"
+
+static int node = 0;
+
+#ifdef TEST
+
+extern "C" int VTick(uint32_t, uint32_t)
+{
+    exit(0);
+}
+
+#endif
+
+// -------------------------------------------------------------------------
+// -------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    const int   NUMWORDS  = 64;
+    const int   NUMBURSTS = 16;
+    const char* SCRIPT    = "replay_script.txt";
+
+    std::string test_name("CoSim_replay");
+    OsvvmCosim  cosim(node, test_name);
+    bool        error = false;
+
+    uint32_t    wdata[NUMWORDS];
+    int         wsize[NUMWORDS];
+    uint8_t     bdata[NUMBURSTS][512];
+    int         bsize[NUMBURSTS];
+    int         reads = 0;
+
+    srandom(0x5eed);
+
+    FILE* fp = fopen(SCRIPT, "w");
+
+    if (fp == NULL)
+    {
+        VPrint("VUserMain0: ***ERROR failed to open %s\n", SCRIPT);
+        error = true;
+    }
+    else
+    {
+        fprintf(fp, "# Random words of 1, 2 and 4 bytes, each in its own double word\n");
+
+        for (int idx = 0; idx < NUMWORDS; idx++)
+        {
+            wsize[idx] = 1 << (random() % 3);
+            wdata[idx] = (random() ^ (random() << 16)) & (wsize[idx] == 4 ? 0xffffffff : (1 << (8*wsize[idx])) - 1);
+
+            fprintf(fp, "M%08x,%d:%0*x\n", 0x1000 + idx*8, wsize[idx], 2*wsize[idx], wdata[idx]);
+        }
+
+        fprintf(fp, "# Bursts of random lengths and data\n");
+
+        for (int idx = 0; idx < NUMBURSTS; idx++)
+        {
+            bsize[idx] = 9 + random() % 500;
+
+            fprintf(fp, "M%08x,%x:", 0x10000 + idx*0x200, bsize[idx]);
+
+            for (int bdx = 0; bdx < bsize[idx]; bdx++)
+            {
+                bdata[idx][bdx] = random() & 0xff;
+                fprintf(fp, "%02x", bdata[idx][bdx]);
+            }
+            fprintf(fp, "\n");
+        }
+
+        fprintf(fp, "\n# Read back, alternately with and without expected data\n");
+
+        for (int idx = 0; idx < NUMWORDS; idx++, reads++)
+        {
+            if (idx & 1)
+            {
+                fprintf(fp, "m%08x,%d\n", 0x1000 + idx*8, wsize[idx]);
+            }
+            else
+            {
+                fprintf(fp, "m%08x,%d:%0*x\n", 0x1000 + idx*8, wsize[idx], 2*wsize[idx], wdata[idx]);
+            }
+        }
+
+        for (int idx = 0; idx < NUMBURSTS; idx++, reads++)
+        {
+            fprintf(fp, "m%08x,%x", 0x10000 + idx*0x200, bsize[idx]);
+
+            if (idx & 1)
+            {
+                fprintf(fp, ":");
+
+                for (int bdx = 0; bdx < bsize[idx]; bdx++)
+                {
+                    fprintf(fp, "%02x", bdata[idx][bdx]);
+                }
+            }
+            fprintf(fp, "\n");
+        }
+
+        // A word read of the start of the first burst, checked against its written bytes
+        fprintf(fp, "m%08x,4\n", 0x10000);
+        reads++;
+
+        fprintf(fp, "D\n");
+
+        fclose(fp);
+
+        OsvvmCosimReplay replay(node, OsvvmCosimReplay::REPLAY_CHECK_WRITTEN);
+
+        if (replay.Load(SCRIPT) != OsvvmCosimReplay::OSVVM_COSIM_OK)
+        {
+            error = true;
+        }
+        else if (replay.Run() != 0 || replay.NumChecks() != reads)
+        {
+            VPrint("VUserMain0: ***ERROR replay of %d ops had %d errors in %d checks (expected %d)\n",
+                   replay.NumOps(), replay.NumErrors(), replay.NumChecks(), reads);
+            error = true;
+        }
+        else
+        {
+            VPrint("VUserMain0: replayed %d ops with %d read checks\n", replay.NumOps(), replay.NumChecks());
+        }
+    }
+
+    // A read of bad expected data must fail its check
+    const char       badscript[] = "M00003000,4:12345678\nm00003000,4:12345679\n";
+    OsvvmCosimReplay badreplay(node, 0);
+
+    VPrint("VUserMain0: expecting a read check error\n");
+
+    if (badreplay.Compile(badscript, sizeof(badscript)-1) != OsvvmCosimReplay::OSVVM_COSIM_OK || badreplay.Run() != 1)
+    {
+        VPrint("VUserMain0: ***ERROR bad read data not flagged\n");
+        error = true;
+    }
+
+    if (!error)
+    {
+        printf("DONE\n");
+    }
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    cosim.tick(10, true, error);
+
+    SLEEPFOREVER;
+
+}
+
+#ifdef TEST
+int main (int argc, char* argv[])
+{
+    VUserMain0();
+
+    return 0;
+}
+
+#endif
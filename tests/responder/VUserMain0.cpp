@@ -340,6 +340,30 @@ extern "C" void VUserMain0()
     
     cosim.transReadCheck(addr, data32); rcount++;
 
+    waitOnBarrier();
+    cosim.tick(50);
+
+    addr   = testvals[tidx++] = 0x3a5c0010;
+    data32 = testvals[tidx++] = 0x600dcafe;
+
+    cosim.transWrite(addr, data32); wcount++;
+
+    waitOnBarrier();
+    cosim.tick(50);
+
+    addr   = testvals[tidx++] = 0x4b6d0020;
+    data32 = testvals[tidx++] = 0x0ddba115;
+
+    cosim.transReadCheck(addr, data32); rcount++;
+
+    waitOnBarrier();
+    cosim.tick(50);
+
+    addr   = testvals[tidx++] = 0x5c7e0030;
+    data32 = testvals[tidx++] = 0xfeedf00d;
+
+    cosim.transReadCheck(addr, data32); rcount++;
+
     // Flag to the simulation we're finished, after 10 more iterations
     cosim.tick(10, true, error);
 
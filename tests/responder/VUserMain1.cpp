@@ -467,6 +467,79 @@ extern "C" void VUserMain1()
     avail = sub.respTrySendRead(&addr, data32);
     error |= checkdata(addr, data32, tidx, avail, true, "respTrySendRead"); tidx+=2;
 
+    // ------------------------------------
+    // Test respWaitAny
+
+    releaseBarrier(0);
+
+    if (sub.respWaitAny(&addr, &data32) != WRITE_CHANNEL)
+    {
+        VPrint("***ERROR: Unexpected channel from respWaitAny. Exp write channel\n");
+        error = true;
+    }
+
+    error |= checkdata(addr, data32, tidx, true, true, "respWaitAny"); tidx+=2;
+
+    releaseBarrier(0);
+
+    if (sub.respWaitAny(&addr, &data32) != READ_CHANNEL)
+    {
+        VPrint("***ERROR: Unexpected channel from respWaitAny. Exp read channel\n");
+        error = true;
+    }
+
+    data32 = testvals[tidx+1];
+    sub.respSendReadData(data32);
+    error |= checkdata(addr, data32, tidx, true, true, "respWaitAny"); tidx+=2;
+
+    // ------------------------------------
+    // Test respSetLatencyTable
+
+    OsvvmCosimLatency lat;
+    const int         histcycles[3]  = {2, 8, 32};
+    const uint32_t    histweights[3] = {6, 3, 1};
+
+    lat.addFixed    (0x5c7e0000, 0x5c7effff, 20, OsvvmCosimLatency::LATENCY_READ);
+    lat.addUniform  (0x60000000, 0x6000ffff, 4, 12);
+    lat.addHistogram(0x70000000, 0x7000ffff, histcycles, histweights, 3);
+
+    if (lat.addFixed(0x5c7e8000, 0x5c7e8fff, 1, OsvvmCosimLatency::LATENCY_READ))
+    {
+        VPrint("***ERROR: overlapping latency range unexpectedly accepted\n");
+        error = true;
+    }
+
+    if (lat.getLatency(0x5c7e0030, true) != 20 || lat.getLatency(0x5c7e0030, false) != 0 || lat.getLatency(0x80000000, true) != 0)
+    {
+        VPrint("***ERROR: unexpected fixed latency from latency table\n");
+        error = true;
+    }
+
+    for (int idx = 0; idx < 100; idx++)
+    {
+        int ulat = lat.getLatency(0x60000100, false);
+        int hlat = lat.getLatency(0x70000100, true);
+
+        if (ulat < 4 || ulat > 12 || (hlat != 2 && hlat != 8 && hlat != 32))
+        {
+            VPrint("***ERROR: latency out of range from latency table (%d %d)\n", ulat, hlat);
+            error = true;
+            break;
+        }
+    }
+
+    sub.respSetLatencyTable(&lat);
+
+    releaseBarrier(0);
+
+    sub.respGetReadAddress(&addr);
+
+    data32 = testvals[tidx+1];
+    sub.respSendReadData(data32);
+    error |= checkdata(addr, data32, tidx, true, true, "respSendReadData with latency"); tidx+=2;
+
+    sub.respSetLatencyTable(NULL);
+
     // ------------------------------------
     // Test respGetWriteTransactionCount,
     // respGetReadTransactionCount
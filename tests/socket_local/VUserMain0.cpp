@@ -0,0 +1,248 @@
+// -------------------------------------------------------------------------
+// VUserMain0()
+//
+// Entry point for OSVVM co-simulation code for node 0
+//
+// This function creates a socket object for each of the local host
+// transports (a Unix domain socket and a shared memory ring pair) in turn,
+// with a host client thread, using the client library, connecting to it and
+// writing and reading back words and a burst with gdb remote serial
+// interface commands, and then reading the words back again pipelined,
+// in no-ack mode, which the ProcessPkts() method turns into bus
+// transactions on OSVVM. The client's transaction methods are then used,
+// over the binary protocol, to write and read back words, synchronously
+// and pipelined asynchronously, and a burst. Each transport is run both
+// with packets received in line and on the socket's asynchronous network
+// I/O thread.
+//
+// -------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <chrono>
+
+#include "OsvvmCosim.h"
+#include "OsvvmCosimSkt.h"
+#include "OsvvmCosimSktClient.h"
+
+static int node = 0;
+
+#ifdef TEST
+
+extern "C" int VTick(uint32_t, uint32_t)
+{
+    exit(0);
+}
+
+#endif
+
+#if !(defined (_WIN32) || defined (_WIN64))
+
+// -------------------------------------------------------------------------
+// Host client thread. Connects over the given transport, retrying until
+// the simulation side is ready, writes and reads back some words and a
+// burst, checking the responses, first with packets and then with the
+// transaction methods, and then detaches.
+// -------------------------------------------------------------------------
+
+static void HostClient(const int transport, bool* error)
+{
+    const int           NUMWORDS   = 16;
+    const int           MAXRETRIES = 200;
+
+    OsvvmCosimSktClient client;
+    std::string         resp;
+    char                cmd[64];
+    char                exp[16];
+
+    for (int retries = 0; client.Connect(transport) != OsvvmCosimSktClient::OSVVM_COSIM_OK; retries++)
+    {
+        if (retries == MAXRETRIES)
+        {
+            VPrint("HostClient: ***Error failed to connect on transport %d\n", transport);
+            *error = true;
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    for (int idx = 0; idx < NUMWORDS; idx++)
+    {
+        sprintf(cmd, "M%08x,4:%08x", 0x1000 + idx*4, 0x900df00d + idx*0x01010101);
+
+        if (client.Transact(cmd, resp) != OsvvmCosimSktClient::OSVVM_COSIM_OK || resp != "OK")
+        {
+            VPrint("HostClient: ***Error bad response to write %d: %s\n", idx, resp.c_str());
+            *error = true;
+        }
+    }
+
+    for (int idx = 0; idx < NUMWORDS; idx++)
+    {
+        sprintf(cmd, "m%08x,4", 0x1000 + idx*4);
+        sprintf(exp, "%08x", 0x900df00d + idx*0x01010101);
+
+        if (client.Transact(cmd, resp) != OsvvmCosimSktClient::OSVVM_COSIM_OK || resp != exp)
+        {
+            VPrint("HostClient: ***Error read %d got %s, exp %s\n", idx, resp.c_str(), exp);
+            *error = true;
+        }
+    }
+
+    // A 64 byte burst, written and read back
+    std::string burst;
+
+    for (int idx = 0; idx < 64; idx++)
+    {
+        sprintf(exp, "%02x", (idx * 37) & 0xff);
+        burst += exp;
+    }
+
+    if (client.Transact("M00002000,40:" + burst, resp) != OsvvmCosimSktClient::OSVVM_COSIM_OK || resp != "OK" ||
+        client.Transact("m00002000,40", resp)          != OsvvmCosimSktClient::OSVVM_COSIM_OK || resp != burst)
+    {
+        VPrint("HostClient: ***Error burst read back mismatch: %s\n", resp.c_str());
+        *error = true;
+    }
+
+    // Read the words back again, pipelined, with all the reads sent before any responses
+    if (client.StartNoAckMode() != OsvvmCosimSktClient::OSVVM_COSIM_OK)
+    {
+        VPrint("HostClient: ***Error no-ack mode refused\n");
+        *error = true;
+    }
+
+    for (int idx = 0; idx < NUMWORDS; idx++)
+    {
+        sprintf(cmd, "m%08x,4", 0x1000 + idx*4);
+        client.SendPkt(cmd);
+    }
+
+    for (int idx = 0; idx < NUMWORDS; idx++)
+    {
+        sprintf(exp, "%08x", 0x900df00d + idx*0x01010101);
+
+        if (client.RecvPkt(resp) != OsvvmCosimSktClient::OSVVM_COSIM_OK || resp != exp)
+        {
+            VPrint("HostClient: ***Error pipelined read %d got %s, exp %s\n", idx, resp.c_str(), exp);
+            *error = true;
+        }
+    }
+
+    // Write words with the transaction methods, and read them back, synchronously and pipelined
+    uint64_t rdata[NUMWORDS];
+    int      tag = 0;
+
+    for (int idx = 0; idx < NUMWORDS; idx++)
+    {
+        client.WriteAsync(0x3000 + idx*8, 0x0123456789abcdefULL ^ idx, (idx & 1) ? 8 : 4);
+    }
+
+    for (int idx = 0; idx < NUMWORDS; idx++)
+    {
+        tag = client.ReadAsync(0x3000 + idx*8, &rdata[idx], (idx & 1) ? 8 : 4);
+    }
+
+    if (client.Wait(tag) != OsvvmCosimSktClient::OSVVM_COSIM_OK ||
+        client.Read(0x3000, rdata[0]) != OsvvmCosimSktClient::OSVVM_COSIM_OK)
+    {
+        VPrint("HostClient: ***Error transaction methods failed\n");
+        *error = true;
+    }
+
+    for (int idx = 0; idx < NUMWORDS; idx++)
+    {
+        uint64_t expdata = (0x0123456789abcdefULL ^ idx) & ((idx & 1) ? ~0ULL : 0xffffffffULL);
+
+        if (rdata[idx] != expdata)
+        {
+            VPrint("HostClient: ***Error async read %d got %016llx, exp %016llx\n", idx,
+                   (unsigned long long)rdata[idx], (unsigned long long)expdata);
+            *error = true;
+        }
+    }
+
+    // A 256 byte burst, written, read back and checked by the simulation
+    uint8_t wburst[256], rburst[256];
+
+    for (int idx = 0; idx < 256; idx++)
+    {
+        wburst[idx] = (idx * 53) & 0xff;
+    }
+
+    if (client.BurstWrite(0x4000, wburst, 256)     != OsvvmCosimSktClient::OSVVM_COSIM_OK ||
+        client.BurstRead(0x4000, rburst, 256)      != OsvvmCosimSktClient::OSVVM_COSIM_OK ||
+        client.BurstReadCheck(0x4000, wburst, 256) != OsvvmCosimSktClient::OSVVM_COSIM_OK ||
+        memcmp(wburst, rburst, 256) != 0)
+    {
+        VPrint("HostClient: ***Error burst transaction read back mismatch\n");
+        *error = true;
+    }
+
+    client.Detach();
+    client.Close();
+}
+
+#endif
+
+// -------------------------------------------------------------------------
+// -------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    std::string test_name("CoSim_socket_local");
+    OsvvmCosim  cosim(node, test_name);
+    bool error = false;
+
+#if !(defined (_WIN32) || defined (_WIN64))
+
+    const int transports[] = {OSVVM_COSIM_UNIX, OSVVM_COSIM_SHM};
+
+    for (int idx = 0; idx < 4; idx++)
+    {
+        bool        client_error = false;
+        std::thread client(HostClient, transports[idx/2], &client_error);
+
+        // Blocks until the client connects
+        OsvvmCosimSkt skt(node, 0xc000, false, '#', '$', 2, transports[idx/2]);
+
+        skt.SetAsyncIo(idx & 1);
+
+        if (skt.ProcessPkts() != OsvvmCosimSkt::OSVVM_COSIM_OK)
+        {
+            fprintf(stderr, "***ERROR: socket exited with bad status\n");
+            error = true;
+        }
+
+        client.join();
+
+        error |= client_error;
+    }
+
+#endif
+
+    if (!error)
+    {
+        printf("DONE\n");
+    }
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    cosim.tick(10, true, error);
+
+    SLEEPFOREVER;
+
+}
+
+#ifdef TEST
+int main (int argc, char* argv[])
+{
+    VUserMain0();
+
+    return 0;
+}
+
+#endif
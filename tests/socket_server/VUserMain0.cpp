@@ -0,0 +1,218 @@
+// -------------------------------------------------------------------------
+// VUserMain0()
+//
+// Entry point for OSVVM co-simulation code for node 0
+//
+// This function starts a multi-client socket server object, shared with
+// node 1, which opens a TCP/IP server socket and accepts clients in an I/O
+// thread. Host client threads, using the client library, connect to it
+// concurrently: one using its assigned node (node 0) and two addressing
+// node 1 with a node prefix. Each writes words, with gdb remote serial
+// interface commands, and then reads them back pipelined, in no-ack mode,
+// checking that it gets its own responses in order. A request for a node
+// with no ProcessNode() loop must be answered at once with an error. The
+// ProcessNode() method turns the node 0 requests into bus transactions on
+// OSVVM, until the clients have finished and the server is stopped.
+//
+// -------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <chrono>
+
+#include "OsvvmCosim.h"
+#include "OsvvmCosimSktServer.h"
+#include "OsvvmCosimSktClient.h"
+
+static int node = 0;
+
+// Socket server, shared with VUserMain1, which services node 1
+OsvvmCosimSktServer SktServer;
+
+#ifdef TEST
+
+extern "C" int VTick(uint32_t, uint32_t)
+{
+    exit(0);
+}
+
+#endif
+
+#if !(defined (_WIN32) || defined (_WIN64))
+
+// -------------------------------------------------------------------------
+// Host client thread. Waits until both nodes are serviced and connects,
+// then writes words to its own address range, on node prefixnode (or its
+// assigned node if negative), and reads them back pipelined, checking
+// that the responses are its own and in order. Client 0 also checks that
+// a request for an unserviced node gets an immediate error.
+// -------------------------------------------------------------------------
+
+static void HostClient(const int id, const int prefixnode, bool* error)
+{
+    const int           NUMWORDS   = 32;
+    const int           MAXRETRIES = 200;
+    const uint32_t      base       = 0x1000 * (id + 1);
+
+    OsvvmCosimSktClient client;
+    std::string         resp;
+    std::string         prefix;
+    char                cmd[64];
+    char                exp[16];
+
+    if (prefixnode >= 0)
+    {
+        sprintf(cmd, "%c%x:", OsvvmCosimSktServer::NODE_PREFIX_CHAR, prefixnode);
+        prefix = cmd;
+    }
+
+    for (int retries = 0; !SktServer.NodeServiced(0) || !SktServer.NodeServiced(1) ||
+                          client.Connect(OSVVM_COSIM_TCP, SktServer.PortNumber()) != OsvvmCosimSktClient::OSVVM_COSIM_OK; retries++)
+    {
+        if (retries == MAXRETRIES)
+        {
+            VPrint("HostClient%d: ***Error failed to connect\n", id);
+            *error = true;
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    for (int idx = 0; idx < NUMWORDS; idx++)
+    {
+        sprintf(cmd, "M%08x,4:%08x", base + idx*4, (id << 28) | (idx * 0x00010101));
+
+        if (client.Transact(prefix + cmd, resp) != OsvvmCosimSktClient::OSVVM_COSIM_OK || resp != "OK")
+        {
+            VPrint("HostClient%d: ***Error bad response to write %d: %s\n", id, idx, resp.c_str());
+            *error = true;
+        }
+    }
+
+    if (id == 0 && (client.Transact("@2:m00001000,4", resp) != OsvvmCosimSktClient::OSVVM_COSIM_OK || resp != "E01"))
+    {
+        VPrint("HostClient%d: ***Error expected error for an unserviced node, got %s\n", id, resp.c_str());
+        *error = true;
+    }
+
+    // Read the words back pipelined, with all the reads sent before any responses
+    if (client.StartNoAckMode() != OsvvmCosimSktClient::OSVVM_COSIM_OK)
+    {
+        VPrint("HostClient%d: ***Error no-ack mode refused\n", id);
+        *error = true;
+    }
+
+    for (int idx = 0; idx < NUMWORDS; idx++)
+    {
+        sprintf(cmd, "m%08x,4", base + idx*4);
+        client.SendPkt(prefix + cmd);
+    }
+
+    for (int idx = 0; idx < NUMWORDS; idx++)
+    {
+        sprintf(exp, "%08x", (id << 28) | (idx * 0x00010101));
+
+        if (client.RecvPkt(resp) != OsvvmCosimSktClient::OSVVM_COSIM_OK || resp != exp)
+        {
+            VPrint("HostClient%d: ***Error pipelined read %d got %s, exp %s\n", id, idx, resp.c_str(), exp);
+            *error = true;
+        }
+    }
+
+    client.Detach();
+    client.Close();
+}
+
+// -------------------------------------------------------------------------
+// Run the host clients concurrently, one on node 0 and two prefixed for
+// node 1, and then stop the server, releasing both nodes
+// -------------------------------------------------------------------------
+
+static void HostClients(bool* error)
+{
+    const int   NUMCLIENTS = 3;
+    const int   prefixnode[NUMCLIENTS] = {-1, 1, 1};
+
+    bool        client_error[NUMCLIENTS];
+    std::thread clients[NUMCLIENTS];
+
+    for (int id = 0; id < NUMCLIENTS; id++)
+    {
+        client_error[id] = false;
+        clients[id]      = std::thread(HostClient, id, prefixnode[id], &client_error[id]);
+    }
+
+    for (int id = 0; id < NUMCLIENTS; id++)
+    {
+        clients[id].join();
+        *error |= client_error[id];
+    }
+
+    SktServer.Stop();
+}
+
+#endif
+
+// -------------------------------------------------------------------------
+// -------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    std::string         test_name("CoSim_socket_server");
+    OsvvmCosim          cosim(node, test_name);
+    bool error = false;
+
+#if !(defined (_WIN32) || defined (_WIN64))
+
+    bool client_error = false;
+
+    // Keep running as clients detach, until stopped once all are done
+    SktServer.SetPersistent(true);
+
+    if (SktServer.Start() != OsvvmCosimSktServer::OSVVM_COSIM_OK)
+    {
+        fprintf(stderr, "***ERROR: socket server failed to start\n");
+        SktServer.Stop();
+        error = true;
+    }
+    else
+    {
+        std::thread clients(HostClients, &client_error);
+
+        if (SktServer.ProcessNode(node) != OsvvmCosimSktServer::OSVVM_COSIM_OK)
+        {
+            fprintf(stderr, "***ERROR: socket server exited with bad status\n");
+            error = true;
+        }
+
+        clients.join();
+
+        error |= client_error;
+    }
+
+#endif
+
+    if (!error)
+    {
+        printf("DONE\n");
+    }
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    cosim.tick(10, true, error);
+
+    SLEEPFOREVER;
+
+}
+
+#ifdef TEST
+int main (int argc, char* argv[])
+{
+    VUserMain0();
+
+    return 0;
+}
+
+#endif
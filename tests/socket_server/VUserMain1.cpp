@@ -0,0 +1,50 @@
+// -------------------------------------------------------------------------
+// VUserMain1()
+//
+// Entry point for OSVVM co-simulation code for node 1
+//
+// This function services node 1 of the socket server started by node 0,
+// calling its ProcessNode() method to process the gdb remote serial
+// interface commands that clients address to node 1 with a node prefix,
+// instigating transactions on the memory model's transaction interface,
+// until the server is stopped.
+//
+// -------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+#include "OsvvmCosim.h"
+#include "OsvvmCosimSktServer.h"
+
+static int node = 1;
+
+// Socket server, started by VUserMain0
+extern OsvvmCosimSktServer SktServer;
+
+// -------------------------------------------------------------------------
+// -------------------------------------------------------------------------
+
+extern "C" void VUserMain1()
+{
+    OsvvmCosim cosim(node);
+    bool error = false;
+
+#if !(defined (_WIN32) || defined (_WIN64))
+
+    // May be called before the server is started, waiting for requests
+    if (SktServer.ProcessNode(node) != OsvvmCosimSktServer::OSVVM_COSIM_OK)
+    {
+        fprintf(stderr, "***ERROR: socket server node %d exited with bad status\n", node);
+        error = true;
+    }
+
+#endif
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    cosim.tick(10, true, error);
+
+    SLEEPFOREVER;
+
+}
@@ -40,10 +40,14 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstdint>
+#include <thread>
+#include <chrono>
 
 // Import OSVVM user API for streams
 #include "OsvvmCosimStreamTx.h"
 #include "OsvvmCosimStreamRx.h"
+#include "OsvvmCosimStreamDemux.h"
+#include "OsvvmCosimScoreboard.h"
 
 #ifdef _WIN32
 #define srandom srand
@@ -64,6 +68,36 @@ int makeAxiStreamParam(const int TID, const int TDEST, const int TUSER, const in
     return ((TID & 0xff) << 9) | ((TDEST & 0xf) << 5) | ((TUSER & 0xf) << 1) | (TLAST & 0x1);
 }
 
+// ------------------------------------------------------------------------------
+// Demux consumer thread, receiving and checking the packets on a single
+// channel, where each packet is filled with its channel's TID followed by an
+// incrementing count, and is baselen + 8*count bytes long. A non-zero delay
+// makes a slow consumer, sleeping that many milliseconds before each receive.
+// ------------------------------------------------------------------------------
+
+static void DemuxConsumer(OsvvmCosimStreamDemux* demux, const int tid, const int numpkts, const int baselen, const int delay, bool* error)
+{
+    uint8_t rxbuf[BUF_SIZE];
+    int     status;
+
+    for (int pkt = 0; pkt < numpkts; pkt++)
+    {
+        if (delay)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        }
+
+        int len = demux->recv(demux->key(tid), rxbuf, BUF_SIZE, &status);
+
+        if (OsvvmCosimStreamDemux::paramTid(status) != tid || rxbuf[0] != tid || rxbuf[1] != pkt || len != baselen + 8*pkt)
+        {
+            VPrint("***ERROR: demux channel %d packet %d: got TID %d, data 0x%02x 0x%02x, length %d\n",
+                   tid, pkt, OsvvmCosimStreamDemux::paramTid(status), rxbuf[0], rxbuf[1], len);
+            *error = true;
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------
 // Main entry point for node 0 virtual processor software
 //
@@ -636,6 +670,183 @@ extern "C" void VUserMain0()
         error = true;
     }
 
+    // =============================================================
+    // Packet receive, with prefetch whilst ticking
+
+    axistreamrx.streamSetRxPrefetch(true);
+
+    if (axistreamrx.peekPacket() != -1)
+    {
+        VPrint("***ERROR: got unexpected packet from peekPacket.\n");
+        error = true;
+    }
+
+    bufidx = 0;
+
+    axistreamtx.streamBurstSendAsync(&TestData0[bufidx], 40);  bufidx += 40;
+    axistreamtx.streamBurstSendAsync(&TestData0[bufidx], 300); bufidx += 300;
+    axistreamtx.streamBurstSendAsync(&TestData0[bufidx], 7);   bufidx += 7;
+
+    // Bursts are collected into the ring whilst ticking
+    axistreamtx.tick(500);
+
+    if (axistreamrx.streamRxPacketsWaiting() != 3)
+    {
+        VPrint("***ERROR: unexpected number of prefetched packets. Got %d, exp 3\n", axistreamrx.streamRxPacketsWaiting());
+        error = true;
+    }
+
+    if (axistreamrx.peekPacket() != 40)
+    {
+        VPrint("***ERROR: unexpected length from peekPacket. Got %d, exp 40\n", axistreamrx.peekPacket());
+        error = true;
+    }
+
+    bufidx = 0;
+
+    for (int pkt = 0; pkt < 3; pkt++)
+    {
+        int explen = (pkt == 0) ? 40 : (pkt == 1) ? 300 : 7;
+        int len    = axistreamrx.recvPacket(RxData, BUF_SIZE);
+
+        if (len != explen)
+        {
+            VPrint("***ERROR: unexpected length from recvPacket. Got %d, exp %d\n", len, explen);
+            error = true;
+            break;
+        }
+
+        for (int idx = 0; idx < len; idx++)
+        {
+            if (RxData[idx] != TestData0[bufidx + idx])
+            {
+                VPrint("VuserMain%d: ***ERROR mismatch in received packet byte. Got 0x%02x, expected 0x%02x\n", node, RxData[idx], TestData0[bufidx + idx]);
+                error = true;
+                break;
+            }
+        }
+
+        bufidx += len;
+    }
+
+    axistreamrx.streamSetRxPrefetch(false);
+
+    // =============================================================
+    // Queued burst sends, with credits from a 256 byte TX burst FIFO
+
+    axistreamtx.streamSetTxQueue(256);
+
+    bufidx = 0;
+
+    axistreamtx.streamBurstSendQueued(&TestData0[bufidx], 200); bufidx += 200;
+    axistreamtx.streamBurstSendQueued(&TestData0[bufidx], 100); bufidx += 100;
+    axistreamtx.streamBurstSendQueued(&TestData0[bufidx], 150); bufidx += 150;
+
+    if (axistreamtx.streamTxQueued() != 3)
+    {
+        VPrint("***ERROR: unexpected number of queued bursts. Got %d, exp 3\n", axistreamtx.streamTxQueued());
+        error = true;
+    }
+
+    // Queued bursts are sent whilst ticking, as FIFO space allows
+    axistreamtx.tick(5);
+    axistreamtx.streamTxQueueFlush();
+
+    bufidx = 0;
+
+    axistreamrx.streamBurstCheck(&TestData0[bufidx], 200); bufidx += 200;
+    axistreamrx.streamBurstCheck(&TestData0[bufidx], 100); bufidx += 100;
+    axistreamrx.streamBurstCheck(&TestData0[bufidx], 150); bufidx += 150;
+
+    // =============================================================
+    // Demultiplex bursts, interleaved over two TIDs, to a consumer thread per TID
+
+    {
+        const int DEMUX_PKTS = 4;
+
+        OsvvmCosimStreamDemux demux(node, OsvvmCosimStreamDemux::DEMUX_TID);
+        bool                  demux_error[2] = {false, false};
+
+        for (int pkt = 0; pkt < DEMUX_PKTS; pkt++)
+        {
+            for (int tid = 1; tid <= 2; tid++)
+            {
+                TestData0[0] = tid;
+                TestData0[1] = pkt;
+                axistreamtx.streamBurstSendAsync(TestData0, 16 + 8*pkt, makeAxiStreamParam(tid, TDEST, TUSER, 1));
+            }
+        }
+
+        std::thread chan2(DemuxConsumer, &demux, 2, DEMUX_PKTS, 16, 0, &demux_error[1]);
+        std::thread chan1(DemuxConsumer, &demux, 1, DEMUX_PKTS, 16, 0, &demux_error[0]);
+
+        chan2.join();
+        chan1.join();
+
+        error |= demux_error[0] | demux_error[1];
+    }
+
+    // =============================================================
+    // Demultiplex, with rings of just one maximum sized burst, to a slow
+    // consumer on TID 1, so that the stream is back pressured until the slow
+    // consumer makes room, with no packets lost
+
+    {
+        const int DEMUX_PKTS = 8;
+        const int DEMUX_LEN  = 512;
+
+        OsvvmCosimStreamDemux demux(node, OsvvmCosimStreamDemux::DEMUX_TID, 0, 0);
+        bool                  demux_error[2] = {false, false};
+
+        for (int pkt = 0; pkt < DEMUX_PKTS; pkt++)
+        {
+            for (int tid = 1; tid <= 2; tid++)
+            {
+                TestData0[0] = tid;
+                TestData0[1] = pkt;
+                axistreamtx.streamBurstSendAsync(TestData0, DEMUX_LEN + 8*pkt, makeAxiStreamParam(tid, TDEST, TUSER, 1));
+            }
+        }
+
+        std::thread chan2(DemuxConsumer, &demux, 2, DEMUX_PKTS, DEMUX_LEN, 0,  &demux_error[1]);
+        std::thread chan1(DemuxConsumer, &demux, 1, DEMUX_PKTS, DEMUX_LEN, 20, &demux_error[0]);
+
+        chan2.join();
+        chan1.join();
+
+        error |= demux_error[0] | demux_error[1];
+    }
+
+    // =============================================================
+    // Check bursts over three TIDs with an out of order scoreboard, keyed on TID
+
+    {
+        const int            SB_PKTS = 9;
+        OsvvmCosimScoreboard sb(OsvvmCosimScoreboard::SB_OUT_OF_ORDER, 64, 64, "CoSim_axi4_streams scoreboard");
+        int                  status;
+
+        bufidx = 0;
+
+        for (int pkt = 0; pkt < SB_PKTS; pkt++)
+        {
+            int tid = pkt % 3;
+            int len = 8 + 4*pkt;
+
+            sb.push(tid, &TestData0[bufidx], len);
+            axistreamtx.streamBurstSendAsync(&TestData0[bufidx], len, makeAxiStreamParam(tid, TDEST, TUSER, 1));
+            bufidx += len;
+        }
+
+        for (int pkt = 0; pkt < SB_PKTS; pkt++)
+        {
+            int len = axistreamrx.recvPacket(RxData, BUF_SIZE, &status);
+
+            sb.check(OsvvmCosimStreamDemux::paramTid(status), RxData, len);
+        }
+
+        error |= !sb.summary();
+    }
+
     // -------------------------------------------------------------
 
     // Flag to the simulation we're finished, after 10 more ticks
@@ -39,9 +39,13 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstdint>
+#include <cstring>
+#include <chrono>
 
 // Import OSVVM user API for streams
 #include "OsvvmCosimStream.h"
+#include "OsvvmCosimEthFrame.h"
+#include "OsvvmCosimPcap.h"
 
 #ifdef _WIN32
 #define srandom srand
@@ -57,6 +61,21 @@ static int node  = 0;
 extern uint8_t TestData1[BUF_SIZE];
 static uint8_t RxData[BUF_SIZE];
 
+// ------------------------------------------------------------------------------
+// Ethernet frame configurations for frame tests
+// ------------------------------------------------------------------------------
+
+OsvvmCosimEthFrame::eth_frame_cfg_t frameCfg[2] =
+{
+    // Plain frame with an ethertype of 0x88b5 (local experimental)
+    {{0x02, 0x00, 0x00, 0x00, 0x00, 0x01}, {0x02, 0x00, 0x00, 0x00, 0x00, 0x02},
+     false, 0x0000, false, 0x88b5, 0, 0, 0, 0, 0},
+
+    // VLAN tagged IPv4/UDP frame
+    {{0x02, 0x00, 0x00, 0x00, 0x00, 0x02}, {0x02, 0x00, 0x00, 0x00, 0x00, 0x01},
+     true, 0x6123, true, 0, 0xc0a80001, 0xc0a80002, 17, 64, 0x1234}
+};
+
 // ------------------------------------------------------------------------------
 // Checkt two data bytes
 // ------------------------------------------------------------------------------
@@ -74,6 +93,62 @@ bool checkRdata(uint8_t got, uint8_t exp, int idx, int node_num)
     return error;
 }
 
+// ------------------------------------------------------------------------------
+// Host time in microseconds, as used for capture time stamps
+// ------------------------------------------------------------------------------
+
+static uint64_t hostUsecs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// ------------------------------------------------------------------------------
+// Check the next frame of a capture against the one expected, and that its
+// time stamp lies between the host times taken either side of the frame's
+// send or receive
+// ------------------------------------------------------------------------------
+
+static bool checkCapFrame(OsvvmCosimPcapReplay &cap, const int fidx, const OsvvmCosimEthFrame::eth_frame_cfg_t& cfg,
+                          const uint8_t* payload, const int len, const int expdir, const uint64_t start, const uint64_t end)
+{
+    uint8_t        expframe[OsvvmCosimEthFrame::ETH_MAX_FRAME_SIZE];
+    const uint8_t* frame;
+    uint32_t       framelen;
+    uint64_t       usecs;
+    int            dir;
+
+    if (cap.NextFrame(frame, framelen, &usecs, &dir) != OsvvmCosimPcapReplay::OSVVM_COSIM_OK)
+    {
+        VPrint("VUserMain%d: ***ERROR*** capture frame %d missing\n", node, fidx);
+        return true;
+    }
+
+    int explen = OsvvmCosimEthFrame::buildFrame(expframe, cfg, payload, len);
+
+    bool error = false;
+
+    if (framelen != (uint32_t)explen || memcmp(frame, expframe, explen) != 0)
+    {
+        VPrint("VUserMain%d: ***ERROR*** capture frame %d does not match that sent (%d bytes, expected %d)\n", node, fidx, framelen, explen);
+        error = true;
+    }
+
+    if (dir != expdir)
+    {
+        VPrint("VUserMain%d: ***ERROR*** capture frame %d has direction %d, expected %d\n", node, fidx, dir, expdir);
+        error = true;
+    }
+
+    if (usecs < start || usecs > end)
+    {
+        VPrint("VUserMain%d: ***ERROR*** capture frame %d time stamp %llu outside %llu to %llu\n", node, fidx,
+               (unsigned long long)usecs, (unsigned long long)start, (unsigned long long)end);
+        error = true;
+    }
+
+    return error;
+}
+
 // ------------------------------------------------------------------------------
 // Main entry point for node 0 virtual processor software
 //
@@ -140,6 +215,71 @@ extern "C" void VUserMain0()
         error |= checkRdata(RxData[idx], TestData1[idx], idx, node);
     }
 
+    // Send frames to node 1, and check the frame it returns, capturing
+    // the frames sent and received on this node to a pcapng file
+    OsvvmCosimEthFrame    eth(&txrx);
+    OsvvmCosimPcap        pcap;
+
+    if (pcap.Open("stream_ethernet.pcapng") == OsvvmCosimPcap::OSVVM_COSIM_OK)
+    {
+        pcap.TapNode(node);
+    }
+
+    // Host times either side of each frame, to check the capture time stamps
+    uint64_t frameTime[4];
+
+    frameTime[0] = hostUsecs();
+    eth.sendFrame(frameCfg[0], &TestData0[0],   20);
+    frameTime[1] = hostUsecs();
+    eth.sendFrame(frameCfg[1], &TestData0[100], 500);
+    frameTime[2] = hostUsecs();
+
+    int status = eth.recvCheckFrame(frameCfg[1], &TestData1[0], 300);
+    frameTime[3] = hostUsecs();
+
+    if (status != OsvvmCosimEthFrame::ETH_FRAME_OK)
+    {
+        VPrint("VUserMain%d: ***ERROR*** bad received frame (status 0x%02x, first payload mismatch at %d)\n", node, status, eth.getMismatchIndex());
+        error = true;
+    }
+
+    pcap.UntapNode(node);
+    pcap.Close();
+
+    // Read back the capture, checking the frames and their timing, and
+    // then replay the two sent frames to node 1 again
+    OsvvmCosimPcapReplay  cap;
+
+    if (cap.Open("stream_ethernet.pcapng") != OsvvmCosimPcapReplay::OSVVM_COSIM_OK)
+    {
+        error = true;
+    }
+    else
+    {
+        const uint8_t* frame;
+        uint32_t       framelen;
+
+        error |= checkCapFrame(cap, 0, frameCfg[0], &TestData0[0],   20,  OsvvmCosimPcapReplay::PCAP_DIR_TX, frameTime[0], frameTime[1]);
+        error |= checkCapFrame(cap, 1, frameCfg[1], &TestData0[100], 500, OsvvmCosimPcapReplay::PCAP_DIR_TX, frameTime[1], frameTime[2]);
+        error |= checkCapFrame(cap, 2, frameCfg[1], &TestData1[0],   300, OsvvmCosimPcapReplay::PCAP_DIR_RX, frameTime[2], frameTime[3]);
+
+        if (cap.NextFrame(frame, framelen) == OsvvmCosimPcapReplay::OSVVM_COSIM_OK)
+        {
+            VPrint("VUserMain%d: ***ERROR*** unexpected extra frame in capture\n", node);
+            error = true;
+        }
+
+        cap.Rewind();
+
+        if (cap.Replay(&txrx, 2) != 2)
+        {
+            VPrint("VUserMain%d: ***ERROR*** failed to replay captured frames\n", node);
+            error = true;
+        }
+
+        cap.Close();
+    }
+
     // Flag to the simulation we're finished, after 10 more iterations
     txrx.tick(10, true, error);
 
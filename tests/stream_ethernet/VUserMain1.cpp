@@ -42,6 +42,7 @@
 
 // Import OSVVM user API
 #include "OsvvmCosimStream.h"
+#include "OsvvmCosimEthFrame.h"
 
 #ifdef _WIN32
 #define srandom srand
@@ -63,6 +64,12 @@ static uint8_t RxData[BUF_SIZE];
 
 extern bool checkRdata(uint8_t got, uint8_t exp, int idx, int node_num);
 
+// ------------------------------------------------------------------------------
+// Use VUserMain0's frame configurations
+// ------------------------------------------------------------------------------
+
+extern OsvvmCosimEthFrame::eth_frame_cfg_t frameCfg[2];
+
 // ------------------------------------------------------------------------------
 // Main entry point for node 1 virtual processor software
 //
@@ -129,6 +136,37 @@ extern "C" void VUserMain1()
         error |= checkRdata(RxData[idx], TestData0[idx], idx, node);
     }
 
+    // Check frames from node 0, and return one
+    OsvvmCosimEthFrame    eth(&txrx);
+
+    const int payloadlen[2] = {20, 500};
+    const int payloadidx[2] = {0, 100};
+
+    for (int fidx = 0; fidx < 2; fidx++)
+    {
+        int status = eth.recvCheckFrame(frameCfg[fidx], &TestData0[payloadidx[fidx]], payloadlen[fidx]);
+
+        if (status != OsvvmCosimEthFrame::ETH_FRAME_OK)
+        {
+            VPrint("VUserMain%d: ***ERROR*** bad received frame %d (status 0x%02x, first payload mismatch at %d)\n", node, fidx, status, eth.getMismatchIndex());
+            error = true;
+        }
+    }
+
+    eth.sendFrame(frameCfg[1], &TestData1[0], 300);
+
+    // Check the two frames again, as replayed from node 0's capture
+    for (int fidx = 0; fidx < 2; fidx++)
+    {
+        int status = eth.recvCheckFrame(frameCfg[fidx], &TestData0[payloadidx[fidx]], payloadlen[fidx]);
+
+        if (status != OsvvmCosimEthFrame::ETH_FRAME_OK)
+        {
+            VPrint("VUserMain%d: ***ERROR*** bad replayed frame %d (status 0x%02x, first payload mismatch at %d)\n", node, fidx, status, eth.getMismatchIndex());
+            error = true;
+        }
+    }
+
     // Flag to the simulation we're finished, after 10 more iterations
     txrx.tick(10, true, error);
 
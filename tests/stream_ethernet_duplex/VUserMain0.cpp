@@ -0,0 +1,155 @@
+// ------------------------------------------------------------------------------
+//
+//  File Name:           VUserMain0.cpp
+//  Design Unit Name:    Co-simulation duplex stream Ethernet VC test program
+//  Revision:            OSVVM MODELS STANDARD VERSION
+//
+//  Maintainer:          Simon Southwell      email:  simon.southwell@gmail.com
+//  Contributor(s):
+//     Simon Southwell   simon.southwell@gmail.com
+//
+//  Description:
+//      Co-simulation full-duplex burst streaming test using OSVVM Ethernet VC,
+//      with concurrent send and receive threads on node 0
+//
+//  Developed by:
+//        Simon Southwell
+//
+//  Revision History:
+//    Date      Version    Description
+//    10/2026   2026.10    Initial revision
+//
+//  This file is part of OSVVM.
+//
+//  Copyright (c) 2026 by [OSVVM Authors](../../AUTHORS.md)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+// ------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <thread>
+
+// Import OSVVM user API for streams
+#include "OsvvmCosimStream.h"
+
+#ifdef _WIN32
+#define srandom srand
+#define random rand
+#endif
+
+#define BUF_SIZE   1024
+#define NUM_BURSTS 8
+
+// I am node 0 context
+static int node  = 0;
+
+       uint8_t TestData0[BUF_SIZE];
+extern uint8_t TestData1[BUF_SIZE];
+static uint8_t RxData[BUF_SIZE];
+
+// Burst sizes sent by each node, shared with VUserMain1
+       int     BurstSizes[NUM_BURSTS] = {128, 128, 16, 16, 32, 64, 256, 384};
+
+// ------------------------------------------------------------------------------
+// Checkt two data bytes
+// ------------------------------------------------------------------------------
+
+bool checkRdata(uint8_t got, uint8_t exp, int idx, int node_num)
+{
+    bool error = false;
+
+    if (exp != got)
+    {
+        VPrint("VUserMain%d: ***ERROR*** read 0x%02X, expected 0x%02x at index %d\n", node_num, got, exp, idx);
+        error = true;
+    }
+
+    return error;
+}
+
+// ------------------------------------------------------------------------------
+// Receive thread, getting bursts via the node's duplex receive slot
+// whilst the main thread sends
+// ------------------------------------------------------------------------------
+
+static void RxThread(OsvvmCosimStream* txrx, bool* error)
+{
+    int ridx = 0;
+
+    txrx->streamSetDuplex(true);
+
+    for (int bidx = 0; bidx < NUM_BURSTS; bidx++)
+    {
+        txrx->streamBurstGet(&RxData[ridx], BurstSizes[bidx]);
+        ridx += BurstSizes[bidx];
+    }
+
+    // Finished receiving, so release the receive slot
+    txrx->streamSetDuplex(false);
+
+    for (int idx = 0; idx < BUF_SIZE; idx++)
+    {
+        *error |= checkRdata(RxData[idx], TestData1[idx], idx, node);
+    }
+}
+
+// ------------------------------------------------------------------------------
+// Main entry point for node 0 virtual processor software
+//
+// VUserMainX has no calling arguments. If runtime configuration required
+// then you'll need to read in a configuration file.
+//
+// ------------------------------------------------------------------------------
+
+extern "C" void VUserMain0()
+{
+    VPrint("VUserMain%d()\n", node);
+
+    int      bufidx   = 0;
+    bool     error    = false;
+    bool     rx_error = false;
+
+    std::string           test_name("CoSim_ethernet_duplex");
+    OsvvmCosimStream      txrx(node, test_name);
+
+    // Use node number, inverted, as the random number generator seed.
+    srandom(~node);
+
+    // Fill test buffer with random numbers
+    for (int idx = 0; idx < BUF_SIZE; idx ++)
+    {
+        TestData0[idx] = random() & 0xff;
+    }
+
+    // Receive on a separate thread, concurrently with sending on this one
+    std::thread rx(RxThread, &txrx, &rx_error);
+
+    for (int bidx = 0; bidx < NUM_BURSTS; bidx++)
+    {
+        txrx.streamBurstSend(&TestData0[bufidx], BurstSizes[bidx]);
+        bufidx += BurstSizes[bidx];
+    }
+
+    rx.join();
+
+    error |= rx_error;
+
+    // Flag to the simulation we're finished, after 10 more iterations
+    txrx.tick(10, true, error);
+
+    // If ever got this far then sleep forever
+    SLEEPFOREVER;
+}
@@ -39,9 +39,18 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstdint>
+#include <cstring>
+
+#if !(defined (_WIN32) || defined (_WIN64))
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#endif
 
 // Import OSVVM user API for streams
 #include "OsvvmCosimStream.h"
+#include "OsvvmCosimUartBridge.h"
 
 // I am node 0 context
 static int node  = 0;
@@ -111,6 +120,56 @@ static bool CheckResult(const uint8_t rdata, const uint8_t wdata[], const int st
     return error;
 }
 
+#if !(defined (_WIN32) || defined (_WIN64))
+
+// ------------------------------------------------------------------------------
+// Terminal thread for the UART bridge test. Connects to the bridge's pty,
+// types a message, and reads it back via the testbench UART loopback.
+// ------------------------------------------------------------------------------
+
+static void PtyTerminal(const char* ptyname, const char* msg, bool* error)
+{
+    char          rxmsg[64];
+    int           len   = strlen(msg);
+    int           rxlen = 0;
+    int           fd    = open(ptyname, O_RDWR | O_NOCTTY);
+    struct pollfd pfd   = {fd, POLLIN, 0};
+
+    if (fd < 0)
+    {
+        VPrint("PtyTerminal: ***Error failed to open %s\n", ptyname);
+        *error = true;
+        return;
+    }
+
+    if (write(fd, msg, len) != len)
+    {
+        VPrint("PtyTerminal: ***Error failed to write to %s\n", ptyname);
+        *error = true;
+    }
+
+    while (rxlen < len && poll(&pfd, 1, 10000) > 0)
+    {
+        ssize_t rlen = read(fd, &rxmsg[rxlen], len - rxlen);
+
+        if (rlen <= 0)
+        {
+            break;
+        }
+        rxlen += rlen;
+    }
+
+    if (rxlen != len || memcmp(rxmsg, msg, len))
+    {
+        VPrint("PtyTerminal: ***Error mismatch on looped back message. Got %d bytes, exp %d\n", rxlen, len);
+        *error = true;
+    }
+
+    close(fd);
+}
+
+#endif
+
 // ------------------------------------------------------------------------------
 // Main entry point for node 0 virtual processor software
 //
@@ -163,6 +222,48 @@ extern "C" void VUserMain0()
         }
     }
 
+#if !(defined (_WIN32) || defined (_WIN64))
+
+    // Bridge the UART to a pty, with a terminal thread typing a message which
+    // the bridge sends as a burst and drains back, looped back, during idle
+    // ticks. The bridge runs until the terminal hangs up after the echo.
+    {
+        const char*          msg       = "OSVVM UART bridge\r\n";
+        const uint64_t       MAXTICKS  = 1000000;
+        bool                 pty_error = false;
+        OsvvmCosimUartBridge bridge(node);
+
+        if (bridge.Open(OsvvmCosimUartBridge::UART_BRIDGE_PTY) != OsvvmCosimUartBridge::OSVVM_COSIM_OK)
+        {
+            error = true;
+        }
+        else
+        {
+            std::thread terminal(PtyTerminal, bridge.PtyName(), msg, &pty_error);
+
+            bridge.Run(MAXTICKS);
+
+            terminal.join();
+
+            if (bridge.Service() >= 0)
+            {
+                VPrint("VUserMain%d: ***Error UART bridge did not see the terminal hang up\n", node);
+                error = true;
+            }
+
+            bridge.Close();
+
+            if (pty_error || bridge.TxBytes() != strlen(msg) || bridge.RxBytes() != strlen(msg) || bridge.RxErrors())
+            {
+                VPrint("VUserMain%d: ***Error UART bridge sent %d bytes, received %d with %d errors\n",
+                       node, (int)bridge.TxBytes(), (int)bridge.RxBytes(), bridge.RxErrors());
+                error = true;
+            }
+        }
+    }
+
+#endif
+
     // Flag to the simulation we're finished, after 10 more ticks
     uart.tick(10, true, error);
 
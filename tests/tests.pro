@@ -49,6 +49,15 @@ simulate   TbAb_CoSim  [CoSim]
 MkVprocSkt $::osvvm::OsvvmCoSimDirectory  tests/socket
 simulate   TbAb_CoSim  [CoSim]
 
+MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/socket_server
+simulate   TbAb_SktServer  [CoSim]
+
+MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/socket_local
+simulate   TbAb_CoSim  [CoSim]
+
+MkVproc    $::osvvm::OsvvmCoSimDirectory  tests/replay
+simulate   TbAb_CoSim  [CoSim]
+
 #if {$::osvvm::ToolName eq "GHDL"} {
 #
 #  MkVprocGhdlMain  $::osvvm::CurrentWorkingDirectory/../../../CoSim tests/ghdl_main
@@ -45,6 +45,7 @@
 
 // Import VProc user API
 #include "OsvvmCosim.h"
+#include "OsvvmCosimCoverage.h"
 
 // I am node 0 context
 static int node  = 0;
@@ -104,6 +105,12 @@ extern "C" void VUserMain0()
     std::string test_name("CoSim_usercode_size");
     OsvvmCosim  cosim(node, test_name);
 
+    // Cover reads and writes of bytes, half-words and words over four quarters of the address space
+    OsvvmCosimCoverage cov(OsvvmCosimCoverage::COV_READ | OsvvmCosimCoverage::COV_WRITE, 4);
+
+    cov.addAddrBins(0, 0x40000000, 4);
+    cosim.regTransHook(OsvvmCosimCoverage::hookCB, &cov);
+
     // Use node number, inverted, as the random number generator seed.
     srandom(~node);
 
@@ -187,6 +194,16 @@ extern "C" void VUserMain0()
         logGdbMsg(fp, wtrans, rnw);
     }
     
+    cosim.regTransHook(NULL);
+
+    cov.dump("usercode_size_cov.txt");
+
+    if (!cov.isCovered())
+    {
+        VPrint("VUserMain0: ***ERROR*** coverage of %.2f%%\n", cov.coverage());
+        error = true;
+    }
+
     // Flag to the simulation we're finished, after 10 more iterations
     cosim.tick(10, true, error);
 